@@ -0,0 +1,57 @@
+/*
+ * generator_main.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "bench/FstmGenerator.hpp"
+
+#include <cstdlib>
+#include <iostream>
+
+using bench::FstmGenerator;
+
+using std::cerr;
+using std::cout;
+using std::endl;
+
+/**
+ * Entry point of the synthetic FSTM generator. Writes on stdout a new FSTM
+ * in JSON.
+ *
+ * Usage: generateFstm states transitions features guardSize properties [seed]
+ *
+ * @author mwi
+ */
+
+/**
+ * @return 0 if the FSTM was generated, else returns 1.
+ */
+int main(int argc, const char * argv[]) {
+    if (argc != 6 && argc != 7) {
+        cerr << "Usage: generateFstm states transitions features guardSize"
+             << " properties [seed]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    const int nbOfStates = atoi(argv[1]);
+    const int nbOfTransitions = atoi(argv[2]);
+    const int nbOfFeatures = atoi(argv[3]);
+    const int guardSize = atoi(argv[4]);
+    const int nbOfProperties = atoi(argv[5]);
+    const unsigned long seed = argc == 7 ? strtoul(argv[6], NULL, 10) : 1;
+
+    if (nbOfStates <= 0 || nbOfTransitions < nbOfStates || nbOfFeatures <= 0
+            || guardSize < 0 || nbOfProperties < 0) {
+        cerr << "Invalid parameters: requires states > 0, transitions >="
+             << " states, features > 0, guardSize >= 0 and properties >= 0"
+             << endl;
+        return EXIT_FAILURE;
+    }
+
+    FstmGenerator generator(nbOfStates, nbOfTransitions, nbOfFeatures,
+            guardSize, nbOfProperties, seed);
+    generator.generate(cout);
+
+    return EXIT_SUCCESS;
+}
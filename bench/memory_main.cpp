@@ -0,0 +1,235 @@
+/*
+ * memory_main.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "core/checker/Checker.hpp"
+#include "core/checker/MemoryStats.hpp"
+
+#include "util/logging.hpp"
+#include "util/NotPossibleException.hpp"
+
+#include <glog/logging.h>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using core::checker::Checker;
+using core::checker::MemoryStats;
+
+using std::cerr;
+using std::cout;
+using std::endl;
+using std::getline;
+using std::ifstream;
+using std::map;
+using std::ofstream;
+using std::ostream;
+using std::string;
+using std::stringstream;
+using std::vector;
+
+using util::NotPossibleException;
+
+/**
+ * Entry point of the memory benchmark. Checks each input model in a child
+ * process, records its peak RSS and the bytes used by the visited states
+ * table, the BDD engine and the counter examples, and prints the deltas with
+ * relation to a baseline file.
+ *
+ * The baseline file is a CSV file with one line per model. It is written
+ * when the -u option is given, or when it does not exist yet, e.g. on the
+ * first run. The baseline is not versioned since its measures depend on the
+ * machine.
+ *
+ * Usage: runMemoryBenchmark [-u] baseline input...
+ *
+ * @author mwi
+ */
+
+/** The number of measures per model. */
+const int NbOfMeasures = 4;
+
+/** The names of the measures per model. */
+const char * MeasureNames[NbOfMeasures] = {
+    "peakRssKB", "tableBytes", "bddBytes", "counterExampleBytes"
+};
+
+/** The measures of a model, in the order of MeasureNames. */
+typedef vector<long> Measures;
+
+/**
+ * @return the measures of the model checking of 'input', run in a child
+ *          process, or an empty vector if it failed.
+ */
+Measures measure(const string & input) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        perror("pipe");
+        exit(EXIT_FAILURE);
+    }
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        exit(EXIT_FAILURE);
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        MemoryStats memory;
+        bool success = false;
+        try {
+            Checker checker(input);
+            checker.run();
+            memory = checker.getMemoryStats();
+            success = true;
+        } catch (NotPossibleException & ex) {
+            LOG(ERROR) << ex.getMessage();
+        }
+        ssize_t written = success
+                ? write(fds[1], &memory, sizeof(memory)) : 0;
+        close(fds[1]);
+        _exit(written == sizeof(memory) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    close(fds[1]);
+    MemoryStats memory;
+    bool received = read(fds[0], &memory, sizeof(memory)) == sizeof(memory);
+    close(fds[0]);
+
+    int status;
+    waitpid(pid, &status, 0);
+
+    Measures measures;
+    if (received && WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS) {
+        measures.push_back(memory.peakRss);
+        measures.push_back(memory.tableBytes);
+        measures.push_back(memory.bddBytes);
+        measures.push_back(memory.counterExampleBytes);
+    }
+    return measures;
+}
+
+/**
+ * @return the measures per model stored in the baseline file at 'path', or
+ *          an empty map if the file does not exist.
+ */
+map<string, Measures> readBaseline(const string & path) {
+    map<string, Measures> baseline;
+    ifstream in(path.c_str());
+    string line;
+    getline(in, line); // header
+    while (getline(in, line)) {
+        stringstream ss(line);
+        string model;
+        getline(ss, model, ',');
+        Measures measures;
+        string field;
+        while (getline(ss, field, ',')) {
+            measures.push_back(atol(field.c_str()));
+        }
+        if (measures.size() == NbOfMeasures) {
+            baseline[model] = measures;
+        }
+    }
+    return baseline;
+}
+
+/**
+ * @modifies out
+ * @effects Writes on 'out' the CSV header of the measures.
+ */
+void writeHeader(ostream & out) {
+    out << "model";
+    for (int i = 0; i < NbOfMeasures; ++i) {
+        out << "," << MeasureNames[i];
+    }
+    out << endl;
+}
+
+/**
+ * @return 0 if all the models were measured, else returns 1.
+ */
+int main(int argc, const char * argv[]) {
+    int first = 1;
+    bool update = false;
+    if (argc > 1 && strcmp(argv[1], "-u") == 0) {
+        update = true;
+        ++first;
+    }
+    if (argc - first < 2) {
+        cerr << "Usage: runMemoryBenchmark [-u] baseline input..." << endl;
+        return EXIT_FAILURE;
+    }
+
+    util::initLogging(argv[0]);
+
+    const string baselinePath(argv[first]);
+    if (!ifstream(baselinePath.c_str()).is_open()) {
+        cout << "No baseline at " << baselinePath << ", creating it" << endl;
+        update = true;
+    }
+    map<string, Measures> baseline = readBaseline(baselinePath);
+    map<string, Measures> current;
+    bool success = true;
+
+    for (int i = first + 1; i < argc; ++i) {
+        const string model(argv[i]);
+        Measures measures = measure(model);
+        if (measures.empty()) {
+            cerr << model << ": model checking failed" << endl;
+            success = false;
+            continue;
+        }
+        current[model] = measures;
+
+        cout << model << endl;
+        map<string, Measures>::const_iterator it = baseline.find(model);
+        for (int j = 0; j < NbOfMeasures; ++j) {
+            cout << "    " << MeasureNames[j] << ": " << measures[j];
+            if (it != baseline.end()) {
+                const long delta = measures[j] - it->second[j];
+                cout << " (" << (delta >= 0 ? "+" : "") << delta;
+                if (it->second[j] != 0) {
+                    cout << ", " << (delta >= 0 ? "+" : "")
+                         << 100.0 * delta / it->second[j] << "%";
+                }
+                cout << ")";
+            }
+            cout << endl;
+        }
+    }
+
+    if (update) {
+        for (map<string, Measures>::const_iterator it = current.begin();
+                it != current.end(); ++it) {
+            baseline[it->first] = it->second;
+        }
+        ofstream out(baselinePath.c_str());
+        writeHeader(out);
+        for (map<string, Measures>::const_iterator it = baseline.begin();
+                it != baseline.end(); ++it) {
+            out << it->first;
+            for (int j = 0; j < NbOfMeasures; ++j) {
+                out << "," << it->second[j];
+            }
+            out << endl;
+        }
+        cout << "Baseline written to " << baselinePath << endl;
+    }
+
+    util::terminateLogging();
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,266 @@
+/*
+ * micro_main.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "bench/FstmGenerator.hpp"
+
+#include "core/checker/CombinedState.hpp"
+#include "core/checker/CombinedStateTable.hpp"
+#include "core/features/BoolFeatureExp.hpp"
+#include "core/features/BoolFeatureExpFactory.hpp"
+#include "core/features/FeatureExp.hpp"
+#include "core/fts/Transition.hpp"
+#include "core/fts/fstm/ClaimPropertyState.hpp"
+#include "core/fts/fstm/FstmState.hpp"
+#include "core/fts/fstm/JsonParser.hpp"
+#include "core/fts/fstm/TransitionTable.hpp"
+
+#include "math/BoolFctCUDDFactory.hpp"
+
+#include "neverclaim/ClaimState.hpp"
+
+#include "util/Stack.hpp"
+#include "util/logging.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <sstream>
+#include <vector>
+
+using bench::FstmGenerator;
+
+using core::checker::CombinedState;
+using core::checker::CombinedStateTable;
+
+using core::features::BoolFeatureExpFactory;
+using core::features::FeatureExp;
+using core::features::FeatureExpPtr;
+
+using core::fts::PropertyStatePtr;
+using core::fts::StatePtr;
+using core::fts::TransitionGeneratorPtr;
+using core::fts::fstm::ClaimPropertyState;
+using core::fts::fstm::FstmState;
+using core::fts::fstm::FstmStatePtr;
+using core::fts::fstm::JsonParser;
+using core::fts::fstm::TransitionTable;
+
+using math::BoolFctCUDDFactory;
+using math::BoolFctFactory;
+
+using neverclaim::ClaimState;
+
+using std::auto_ptr;
+using std::stringstream;
+using std::tr1::shared_ptr;
+using std::vector;
+
+using util::Stack;
+
+/**
+ * Microbenchmarks of the hot primitives of the BDD, checker and util layers.
+ *
+ * Run with --help for the options of Google Benchmark.
+ *
+ * @author mwi
+ */
+
+/**
+ * @return the feature expression factory shared by the benchmarks.
+ */
+const BoolFeatureExpFactory & factory() {
+    static BoolFeatureExpFactory expFactory(
+            shared_ptr<BoolFctFactory>(new BoolFctCUDDFactory()));
+    return expFactory;
+}
+
+/**
+ * @return a new feature expression (F0 && !F1) || (F2 && F3) || ... over
+ *          'nbOfFeatures' features.
+ */
+FeatureExp * makeFeatureExp(int nbOfFeatures) {
+    FeatureExp * exp = factory().getFalse();
+    for (int i = 0; i + 1 < nbOfFeatures; i += 2) {
+        auto_ptr<FeatureExp> term(
+                factory().create(FstmGenerator::featureName(i)));
+        auto_ptr<FeatureExp> other(
+                factory().create(FstmGenerator::featureName(i + 1)));
+        if (i % 4 == 0) {
+            other->negation();
+        }
+        term->conjunction(*other);
+        exp->disjunction(*term);
+    }
+    return exp;
+}
+
+/**
+ * @return a new feature diagram-like expression made of the implications
+ *          F(i+1) -> F(i) over 'nbOfFeatures' features.
+ */
+FeatureExp * makeFD(int nbOfFeatures) {
+    FeatureExp * fd = factory().getTrue();
+    for (int i = 0; i + 1 < nbOfFeatures; ++i) {
+        auto_ptr<FeatureExp> child(
+                factory().create(FstmGenerator::featureName(i + 1)));
+        auto_ptr<FeatureExp> parent(
+                factory().create(FstmGenerator::featureName(i)));
+        child->negation()->disjunction(*parent);
+        fd->conjunction(*child);
+    }
+    return fd;
+}
+
+static void BM_FeatureExpClone(benchmark::State & state) {
+    auto_ptr<FeatureExp> exp(makeFeatureExp(state.range(0)));
+    for (benchmark::State::StateIterator it = state.begin();
+            it != state.end(); ++it) {
+        auto_ptr<FeatureExp> copy(exp->clone());
+        benchmark::DoNotOptimize(copy.get());
+    }
+}
+BENCHMARK(BM_FeatureExpClone)->Arg(8)->Arg(32)->Arg(128);
+
+static void BM_FeatureExpConjunction(benchmark::State & state) {
+    auto_ptr<FeatureExp> lhs(makeFeatureExp(state.range(0)));
+    auto_ptr<FeatureExp> rhs(makeFD(state.range(0)));
+    for (benchmark::State::StateIterator it = state.begin();
+            it != state.end(); ++it) {
+        auto_ptr<FeatureExp> result(lhs->clone());
+        result->conjunction(*auto_ptr<FeatureExp>(rhs->clone()));
+        benchmark::DoNotOptimize(result.get());
+    }
+}
+BENCHMARK(BM_FeatureExpConjunction)->Arg(8)->Arg(32)->Arg(128);
+
+static void BM_FeatureExpNegation(benchmark::State & state) {
+    auto_ptr<FeatureExp> exp(makeFeatureExp(state.range(0)));
+    for (benchmark::State::StateIterator it = state.begin();
+            it != state.end(); ++it) {
+        exp->negation();
+    }
+}
+BENCHMARK(BM_FeatureExpNegation)->Arg(8)->Arg(32)->Arg(128);
+
+static void BM_IsSatisfiableWrtFD(benchmark::State & state) {
+    // Mimics Exploration::isSatisfiable
+    auto_ptr<FeatureExp> exp(makeFeatureExp(state.range(0)));
+    auto_ptr<FeatureExp> fd(makeFD(state.range(0)));
+    for (benchmark::State::StateIterator it = state.begin();
+            it != state.end(); ++it) {
+        bool sat = auto_ptr<FeatureExp>(exp->clone())->conjunction(
+                *auto_ptr<FeatureExp>(fd->clone()))->isSatisfiable();
+        benchmark::DoNotOptimize(sat);
+    }
+}
+BENCHMARK(BM_IsSatisfiableWrtFD)->Arg(8)->Arg(32)->Arg(128);
+
+/**
+ * @return 'n' distinct combined states.
+ */
+vector<CombinedState> makeCombinedStates(int n) {
+    PropertyStatePtr propertyState = ClaimPropertyState::makePropertyState(
+            ClaimState::makeState("T0_init"));
+    vector<CombinedState> states;
+    for (int i = 0; i < n; ++i) {
+        StatePtr state = FstmState::makeState(FstmGenerator::stateName(i));
+        states.push_back(CombinedState(state, propertyState));
+    }
+    return states;
+}
+
+static void BM_CombinedStateTableInsert(benchmark::State & state) {
+    vector<CombinedState> states(makeCombinedStates(state.range(0)));
+    for (benchmark::State::StateIterator it = state.begin();
+            it != state.end(); ++it) {
+        CombinedStateTable<unsigned int> table;
+        for (vector<CombinedState>::const_iterator s = states.begin();
+                s != states.end(); ++s) {
+            table[*s] |= 1;
+        }
+        benchmark::DoNotOptimize(&table);
+    }
+    state.SetItemsProcessed(state.iterations() * states.size());
+}
+BENCHMARK(BM_CombinedStateTableInsert)->Arg(1 << 10)->Arg(1 << 14);
+
+static void BM_CombinedStateTableLookup(benchmark::State & state) {
+    vector<CombinedState> states(makeCombinedStates(state.range(0)));
+    CombinedStateTable<unsigned int> table;
+    for (vector<CombinedState>::const_iterator s = states.begin();
+            s != states.end(); ++s) {
+        table[*s] |= 1;
+    }
+    for (benchmark::State::StateIterator it = state.begin();
+            it != state.end(); ++it) {
+        for (vector<CombinedState>::const_iterator s = states.begin();
+                s != states.end(); ++s) {
+            benchmark::DoNotOptimize(table.contains(*s));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * states.size());
+}
+BENCHMARK(BM_CombinedStateTableLookup)->Arg(1 << 10)->Arg(1 << 14);
+
+static void BM_StackPushPop(benchmark::State & state) {
+    const int depth = state.range(0);
+    FeatureExpPtr exp(factory().getTrue());
+    for (benchmark::State::StateIterator it = state.begin();
+            it != state.end(); ++it) {
+        Stack<FeatureExpPtr> stack;
+        for (int i = 0; i < depth; ++i) {
+            stack.push(exp);
+        }
+        while (!stack.empty()) {
+            benchmark::DoNotOptimize(stack.pop());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * depth);
+}
+BENCHMARK(BM_StackPushPop)->Arg(64)->Arg(4096);
+
+static void BM_TransitionTableExecutables(benchmark::State & state) {
+    const int nbOfStates = state.range(0);
+    stringstream json;
+    FstmGenerator generator(nbOfStates, 4 * nbOfStates, 16, 3, 0);
+    generator.generate(json);
+    JsonParser parser(json, factory());
+    TransitionTable table(parser.transitions(), parser.getNbOfTransitions());
+
+    vector<FstmStatePtr> sources;
+    for (int i = 0; i < nbOfStates; ++i) {
+        sources.push_back(FstmState::makeState(FstmGenerator::stateName(i)));
+    }
+
+    for (benchmark::State::StateIterator it = state.begin();
+            it != state.end(); ++it) {
+        for (vector<FstmStatePtr>::const_iterator s = sources.begin();
+                s != sources.end(); ++s) {
+            TransitionGeneratorPtr gen = table.executables(**s);
+            while (gen->hasNext()) {
+                benchmark::DoNotOptimize(gen->next().get());
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * nbOfStates);
+}
+BENCHMARK(BM_TransitionTableExecutables)->Arg(1 << 8)->Arg(1 << 12);
+
+/**
+ * @return 0 if the benchmarks were run, else returns 1.
+ */
+int main(int argc, char * argv[]) {
+    util::initLogging(argv[0]);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+
+    util::terminateLogging();
+    return 0;
+}
@@ -0,0 +1,195 @@
+/*
+ * sweep_main.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "bench/FstmGenerator.hpp"
+
+#include "core/checker/Checker.hpp"
+
+#include "util/logging.hpp"
+#include "util/NotPossibleException.hpp"
+
+#include <glog/logging.h>
+
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using bench::FstmGenerator;
+
+using core::checker::Checker;
+
+using std::cerr;
+using std::cout;
+using std::endl;
+using std::ofstream;
+using std::string;
+using std::stringstream;
+
+using util::NotPossibleException;
+
+/**
+ * Entry point of the scaling benchmark. Runs the Exploration (without
+ * property) and the NestedSearch (with one property) over synthetic FSTMs of
+ * increasing size, and prints one CSV line per run with the elapsed time, the
+ * peak resident set size and the number of explored states per second.
+ *
+ * Each run is made in a child process so that its peak RSS is measured
+ * independently of the previous runs.
+ *
+ * Usage: runSweep [maxStates [outDegree [features [guardSize]]]]
+ *
+ * @author mwi
+ */
+
+/** The template of the paths of the generated FSTMs. */
+const char * const FstmPathTemplate = "/tmp/pvl_sweepXXXXXX";
+
+/** The result of a run, as sent by the child process. */
+struct RunResult {
+    int result;
+    int explored;
+    double timeMs;
+};
+
+/**
+ * @return the current wall-clock time in milliseconds.
+ */
+double now() {
+    timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+}
+
+/**
+ * @effects Runs the checker on a new FSTM with the given parameters, written
+ *           to a temporary file removed afterwards.
+ * @return the result of the run, with result = -1 if the checker failed.
+ */
+RunResult runOnce(int nbOfStates, int outDegree, int nbOfFeatures,
+        int guardSize, int nbOfProperties) {
+    RunResult runResult = {-1, 0, 0};
+
+    string fstmPath(FstmPathTemplate);
+    const int fd = mkstemp(&fstmPath[0]);
+    if (fd < 0) {
+        perror("mkstemp");
+        return runResult;
+    }
+    close(fd);
+
+    ofstream out(fstmPath.c_str());
+    FstmGenerator generator(nbOfStates, nbOfStates * outDegree, nbOfFeatures,
+            guardSize, nbOfProperties);
+    generator.generate(out);
+    out.close();
+
+    try {
+        Checker checker(fstmPath);
+        const double start = now();
+        checker.run();
+        runResult.timeMs = now() - start;
+        runResult.result = checker.getResult();
+        runResult.explored = checker.getNbOfExploredStates();
+    } catch (NotPossibleException & ex) {
+        LOG(ERROR) << ex.getMessage();
+    }
+    unlink(fstmPath.c_str());
+    return runResult;
+}
+
+/**
+ * @modifies stdout
+ * @effects Runs the checker in a child process and prints the CSV line of the
+ *           run.
+ */
+void sweepPoint(int nbOfStates, int outDegree, int nbOfFeatures,
+        int guardSize, int nbOfProperties) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        perror("pipe");
+        exit(EXIT_FAILURE);
+    }
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        exit(EXIT_FAILURE);
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        RunResult runResult = runOnce(nbOfStates, outDegree, nbOfFeatures,
+                guardSize, nbOfProperties);
+        ssize_t written = write(fds[1], &runResult, sizeof(runResult));
+        close(fds[1]);
+        _exit(written == sizeof(runResult) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    close(fds[1]);
+    RunResult runResult = {-1, 0, 0};
+    if (read(fds[0], &runResult, sizeof(runResult)) != sizeof(runResult)) {
+        runResult.result = -1;
+    }
+    close(fds[0]);
+
+    int status;
+    rusage usage;
+    wait4(pid, &status, 0, &usage);
+
+    const double statesPerSec = runResult.timeMs > 0
+            ? 1000.0 * runResult.explored / runResult.timeMs : 0;
+
+    cout << nbOfStates << "," << nbOfStates * outDegree << ","
+         << nbOfFeatures << "," << guardSize << "," << nbOfProperties << ","
+         << runResult.result << "," << runResult.timeMs << ","
+         << usage.ru_maxrss << "," << runResult.explored << ","
+         << statesPerSec << endl;
+}
+
+/**
+ * @return 0 if the sweep was run, else returns 1.
+ */
+int main(int argc, const char * argv[]) {
+    if (argc > 5) {
+        cerr << "Usage: runSweep [maxStates [outDegree [features"
+             << " [guardSize]]]]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    const int maxStates = argc > 1 ? atoi(argv[1]) : 6400;
+    const int outDegree = argc > 2 ? atoi(argv[2]) : 4;
+    const int nbOfFeatures = argc > 3 ? atoi(argv[3]) : 16;
+    const int guardSize = argc > 4 ? atoi(argv[4]) : 3;
+
+    if (maxStates <= 0 || outDegree <= 0 || nbOfFeatures <= 0
+            || guardSize < 0) {
+        cerr << "Invalid parameters" << endl;
+        return EXIT_FAILURE;
+    }
+
+    util::initLogging(argv[0]);
+
+    cout << "states,transitions,features,guardSize,properties,result,timeMs,"
+         << "peakRssKB,explored,statesPerSec" << endl;
+
+    for (int nbOfProperties = 0; nbOfProperties <= 1; ++nbOfProperties) {
+        for (int nbOfStates = 100; nbOfStates <= maxStates; nbOfStates *= 2) {
+            sweepPoint(nbOfStates, outDegree, nbOfFeatures, guardSize,
+                    nbOfProperties);
+        }
+    }
+
+    util::terminateLogging();
+    return EXIT_SUCCESS;
+}
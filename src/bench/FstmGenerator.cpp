@@ -0,0 +1,143 @@
+/*
+ * FstmGenerator.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "FstmGenerator.hpp"
+
+#include "util/Assert.hpp"
+#include "util/strings.hpp"
+
+#include <json/json.h>
+
+#include <sstream>
+
+using std::ostream;
+using std::string;
+using std::stringstream;
+
+namespace bench {
+
+// constructors
+FstmGenerator::FstmGenerator(int nbOfStates, int nbOfTransitions,
+        int nbOfFeatures, int guardSize, int nbOfProperties,
+        unsigned long seed)
+    : nbOfStates(nbOfStates), nbOfTransitions(nbOfTransitions),
+      nbOfFeatures(nbOfFeatures), guardSize(guardSize),
+      nbOfProperties(nbOfProperties), random(seed) {
+    checkRep();
+}
+
+// public methods
+void FstmGenerator::generate(ostream & out) {
+    Json::Value root;
+
+    Json::Value & header = root["FSTM"];
+    header["name"] = "Synthetic";
+    header["generated"] = "FstmGenerator";
+    header["nbOfLtlProperties"] = nbOfProperties;
+    header["nbOfTransitions"] = nbOfTransitions;
+
+    Json::Value & states = root["states"];
+    for (int i = 0; i < nbOfStates; ++i) {
+        states.append(stateName(i));
+    }
+
+    Json::Value & events = root["events"];
+    for (int i = 0; i < nbOfStates; ++i) {
+        stringstream ss;
+        ss << "evt" << i;
+        events.append(ss.str());
+    }
+
+    root["ltlProperties"] = Json::Value(Json::arrayValue);
+    for (int i = 0; i < nbOfProperties; ++i) {
+        root["ltlProperties"].append(nextProperty());
+    }
+
+    // Spread the transitions evenly, keeping them grouped by source.
+    Json::Value & transitions = root["transitions"];
+    const int outDegree = nbOfTransitions / nbOfStates;
+    const int extra = nbOfTransitions % nbOfStates;
+    for (int i = 0; i < nbOfStates; ++i) {
+        const int degree = outDegree + (i < extra ? 1 : 0);
+        for (int j = 0; j < degree; ++j) {
+            Json::Value transition;
+            transition["source"] = stateName(i);
+            transition["event"] = events[nextInt(nbOfStates)];
+            transition["guard"] = "";
+            if (j == 0) {
+                transition["target"] = stateName((i + 1) % nbOfStates);
+                transition["featureExp"] = "true";
+            }
+            else {
+                transition["target"] = stateName(nextInt(nbOfStates));
+                transition["featureExp"] = nextFeatureExp();
+            }
+            transitions.append(transition);
+        }
+    }
+
+    Json::StyledStreamWriter writer;
+    writer.write(out, root);
+}
+
+string FstmGenerator::stateName(int i) {
+    stringstream ss;
+    ss << "S" << i;
+    return ss.str();
+}
+
+string FstmGenerator::featureName(int i) {
+    stringstream ss;
+    ss << "F" << i;
+    return ss.str();
+}
+
+// private methods
+int FstmGenerator::nextInt(int bound) {
+    assertTrue(bound > 0);
+
+    // Linear congruential generator (same constants as POSIX drand48).
+    random = (random * 25214903917UL + 11UL) & ((1UL << 48) - 1);
+    return static_cast<int>((random >> 17) % bound);
+}
+
+string FstmGenerator::nextFeatureExp() {
+    if (guardSize == 0) {
+        return "true";
+    }
+    stringstream ss;
+    for (int i = 0; i < guardSize; ++i) {
+        if (i > 0) {
+            ss << (nextInt(2) == 0 ? " && " : " || ");
+        }
+        if (nextInt(2) == 0) {
+            ss << "!";
+        }
+        ss << featureName(nextInt(nbOfFeatures));
+    }
+    return ss.str();
+}
+
+string FstmGenerator::nextProperty() {
+    // The property automaton refers to states with a lowercase first letter.
+    string premise = stateName(nextInt(nbOfStates));
+    string conclusion = stateName(nextInt(nbOfStates));
+    util::toLowercaseFirst(premise);
+    util::toLowercaseFirst(conclusion);
+    return "[] (" + premise + " -> <> " + conclusion + ")";
+}
+
+void FstmGenerator::checkRep() const {
+    if (doCheckRep) {
+        assertTrue(nbOfStates > 0);
+        assertTrue(nbOfTransitions >= nbOfStates);
+        assertTrue(nbOfFeatures > 0);
+        assertTrue(guardSize >= 0);
+        assertTrue(nbOfProperties >= 0);
+    }
+}
+
+} // namespace bench
@@ -0,0 +1,112 @@
+/*
+ * FstmGenerator.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef BENCH_FSTMGENERATOR_HPP
+#define BENCH_FSTMGENERATOR_HPP
+
+#include "util/Uncopyable.hpp"
+
+#include <ostream>
+#include <string>
+
+namespace bench {
+
+/**
+ * A FstmGenerator produces synthetic FSTMs, in the JSON format read by
+ * core::fts::fstm::JsonParser, for benchmarking purposes.
+ *
+ * The generated FSTMs are deadlock-free: the states S0, ..., Sn-1 form a ring
+ * of transitions labelled with the feature expression true, and the remaining
+ * transitions go to random targets and are labelled with random feature
+ * expressions over the features F0, ..., Fk-1. The transitions are grouped by
+ * source state. Each LTL property has the form [] (sa -> <> sb).
+ *
+ * The generation is deterministic for a given seed.
+ *
+ * Specification fields:
+ * - nbOfStates      : int        // The number of states.
+ * - nbOfTransitions : int        // The number of transitions.
+ * - nbOfFeatures    : int        // The number of features.
+ * - guardSize       : int        // The number of literals per feature
+ *                                // expression (0 means true).
+ * - nbOfProperties  : int        // The number of LTL properties.
+ * - seed            : int        // The seed of the random generator.
+ *
+ * @author mwi
+ */
+class FstmGenerator : private util::Uncopyable {
+
+private:
+    const int nbOfStates;
+    const int nbOfTransitions;
+    const int nbOfFeatures;
+    const int guardSize;
+    const int nbOfProperties;
+    unsigned long random;
+
+    /*
+     * Representation Invariant:
+     *   I(c) = c.nbOfStates > 0 && c.nbOfTransitions >= c.nbOfStates &&
+     *          c.nbOfFeatures > 0 && c.guardSize >= 0 &&
+     *          c.nbOfProperties >= 0
+     */
+
+public:
+    /**
+     * @requires nbOfStates > 0 && nbOfTransitions >= nbOfStates &&
+     *            nbOfFeatures > 0 && guardSize >= 0 && nbOfProperties >= 0
+     * @effects Makes this be a new generator with the given parameters.
+     */
+    FstmGenerator(int nbOfStates, int nbOfTransitions, int nbOfFeatures,
+            int guardSize, int nbOfProperties, unsigned long seed = 1);
+
+    // The default destructor is fine.
+
+    /**
+     * @modifies out, this
+     * @effects Writes on 'out' a new FSTM in JSON.
+     */
+    void generate(std::ostream & out);
+
+    /**
+     * @return the name of the i-th state.
+     */
+    static std::string stateName(int i);
+
+    /**
+     * @return the name of the i-th feature.
+     */
+    static std::string featureName(int i);
+
+private:
+    /**
+     * @requires bound > 0
+     * @modifies this
+     * @return a pseudo-random integer in [0, bound).
+     */
+    int nextInt(int bound);
+
+    /**
+     * @modifies this
+     * @return a new random feature expression with guardSize literals.
+     */
+    std::string nextFeatureExp();
+
+    /**
+     * @modifies this
+     * @return a new random LTL property.
+     */
+    std::string nextProperty();
+
+    /**
+     * @effects Asserts the rep invariant holds for this.
+     */
+    void checkRep() const;
+};
+
+} // namespace bench
+
+#endif /* BENCH_FSTMGENERATOR_HPP */
@@ -6,11 +6,13 @@
 
 #include "Context.hpp"
 
-#include "Environment.hpp"
 #include "core/features/BoolFeatureExp.hpp"
 #include "core/features/BoolFeatureExpFactory.hpp"
 #include "core/features/FeatureExp.hpp"
+#include "core/fts/fstm/CompiledFstmParser.hpp"
 #include "core/fts/fstm/FSTM.hpp"
+#include "core/fts/fstm/FstmCompiler.hpp"
+#include "core/fts/fstm/StreamingJsonParser.hpp"
 #include "math/BoolFctCUDDFactory.hpp"
 #include "util/Assert.hpp"
 #include "util/NotPossibleException.hpp"
@@ -20,10 +22,15 @@ using core::features::BoolFeatureExpFactory;
 using core::features::BoolFeatureExpFactoryPtr;
 using core::features::FeatureExpPtr;
 using core::fts::FTSPtr;
+using core::fts::fstm::CompiledFstmParser;
 using core::fts::fstm::FSTM;
+using core::fts::fstm::FstmCompiler;
+using core::fts::fstm::StreamingJsonParser;
 using math::BoolFctCUDDFactory;
 using math::BoolFctFactoryPtr;
+using math::CuddOptions;
 using std::istream;
+using std::ostream;
 using std::string;
 using util::NotPossibleException;
 
@@ -34,7 +41,12 @@ Context::Context()
         : boolFctFactory(new BoolFctCUDDFactory()),
           boolFeatureExpFactory(new BoolFeatureExpFactory(boolFctFactory)) {
 
-    Environment::checkVariables();
+    checkRep();
+}
+
+Context::Context(const CuddOptions & cuddOptions)
+        : boolFctFactory(new BoolFctCUDDFactory(cuddOptions)),
+          boolFeatureExpFactory(new BoolFeatureExpFactory(boolFctFactory)) {
 
     checkRep();
 }
@@ -52,6 +64,16 @@ FTSPtr Context::createFSTM(istream & jsonFstm) const {
     return FTSPtr(new FSTM(jsonFstm, *getBoolFeatureExpFactory()));
 }
 
+FTSPtr Context::loadCompiledFSTM(const string & path) const {
+    return FTSPtr(new FSTM(CompiledFstmParser(path,
+            *getBoolFeatureExpFactory())));
+}
+
+void Context::compileFSTM(istream & jsonFstm, ostream & compiledFstm) const {
+    StreamingJsonParser parser(jsonFstm, *getBoolFeatureExpFactory());
+    FstmCompiler(parser).compile(compiledFstm);
+}
+
 FeatureExpPtr Context::createEmptyFD() const {
     return BoolFeatureExpPtr(getBoolFeatureExpFactory()->getTrue());
 }
@@ -9,8 +9,12 @@
 
 #include "core/fts/forwards.hpp"
 #include "core/features/forwards.hpp"
+#include "math/CuddOptions.hpp"
 #include "math/forwards.hpp"
 
+#include <iosfwd>
+#include <string>
+
 namespace config {
 
 /**
@@ -38,6 +42,16 @@ public:
      */
     Context();
 
+    /**
+     * @modifies the CUDD manager shared by all the BoolFctCUDDs
+     * @effects Makes this be a new context with a default configuration,
+     *           except for the options 'cuddOptions' of the CUDD manager.
+     *           The CUDD manager is shared by all the contexts, and configured
+     *           by the last context created with some options.
+     * @throw NotPossibleException if the configuration is invalid.
+     */
+    explicit Context(const math::CuddOptions & cuddOptions);
+
     // The default destructor is fine.
 
     // The default copy constructor is fine.
@@ -61,6 +75,23 @@ public:
      */
     core::fts::FTSPtr createFSTM(std::istream & jsonFstm) const;
 
+    /**
+     * @return a new FTS for the FSTM compiled in the file at 'path'.
+     * @throws NotPossibleException iff the file at 'path' cannot be opened
+     *          or does not contain a valid compiled FSTM.
+     */
+    core::fts::FTSPtr loadCompiledFSTM(const std::string & path) const;
+
+    /**
+     * @requires jsonFstm is a valid FSTM in valid JSON
+     * @modifies compiledFstm
+     * @effects Writes on 'compiledFstm' the FSTM represented by 'jsonFstm'
+     *           in the binary format read by loadCompiledFSTM.
+     * @throws JsonException iff 'jsonFstm' contains some syntax error.
+     */
+    void compileFSTM(std::istream & jsonFstm, std::ostream & compiledFstm)
+        const;
+
     /**
      * @return a new feature expression representing an empty feature diagram
      *          (FD).
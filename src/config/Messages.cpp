@@ -25,6 +25,13 @@ string Messages::invalidArg(const string & arg) {
     return oss.str();
 }
 
+string Messages::invalidArgValue(const string & arg, const string & value) {
+    ostringstream oss;
+    oss << "The value '" << value << "' of the argument '" << arg
+        << "' is invalid.";
+    return oss.str();
+}
+
 string Messages::envVarNotSet(const string & envVar) {
     assertTrue(envVar.length() > 0);
 
@@ -52,4 +59,18 @@ string Messages::invalidJson(const string & jsonFilePath) {
     return oss.str();
 }
 
+string Messages::errorWritingFile(const string & filePath) {
+    ostringstream oss;
+    oss << "Cannot write file '" << filePath << "'.";
+    return oss.str();
+}
+
+string Messages::invalidCompiledFstm(const string & filePath) {
+    assertTrue(filePath.length() > 0);
+
+    ostringstream oss;
+    oss << "The file '" << filePath << "' is not a valid compiled FSTM.";
+    return oss.str();
+}
+
 } // namespace config
@@ -37,6 +37,13 @@ public:
      */
     static std::string invalidArg(const std::string & arg);
 
+    /**
+     * @return a message indicating the value 'value' of the argument 'arg' is
+     *          invalid.
+     */
+    static std::string invalidArgValue(const std::string & arg,
+            const std::string & value);
+
     /**
      * @requires envVar.length > 0
      * @return a message indicating the environment variable 'envVar' is not
@@ -60,6 +67,18 @@ public:
      *          some syntax error.
      */
     static std::string invalidJson(const std::string & jsonFilePath);
+
+    /**
+     * @return a message indicating the file at 'filePath' cannot be written.
+     */
+    static std::string errorWritingFile(const std::string & filePath);
+
+    /**
+     * @requires filePath.length > 0
+     * @return a message indicating the file at 'filePath' is not a valid
+     *          compiled FSTM.
+     */
+    static std::string invalidCompiledFstm(const std::string & filePath);
 };
 
 } // namespace config
@@ -9,13 +9,19 @@
 #include "config/Messages.hpp"
 #include "core/checker/Exploration.hpp"
 #include "core/checker/NestedSearch.hpp"
-
-#include "math/minimize/Minimizer.hpp"
+#include "core/checker/ProductSearch.hpp"
+#include "core/checker/SafetySearch.hpp"
+#include "core/fts/fstm/ClaimPropertyAutomaton.hpp"
+#include "core/fts/fstm/CompiledFstmParser.hpp"
+#include "core/fts/fstm/FSTM.hpp"
+#include "core/fts/fstm/ProductGraph.hpp"
 
 #include "util/Assert.hpp"
 #include "util/NotPossibleException.hpp"
 #include "util/JsonException.hpp"
 
+#include <sys/resource.h>
+
 #include <fstream>
 
 using config::Context;
@@ -23,19 +29,28 @@ using config::Messages;
 
 using core::checker::Exploration;
 using core::checker::NestedSearch;
+using core::checker::ProductSearch;
+using core::checker::SafetySearch;
 
 using core::fts::FTS;
+using core::fts::fstm::ClaimPropertyAutomaton;
+using core::fts::fstm::CompiledFstmParser;
+using core::fts::fstm::FSTM;
+using core::fts::fstm::ProductGraph;
+using core::fts::fstm::ProductGraphPtr;
 
 using core::features::BoolFeatureExpFactory;
 using core::features::SimpleFeatureExp;
 using core::features::FeatureExp;
 
-using math::minimize::Minimizer;
+using math::BoolFctStats;
+using math::CuddOptions;
 
 using std::string;
 using std::ifstream;
 
 using std::auto_ptr;
+using std::tr1::dynamic_pointer_cast;
 using std::tr1::shared_ptr;
 
 using util::Generator;
@@ -47,7 +62,9 @@ namespace core {
 namespace checker {
 
 // constructors
-Checker::Checker(const string & fstmFilePath) : ctx(), state(idle) {
+Checker::Checker(const string & fstmFilePath, bool productGraph,
+        const CuddOptions & cuddOptions)
+        : ctx(cuddOptions), productGraph(productGraph), state(idle), explored(0) {
     if (fstmFilePath.length() <= 0) {
         throw NotPossibleException(Messages::emptyFilePath());
     }
@@ -55,16 +72,22 @@ Checker::Checker(const string & fstmFilePath) : ctx(), state(idle) {
     factory = ctx.getBoolFeatureExpFactory();
     fd = ctx.createEmptyFD();
 
-    ifstream fstmStream(fstmFilePath.c_str());
-
-    if (!fstmStream.is_open()) {
-        throw NotPossibleException(Messages::errorOpeningFile(fstmFilePath));
+    if (CompiledFstmParser::isCompiled(fstmFilePath)) {
+        fts = ctx.loadCompiledFSTM(fstmFilePath);
     }
+    else {
+        ifstream fstmStream(fstmFilePath.c_str());
 
-    try {
-        fts = ctx.createFSTM(fstmStream);
-    } catch (JsonException & jsonEx) {
-        throw NotPossibleException(Messages::invalidJson(fstmFilePath));
+        if (!fstmStream.is_open()) {
+            throw NotPossibleException(
+                    Messages::errorOpeningFile(fstmFilePath));
+        }
+
+        try {
+            fts = ctx.createFSTM(fstmStream);
+        } catch (JsonException & jsonEx) {
+            throw NotPossibleException(Messages::invalidJson(fstmFilePath));
+        }
     }
 
     checkRep();
@@ -73,22 +96,28 @@ Checker::Checker(const string & fstmFilePath) : ctx(), state(idle) {
 // public methods
 void Checker::run() {
     state = Running;
-    if (fts->hasProperty()) {
+    const shared_ptr<FSTM> fstm = dynamic_pointer_cast<FSTM>(fts);
+    if (fts->hasProperty() && productGraph && fstm) {
+        ProductGraphPtr graph(new ProductGraph(fstm->getTransitionTable(),
+                dynamic_pointer_cast<ClaimPropertyAutomaton>(
+                        fstm->getPropertyAutomaton())));
+        ProductSearch productSearch(fd, graph, factory);
+        runSearch(productSearch);
+    }
+    else if (fts->hasProperty() && fts->getPropertyAutomaton()->isSafety()) {
+        SafetySearch safetySearch(fd, fts, factory);
+        runSearch(safetySearch);
+    }
+    else if (fts->hasProperty()) {
         NestedSearch nestedSearch(fd, fts, factory);
-        nestedSearch.run();
-        violatedProducts = nestedSearch.getBadProducts();
-        if (violatedProducts->isSatisfiable()) {
-            result = Violated;
-            counterExamples = nestedSearch.getCounterExamples();
-        }
-        else {
-            result = Satisfied;
-        }
+        runSearch(nestedSearch);
     }
     else {
         Exploration exploration(fd, fts, factory);
         exploration.run();
         violatedProducts = exploration.getBadProducts();
+        explored = exploration.getNbOfExploredStates();
+        memory.tableBytes = exploration.getTableBytes();
         if (violatedProducts->isSatisfiable()) {
             result = Error;
             counterExamples = exploration.getCounterExamples();
@@ -97,6 +126,18 @@ void Checker::run() {
             result = Satisfied;
         }
     }
+    stats = factory->getStats();
+    memory.bddBytes = stats.memoryInUse;
+    if (counterExamples) {
+        auto_ptr<Generator<CounterExample> > gen = counterExamples->elements();
+        while (gen->hasNext()) {
+            memory.counterExampleBytes += gen->next().bytes();
+        }
+    }
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        memory.peakRss = usage.ru_maxrss;
+    }
     state = Terminated;
 
     checkRep();
@@ -113,8 +154,7 @@ Checker::Result Checker::getResult() const {
 
 string Checker::getViolatedProducts() const {
     assertTrue(state == Terminated);
-    Minimizer minimizer;
-    return minimizer.minimize(violatedProducts->toString());
+    return violatedProducts->toMinimizedString();
 }
 
 auto_ptr<Generator<CounterExample> > Checker::getCounterExamples() const {
@@ -123,7 +163,40 @@ auto_ptr<Generator<CounterExample> > Checker::getCounterExamples() const {
     return counterExamples->elements();
 }
 
+int Checker::getNbOfExploredStates() const {
+    assertTrue(state == Terminated);
+
+    return explored;
+}
+
+BoolFctStats Checker::getBddStats() const {
+    assertTrue(state == Terminated);
+
+    return stats;
+}
+
+MemoryStats Checker::getMemoryStats() const {
+    assertTrue(state == Terminated);
+
+    return memory;
+}
+
 // private methods
+template<typename Search>
+void Checker::runSearch(Search & search) {
+    search.run();
+    violatedProducts = search.getBadProducts();
+    explored = search.getNbOfExploredStates();
+    memory.tableBytes = search.getTableBytes();
+    if (violatedProducts->isSatisfiable()) {
+        result = Violated;
+        counterExamples = search.getCounterExamples();
+    }
+    else {
+        result = Satisfied;
+    }
+}
+
 void Checker::checkRep() const {
     if (doCheckRep) {
         if (violatedProducts) {
@@ -8,6 +8,7 @@
 #define	CHECKER_HPP
 
 #include "core/checker/CounterExample.hpp"
+#include "core/checker/MemoryStats.hpp"
 
 #include "config/Context.hpp"
 
@@ -17,6 +18,9 @@
 #include "core/features/SimpleFeatureExp.hpp"
 #include "core/features/BoolFeatureExpFactory.hpp"
 
+#include "math/BoolFctStats.hpp"
+#include "math/CuddOptions.hpp"
+
 #include "util/Uncopyable.hpp"
 #include "util/List.hpp"
 #include "util/Generator.hpp"
@@ -34,14 +38,20 @@ namespace checker {
  *
  * Currently, a checker only accept an json FSTM model file path as input.
  * If a property is specified within that model, the checker runs a nested
- * depth-first search algorithm in order to verify it. In that case, the model
- * should not contain any deadlock.
+ * depth-first search algorithm in order to verify it, or a single depth-first
+ * search if the property is a safety property. In that case, the model should
+ * not contain any deadlock.
  * If no property is specified within the model, the Checker runs an exploration
  * algorithm in order to verify the absence of deadlock.
  *
  * Specification fields:
- * - state  : InternalState            // The current state of the checker.
- * - result : Result                   // The result of the model checking.
+ * - state    : InternalState          // The current state of the checker.
+ * - result   : Result                 // The result of the model checking.
+ * - explored : int                    // The number of explored states.
+ * - stats    : BoolFctStats           // The BDD statistics at the end of the
+ *                                     // model checking.
+ * - memory   : MemoryStats            // The memory used by the model
+ *                                     // checking.
  *
  * @author bdawagne
  * @author mwi
@@ -81,10 +91,14 @@ private:
     std::tr1::shared_ptr<core::features::BoolFeatureExpFactory> factory;
     std::tr1::shared_ptr<core::features::FeatureExp> fd;
     std::tr1::shared_ptr<core::fts::FTS> fts;
+    bool productGraph;
     InternalState state;
     Result result;
     std::tr1::shared_ptr<core::features::FeatureExp> violatedProducts;
     std::tr1::shared_ptr<util::List<CounterExample> > counterExamples;
+    int explored;
+    math::BoolFctStats stats;
+    MemoryStats memory;
 
     /**
      * Representation invariant:
@@ -100,12 +114,18 @@ private:
 
 public:
     /**
-     * @effects Makes this.state = idle
+     * @effects Makes this.state = idle. If 'productGraph' is true and the
+     *           model has a property, the property is verified on the
+     *           precomputed product of the model and of the property (see
+     *           ProductSearch), in which case deadlocks are not detected.
+     *           The CUDD manager is configured with the options
+     *           'cuddOptions'.
      * @throws NotPossibleException iff 'fstmFilePath' is an invalid file path
-     *          or the file at 'fstmFilePath' does not contain  some valid JSON
-     *          code.
+     *          or the file at 'fstmFilePath' contains neither some valid JSON
+     *          code nor a valid compiled FSTM.
      */
-    Checker(const std::string & fstmFilePath);
+    Checker(const std::string & fstmFilePath, bool productGraph = false,
+            const math::CuddOptions & cuddOptions = math::CuddOptions());
 
     /**
      * @modifies this
@@ -139,7 +159,35 @@ public:
     std::auto_ptr<util::Generator<CounterExample> > getCounterExamples()
         const;
 
+    /**
+     * @requires this.state = Terminated
+     * @return this.explored
+     */
+    int getNbOfExploredStates() const;
+
+    /**
+     * @requires this.state = Terminated
+     * @return this.stats
+     */
+    math::BoolFctStats getBddStats() const;
+
+    /**
+     * @requires this.state = Terminated
+     * @return this.memory
+     */
+    MemoryStats getMemoryStats() const;
+
 private:
+    /**
+     * @requires this.state = Running && fts has a property
+     * @modifies this
+     * @effects Verifies the property of fts with the search algorithm
+     *           'Search', which is either NestedSearch, SafetySearch or
+     *           ProductSearch.
+     */
+    template<typename Search>
+    void runSearch(Search & search);
+
     /**
      * @effects assert the representation invariant holds for this
      */
@@ -16,13 +16,19 @@ using std::string;
 namespace core {
 namespace checker {
 
-CombinedState::CombinedState() {
+CombinedState::CombinedState() : event(-1) {
     checkRep();
 }
 
 CombinedState::CombinedState(const StatePtr state,
         const PropertyStatePtr propertyState) :
-state(state), propertyState(propertyState) {
+state(state), propertyState(propertyState), event(-1) {
+    checkRep();
+}
+
+CombinedState::CombinedState(const StatePtr state, int event,
+        const PropertyStatePtr propertyState) :
+state(state), propertyState(propertyState), event(event) {
     checkRep();
 }
 
@@ -32,19 +38,21 @@ string CombinedState::toString() const {
 
 bool CombinedState::equals(const CombinedState & other) const {
     return state->equals(*other.state)
-            && propertyState->equals(*other.propertyState);
+            && propertyState->equals(*other.propertyState)
+            && event == other.event;
 }
 
 unsigned int CombinedState::hashCode() const {
     unsigned int hashcode = 3;
     hashcode += 5 * state->hashCode();
     hashcode += 7 * propertyState->hashCode();
+    hashcode += 11 * event;
     return hashcode;
 }
 
 void CombinedState::checkRep() const {
     if (doCheckRep) {
-        // Nothing here
+        assertTrue(event >= -1);
     }
 }
     
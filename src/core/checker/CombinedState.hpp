@@ -31,10 +31,11 @@ class CombinedState : public util::Hashable<CombinedState> {
 private:
     core::fts::StatePtr state;
     core::fts::PropertyStatePtr propertyState;
+    int event;
     
     /*
      * Invariant Representation :
-     *      I(c) = true;
+     *      I(c) = c.event >= -1;
      */
     
 public:
@@ -49,6 +50,16 @@ public:
      */
     CombinedState(const core::fts::StatePtr state,
             const core::fts::PropertyStatePtr propertyState);
+
+    /**
+     * @effects Make this be the CombinedState composed of 'state' entered
+     *          with the event of id 'event', or with no event if 'event' is
+     *          -1, and of 'propertyState'. Two combined states which differ
+     *          only by their event are distinct, since the guards of a never
+     *          claim can read the event.
+     */
+    CombinedState(const core::fts::StatePtr state, int event,
+            const core::fts::PropertyStatePtr propertyState);
     
     // Default destructor is fine
     
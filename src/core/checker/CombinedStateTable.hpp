@@ -72,6 +72,17 @@ public:
      */
     V & operator[](const CombinedState & key);
 
+    /**
+     * @return the number of keys in this.
+     */
+    unsigned long size() const;
+
+    /**
+     * @return an estimation of the number of bytes allocated by this,
+     *          excluding the memory owned by the keys and the values.
+     */
+    unsigned long bytes() const;
+
     /**
      * @modifies this
      * @effects Remove the value at 'key' if such exits.
@@ -101,6 +112,19 @@ V & CombinedStateTable<V>::operator[](const CombinedState & key) {
     return result;
 }
 
+template<typename V>
+unsigned long CombinedStateTable<V>::size() const {
+    return map.size();
+}
+
+template<typename V>
+unsigned long CombinedStateTable<V>::bytes() const {
+    // Each node holds a key, a value and a link to the next node.
+    return map.size() * (sizeof(typename std::tr1::unordered_map<CombinedState, V,
+            Hash, Pred>::value_type) + sizeof(void *))
+        + map.bucket_count() * sizeof(void *);
+}
+
 template<typename V>
 void CombinedStateTable<V>::remove(const CombinedState & key) {
     map.erase(key);
@@ -50,12 +50,17 @@ CounterExample::CounterExample(const FeatureExp & featureExp,
 // public methods
 string CounterExample::getFeatureExp() const {
     if (minimizedFeatureExp.length() <= 0) {
-        Minimizer minimizer;
-        minimizedFeatureExp = minimizer.minimize(featureExp->toString());
+        minimizedFeatureExp = featureExp->toMinimizedString();
     }
     return minimizedFeatureExp;
 }
 
+void CounterExample::minimize(const Minimizer & minimizer) const {
+    if (minimizedFeatureExp.length() <= 0) {
+        minimizedFeatureExp = featureExp->toMinimizedString(minimizer);
+    }
+}
+
 auto_ptr<Generator<StatePtr> > CounterExample::states() const {
     return path.elements();
 }
@@ -70,6 +75,12 @@ string CounterExample::toString() const {
     return oss.str();
 }
 
+unsigned long CounterExample::bytes() const {
+    // Each node of the path holds a state pointer and two links.
+    return sizeof(*this) + minimizedFeatureExp.capacity()
+        + path.count() * (sizeof(StatePtr) + 2 * sizeof(void *));
+}
+
 // private methods
 void CounterExample::checkRep() const {
     if (doCheckRep) {
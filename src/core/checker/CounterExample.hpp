@@ -16,6 +16,12 @@
 #include <memory>
 #include <tr1/memory>
 
+namespace math {
+namespace minimize {
+class Minimizer;
+}
+}
+
 namespace core {
 namespace checker {
 
@@ -58,6 +64,15 @@ public:
      */
     std::string getFeatureExp() const;
 
+    /**
+     * @modifies this, minimizer
+     * @effects Minimizes the feature expression of this with 'minimizer',
+     *           unless it has already been minimized. Counter examples
+     *           sharing feature expressions are best minimized by the same
+     *           minimizer.
+     */
+    void minimize(const math::minimize::Minimizer & minimizer) const;
+
     /**
      * @return the path in which the products are shown to exhibit errors.
      */
@@ -68,6 +83,13 @@ public:
      */
     std::string toString() const;
 
+    /**
+     * @return an estimation of the number of bytes allocated by this,
+     *          excluding the memory owned by the states and the feature
+     *          expression.
+     */
+    unsigned long bytes() const;
+
 private:
     /**
      * @effect Assert the invariant representation holds for this.
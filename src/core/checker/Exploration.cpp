@@ -45,7 +45,8 @@ Exploration::Exploration(
         shared_ptr<BoolFeatureExpFactory> expFactory) :
 
         fd(fd), fts(fts), expFactory(expFactory),
-        counterExamples(new List<CounterExample>()), algorithmState(Ready) {
+        counterExamples(new List<CounterExample>()), algorithmState(Ready),
+        iterations(0), explored(0) {
 
     checkRep();
 }
@@ -65,6 +66,7 @@ void Exploration::run() {
     LOG(INFO) << "CPU time used: "
               << 1000.0 * (end - start) / CLOCKS_PER_SEC
               << " ms\n";
+    LOG(INFO) << "BDD statistics: " << expFactory->getStats().toString();
 
     checkRep();
 }
@@ -81,6 +83,18 @@ shared_ptr<List<CounterExample> > Exploration::getCounterExamples() const {
     return counterExamples;
 }
 
+int Exploration::getNbOfExploredStates() const {
+    assertTrue(algorithmState == Finished);
+
+    return explored;
+}
+
+unsigned long Exploration::getTableBytes() const {
+    assertTrue(algorithmState == Finished);
+
+    return table.bytes();
+}
+
 // private methods
 bool Exploration::isSatisfiable(const FeatureExp & features) const {
     return auto_ptr<FeatureExp>(features.clone())->conjunction(
@@ -135,11 +149,13 @@ void Exploration::startExploration() {
     checkForDeadlock();
 
     int depth = 0;      // The current depth of the exploration.
-    int explored = 1;   // The number of explored states.
+    explored = 1;
     int reexplored = 0; // The number of re-explored states.
 
     while(exploration) {
 
+        sampleStats();
+
         DVLOG(2) << "New iteration";
 
         if (deadlockFound) {
@@ -321,6 +337,13 @@ void Exploration::startExploration() {
 //    return tmp->isSatisfiable();
 //}
 
+void Exploration::sampleStats() {
+    if (++iterations % STATS_SAMPLING_PERIOD == 0) {
+        LOG(INFO) << "Iteration " << iterations << ", BDD statistics: "
+                  << expFactory->getStats().toString();
+    }
+}
+
 void Exploration::checkRep() const {
     if (doCheckRep) {
         // Nothing here
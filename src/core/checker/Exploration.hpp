@@ -93,11 +93,20 @@ private:
     /** The state is in the current path */
     static const unsigned int IN_PATH =        1 << 1;
 
+    /** Number of iterations between two samples of the BDD statistics */
+    static const unsigned long STATS_SAMPLING_PERIOD =  1 << 16;
+
     /* Global variables */
 
     /** Current state of the algorithm */
     AlgorithmState algorithmState;
 
+    /** Number of iterations of the search loops so far */
+    unsigned long iterations;
+
+    /** Number of explored states */
+    int explored;
+
     /** Valid products expression, i.e. the conjunction of the feature
      *  diagram and of the negation of the bad products expression.
      */
@@ -158,6 +167,19 @@ public:
      */
     std::tr1::shared_ptr<util::List<CounterExample> > getCounterExamples() const;
 
+    /**
+     * @requires this has finished
+     * @return The number of states explored by this.
+     */
+    int getNbOfExploredStates() const;
+
+    /**
+     * @requires this has finished
+     * @return An estimation of the number of bytes allocated by the table of
+     *         the visited states.
+     */
+    unsigned long getTableBytes() const;
+
 private:
     /**
      * @return true iff 'features' is satisfiable wrt the valid products, i.e.
@@ -196,6 +218,13 @@ private:
 
 //    bool isSatisfiableWrtFD(const core::features::FeatureExpPtr & fd, const core::features::FeatureExpPtr & featureExp);
 
+    /**
+     * @modifies this
+     * @effects Counts one more iteration and, every STATS_SAMPLING_PERIOD
+     *          iterations, logs a sample of the BDD statistics.
+     */
+    void sampleStats();
+
     /**
      * @effects Asserts the invariant representation holds for this.
      */
@@ -0,0 +1,33 @@
+/*
+ * MemoryStats.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "MemoryStats.hpp"
+
+#include <sstream>
+
+using std::string;
+using std::stringstream;
+
+namespace core {
+namespace checker {
+
+// constructors
+MemoryStats::MemoryStats()
+    : peakRss(0), tableBytes(0), bddBytes(0), counterExampleBytes(0) {
+}
+
+// public methods
+string MemoryStats::toString() const {
+    stringstream ss;
+    ss << "peak RSS: " << peakRss << " KB; "
+       << "table: " << tableBytes / 1024 << " KB; "
+       << "BDD: " << bddBytes / 1024 << " KB; "
+       << "counter examples: " << counterExampleBytes / 1024 << " KB";
+    return ss.str();
+}
+
+} // namespace checker
+} // namespace core
@@ -0,0 +1,47 @@
+/*
+ * MemoryStats.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef CORE_CHECKER_MEMORYSTATS_HPP
+#define CORE_CHECKER_MEMORYSTATS_HPP
+
+#include <string>
+
+namespace core {
+namespace checker {
+
+/**
+ * MemoryStats is a breakdown of the memory used by a model checking run.
+ *
+ * Specification fields:
+ * - peakRss             : long            // peak resident set size (KB)
+ * - tableBytes          : unsigned long   // bytes of the visited states table
+ * - bddBytes            : unsigned long   // bytes allocated by the BDD engine
+ * - counterExampleBytes : unsigned long   // bytes of the counter examples
+ *
+ * @author mwi
+ */
+struct MemoryStats {
+
+    long peakRss;
+    unsigned long tableBytes;
+    unsigned long bddBytes;
+    unsigned long counterExampleBytes;
+
+    /**
+     * @effects Makes this be a breakdown with all fields set to 0.
+     */
+    MemoryStats();
+
+    /**
+     * @return a single-line string representation of this.
+     */
+    std::string toString() const;
+};
+
+} // namespace checker
+} // namespace core
+
+#endif /* CORE_CHECKER_MEMORYSTATS_HPP */
@@ -16,6 +16,7 @@ using core::features::BoolFeatureExpFactory;
 using core::features::FeatureExp;
 
 using core::fts::FTS;
+using core::fts::PropertyAutomaton;
 using core::fts::PropertyStatePtr;
 using core::fts::PropertyTransitionPtr;
 using core::fts::StatePtr;
@@ -40,7 +41,9 @@ NestedSearch::NestedSearch(
         shared_ptr<BoolFeatureExpFactory> expFactory) :
 
         fd(fd), fts(fts), expFactory(expFactory),
-        counterExamples(new List<CounterExample>()), algorithmState(Ready) {
+        counterExamples(new List<CounterExample>()), algorithmState(Ready),
+        iterations(0), explored(0),
+        innerSearchComponent(PropertyAutomaton::NO_COMPONENT) {
 
     assertTrue(fts->hasProperty());
 
@@ -64,6 +67,7 @@ void NestedSearch::run() {
     LOG(INFO) << "CPU time used: "
               << 1000.0 * (end - start) / CLOCKS_PER_SEC
               << " ms\n";
+    LOG(INFO) << "BDD statistics: " << expFactory->getStats().toString();
 
     checkRep();
 }
@@ -80,6 +84,18 @@ shared_ptr<List<CounterExample> > NestedSearch::getCounterExamples() const {
     return counterExamples;
 }
 
+int NestedSearch::getNbOfExploredStates() const {
+    assertTrue(algorithmState == Finished);
+
+    return explored;
+}
+
+unsigned long NestedSearch::getTableBytes() const {
+    assertTrue(algorithmState == Finished);
+
+    return table.bytes();
+}
+
 // private methods
 bool NestedSearch::isSatisfiable(const shared_ptr<FeatureExp> & features) const {
     return auto_ptr<FeatureExp>(features->clone())->conjunction(
@@ -210,11 +226,14 @@ void NestedSearch::startOuterSearch() {
     tableValue = &table[combinedState];
     tableValue->flags |= VISITED_IN_OUTER | IN_OUTER_PATH;
     tableValue->outerFeatures = shared_ptr<FeatureExp>(currentFeatures->clone());
+    explored = 1;
 
     DVLOG(1) << "Starting outer search";
 
     while (outerSearch) {
 
+        sampleStats();
+
         DVLOG(2) << "New iteration";
 
         if (errorFound) {
@@ -233,7 +252,7 @@ void NestedSearch::startOuterSearch() {
                 }
                 else {
                     DVLOG(3) << "Current state has no outgoing transition left";
-                    if (propertyState->isAccepting()) {
+                    if (canCloseCycle()) {
                         DVLOG(3) << "Current state is an accepting state";
                         startInnerSearch();
                     }
@@ -249,6 +268,7 @@ void NestedSearch::startOuterSearch() {
         }
         else if (propertyAutomaton->hasNextTransition()) {
             DVLOG(3) << "Taking next transition";
+            const bool fromAccepting = propertyState->isAccepting();
             propertyTransition = propertyAutomaton->nextTransition();
             applyProperty();
             apply();
@@ -271,7 +291,19 @@ void NestedSearch::startOuterSearch() {
                 tableValue = &table[combinedState];
                 if (tableValue->flags & VISITED_IN_OUTER) {
                     DVLOG(3) << "Next state has already been visited";
-                    if (tableValue->flags & IN_OUTER_PATH) {
+                    if ((tableValue->flags & IN_OUTER_PATH)
+                            && (fromAccepting || propertyState->isAccepting())) {
+                        /* The transition closes a cycle of the current path
+                         * through an accepting state, for the next features,
+                         * since the features only decrease along a path. */
+                        DVLOG(3) << "An accepting cycle has been closed";
+                        DVLOG(1) << "Adding " << nextFeatures->toString() << " to bad products";
+                        addToBadProducts();
+                        DVLOG(3) << "Reverting";
+                        revertAll();
+                        errorFound = true;
+                    }
+                    else if (tableValue->flags & IN_OUTER_PATH) {
                         DVLOG(3) << "Next state is in the current path";
                         DVLOG(3) << "Reverting";
                         revertAll();
@@ -301,6 +333,7 @@ void NestedSearch::startOuterSearch() {
                 else {
                     tableValue->outerFeatures = shared_ptr<FeatureExp>(nextFeatures->clone());
                     tableValue->flags |= VISITED_IN_OUTER;
+                    ++explored;
                     found = findNextTransition(nextFeatures, nextTransition, nextNextFeatures);
                     if (found) {
                         push(nextFeatures, nextTransition, nextNextFeatures);
@@ -319,7 +352,7 @@ void NestedSearch::startOuterSearch() {
             }
             else {
                 DVLOG(3) << "Current state has no outgoing transition left";
-                if (propertyState->isAccepting()) {
+                if (canCloseCycle()) {
                     DVLOG(3) << "Current state is an accepting state";
                     startInnerSearch();
                 }
@@ -330,6 +363,8 @@ void NestedSearch::startOuterSearch() {
     }
 
 
+    LOG(INFO) << "Outer search complete [" << explored << " explored].";
+
     DVLOG(1) << "Exiting outer search";
 }
 
@@ -354,6 +389,7 @@ void NestedSearch::startInnerSearch() {
     }
     combinedState = CombinedState(state, propertyState);
     innerSearchInitialState = combinedState;
+    innerSearchComponent = propertyAutomaton->getComponent();
     tableValue = &table[combinedState];
     if (tableValue->flags & VISITED_IN_INNER) {
         tableValue->innerFeatures->disjunction(*currentFeatures->clone());
@@ -368,6 +404,8 @@ void NestedSearch::startInnerSearch() {
 
     while (innerSearch) {
 
+        sampleStats();
+
         DVLOG(2) << "New iteration";
 
         if (errorFound) {
@@ -399,6 +437,13 @@ void NestedSearch::startInnerSearch() {
             DVLOG(3) << "Taking next transition";
             propertyTransition = propertyAutomaton->nextTransition();
             applyProperty();
+            if (propertyAutomaton->getComponent() != innerSearchComponent) {
+                /* No cycle through the initial state of the inner search
+                 * leaves its component. */
+                DVLOG(3) << "Next state is out of the component";
+                revertProperty();
+                continue;
+            }
             apply();
             DVLOG(3) << "Next state: " << CombinedState(state, propertyState).toString();
             // At this stage, next state should not be final
@@ -487,6 +532,18 @@ void NestedSearch::startInnerSearch() {
     DVLOG(1) << "Exiting inner search";
 }
 
+bool NestedSearch::canCloseCycle() const {
+    return propertyState->isAccepting() && propertyAutomaton->getComponent()
+            != PropertyAutomaton::NO_COMPONENT;
+}
+
+void NestedSearch::sampleStats() {
+    if (++iterations % STATS_SAMPLING_PERIOD == 0) {
+        LOG(INFO) << "Iteration " << iterations << ", BDD statistics: "
+                  << expFactory->getStats().toString();
+    }
+}
+
 void NestedSearch::checkRep() const {
     if (doCheckRep) {
         // Nothing here
@@ -37,6 +37,13 @@ namespace checker {
  * A NestedSearch is a call to a nested depth first search algorithms to model
  * check a given featured transition system against a given property.
  *
+ * As in the nested depth first search of Schwoon and Esparza, the outer search
+ * reports an accepting cycle as soon as it closes a cycle of its path from or
+ * to an accepting state, and the inner searches only report cycles back to the
+ * path of the outer search. An inner search only goes through the states in
+ * the component of the property automaton of its initial state, and is only
+ * started from accepting states on a cycle of the property automaton.
+ *
  * The arguments of the call must be given when constructing the algorithm.
  * The caller can then use the 'run' method to run the algorithm and retrieve
  * the results afterwards.
@@ -107,11 +114,20 @@ private:
     /** The state is in the current inner search path */
     static const unsigned int IN_INNER_PATH =           1 << 3;
 
+    /** Number of iterations between two samples of the BDD statistics */
+    static const unsigned long STATS_SAMPLING_PERIOD =  1 << 16;
+
     /* Global variables */
 
     /** Current state of the algorithm */
     AlgorithmState algorithmState;
 
+    /** Number of iterations of the search loops so far */
+    unsigned long iterations;
+
+    /** Number of states explored by the outer search */
+    int explored;
+
     /** Valid products expression, i.e. the conjunction of the feature
      *  diagram and of the negation of the bad products expression.
      */
@@ -164,6 +180,10 @@ private:
     /** Initial state of the inner search, when running */
     CombinedState innerSearchInitialState;
 
+    /** Component of the property automaton the inner search is restricted
+     *  to, when running */
+    int innerSearchComponent;
+
 
 public:
 
@@ -199,6 +219,19 @@ public:
      */
     std::tr1::shared_ptr<util::List<CounterExample> > getCounterExamples() const;
 
+    /**
+     * @requires this has finished
+     * @return The number of states explored by the outer search of this.
+     */
+    int getNbOfExploredStates() const;
+
+    /**
+     * @requires this has finished
+     * @return An estimation of the number of bytes allocated by the table of
+     *         the visited combined states.
+     */
+    unsigned long getTableBytes() const;
+
 private:
 
     /**
@@ -312,10 +345,27 @@ private:
 
     /**
      * @modifies this
-     * @effects Starts the inner search.
+     * @effects Starts the inner search. The inner search only goes through the
+     *          states in the component of the property automaton of its
+     *          initial state, since an accepting cycle cannot leave it.
      */
     void startInnerSearch();
 
+    /**
+     * @return true iff an accepting cycle can go through the current state,
+     *         i.e., iff the current state of the property automaton is
+     *         accepting and on a cycle. Otherwise, no inner search is needed
+     *         from the current state.
+     */
+    bool canCloseCycle() const;
+
+    /**
+     * @modifies this
+     * @effects Counts one more iteration and, every STATS_SAMPLING_PERIOD
+     *          iterations, logs a sample of the BDD statistics.
+     */
+    void sampleStats();
+
     /**
      * @effects Asserts the invariant representation holds for this.
      */
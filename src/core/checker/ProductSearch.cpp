@@ -0,0 +1,340 @@
+/*
+ * ProductSearch.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "ProductSearch.hpp"
+
+#include "core/fts/State.hpp"
+#include "core/fts/fstm/FstmState.hpp"
+#include "core/fts/fstm/ProductGraph.hpp"
+
+#include "util/Assert.hpp"
+
+#include <glog/logging.h>
+
+#include <ctime>
+
+using core::features::BoolFeatureExpFactory;
+using core::features::FeatureExp;
+
+using core::fts::StatePtr;
+using core::fts::fstm::ProductGraph;
+using core::fts::fstm::ProductGraphPtr;
+
+using util::List;
+
+using std::auto_ptr;
+using std::clock;
+using std::clock_t;
+using std::tr1::shared_ptr;
+
+namespace core {
+namespace checker {
+
+// constructors
+ProductSearch::ProductSearch(
+        const shared_ptr<FeatureExp> & fd,
+        const ProductGraphPtr & graph,
+        const shared_ptr<BoolFeatureExpFactory> & expFactory) :
+
+        fd(fd), graph(graph), expFactory(expFactory),
+        counterExamples(new List<CounterExample>()), algorithmState(Ready),
+        iterations(0), explored(0), errorFound(false), path(), table() {
+
+    assertTrue(graph);
+
+    checkRep();
+}
+
+// public methods
+void ProductSearch::run() {
+    assertTrue(algorithmState == Ready);
+
+    algorithmState = Running;
+    clock_t start = clock();
+
+    startOuterSearch();
+
+    clock_t end = clock();
+    algorithmState = Finished;
+
+    LOG(INFO) << "CPU time used: "
+              << 1000.0 * (end - start) / CLOCKS_PER_SEC
+              << " ms\n";
+    LOG(INFO) << "BDD statistics: " << expFactory->getStats().toString();
+
+    checkRep();
+}
+
+shared_ptr<FeatureExp> ProductSearch::getBadProducts() const {
+    assertTrue(algorithmState == Finished);
+
+    return badProducts;
+}
+
+shared_ptr<List<CounterExample> > ProductSearch::getCounterExamples() const {
+    assertTrue(algorithmState == Finished);
+
+    return counterExamples;
+}
+
+int ProductSearch::getNbOfExploredStates() const {
+    assertTrue(algorithmState == Finished);
+
+    return explored;
+}
+
+unsigned long ProductSearch::getTableBytes() const {
+    assertTrue(algorithmState == Finished);
+
+    return table.capacity() * sizeof(TableValue) + graph->bytes();
+}
+
+// private methods
+bool ProductSearch::isSatisfiable(const shared_ptr<FeatureExp> & features) const {
+    return auto_ptr<FeatureExp>(features->clone())->conjunction(
+            *auto_ptr<FeatureExp>(validProducts->clone()))->isSatisfiable();
+}
+
+bool ProductSearch::findNextEdge(Frame & frame) const {
+    const unsigned int end = graph->endEdgeOf(frame.node);
+    while (frame.cursor < end) {
+        const ProductGraph::Edge & edge = graph->getEdge(frame.cursor);
+        // The edges of a same FSTM transition are adjacent.
+        if (edge.transition != frame.transition) {
+            frame.transition = edge.transition;
+            frame.nextFeatures = shared_ptr<FeatureExp>(
+                    frame.features->clone());
+            frame.nextFeatures->conjunction(*auto_ptr<FeatureExp>(
+                    graph->getGuard(edge.guard)->clone()));
+            frame.satisfiable = isSatisfiable(frame.nextFeatures);
+        }
+        if (frame.satisfiable) {
+            return true;
+        }
+        frame.cursor++;
+    }
+    return false;
+}
+
+void ProductSearch::skipTransition(Frame & frame) const {
+    const unsigned int end = graph->endEdgeOf(frame.node);
+    while (frame.cursor < end
+            && graph->getEdge(frame.cursor).transition == frame.transition) {
+        frame.cursor++;
+    }
+}
+
+void ProductSearch::push(unsigned int node,
+        const shared_ptr<FeatureExp> & features) {
+    path.push_back(Frame(node, graph->firstEdgeOf(node), features));
+}
+
+void ProductSearch::addToBadProducts() {
+    const shared_ptr<FeatureExp> & nextFeatures = path.back().nextFeatures;
+
+    List<StatePtr> states;
+    std::vector<Frame>::const_iterator it;
+    for (it = path.begin(); it != path.end(); ++it) {
+        states.addLast(graph->getFstmState(it->node));
+    }
+    counterExamples->addLast(CounterExample(*auto_ptr<FeatureExp>(
+            nextFeatures->clone()), states.elements()));
+    badProducts->disjunction(*auto_ptr<FeatureExp>(nextFeatures->clone()));
+    validProducts->conjunction(*auto_ptr<FeatureExp>(nextFeatures->clone()->negation()));
+}
+
+void ProductSearch::startOuterSearch() {
+
+    // Initializing results
+    badProducts.reset(expFactory->getFalse());
+
+    // Initializing outer search
+    errorFound = false;
+    validProducts = auto_ptr<FeatureExp>(fd->clone());
+    if (graph->isEmpty()) {
+        LOG(INFO) << "Product graph is empty, no error can be found.";
+        return;
+    }
+    table.assign(graph->getNbOfNodes(), TableValue());
+    push(0, shared_ptr<FeatureExp>(expFactory->getTrue()));
+    table[0].flags |= VISITED_IN_OUTER | IN_OUTER_PATH;
+    table[0].outerFeatures = shared_ptr<FeatureExp>(path.back().features->clone());
+    explored = 1;
+
+    DVLOG(1) << "Starting outer search";
+
+    while (!path.empty()) {
+
+        sampleStats();
+
+        Frame & frame = path.back();
+
+        if (errorFound) {
+            /* The current path has led to highlight an error, see
+             * NestedSearch.
+             */
+            if (isSatisfiable(frame.features)) {
+                DVLOG(3) << "Current features expression is still satisfiable";
+                errorFound = false;
+                skipTransition(frame);
+            }
+            else {
+                DVLOG(3) << "Current features expression is no longer satisfiable";
+                table[frame.node].flags &= ~IN_OUTER_PATH;
+                path.pop_back();
+            }
+        }
+        else if (!findNextEdge(frame)) {
+            DVLOG(3) << "Current state has no outgoing transition left";
+            if (graph->isAccepting(frame.node)) {
+                DVLOG(3) << "Current state is an accepting state";
+                startInnerSearch();
+            }
+            DVLOG(3) << "Backtracking";
+            table[path.back().node].flags &= ~IN_OUTER_PATH;
+            path.pop_back();
+        }
+        else {
+            const ProductGraph::Edge & edge = graph->getEdge(frame.cursor++);
+            if (edge.target == ProductGraph::FINAL) {
+                DVLOG(3) << "Next state is final";
+                DVLOG(1) << "Adding " << frame.nextFeatures->toString() << " to bad products";
+                addToBadProducts();
+                errorFound = true;
+                continue;
+            }
+
+            TableValue & tableValue = table[edge.target];
+            if (tableValue.flags & VISITED_IN_OUTER) {
+                if (tableValue.flags & IN_OUTER_PATH) {
+                    DVLOG(3) << "Next state is in the current path";
+                }
+                else {
+                    shared_ptr<FeatureExp> toVerifyFeatures(frame.nextFeatures->clone());
+                    toVerifyFeatures->conjunction(*auto_ptr<FeatureExp>(tableValue.outerFeatures->clone())->negation());
+                    if (isSatisfiable(toVerifyFeatures)) {
+                        DVLOG(3) << "At least one valid product is still to be verify";
+                        tableValue.outerFeatures->disjunction(*auto_ptr<FeatureExp>(toVerifyFeatures->clone()));
+                        tableValue.flags |= IN_OUTER_PATH;
+                        push(edge.target, toVerifyFeatures);
+                    }
+                }
+            }
+            else {
+                tableValue.outerFeatures = shared_ptr<FeatureExp>(frame.nextFeatures->clone());
+                tableValue.flags |= VISITED_IN_OUTER | IN_OUTER_PATH;
+                ++explored;
+                push(edge.target, frame.nextFeatures);
+            }
+        }
+    }
+
+    LOG(INFO) << "Outer search complete [" << explored << " explored].";
+
+    DVLOG(1) << "Exiting outer search";
+}
+
+void ProductSearch::startInnerSearch() {
+
+    // Initializing inner search from the top of the path
+    const unsigned int root = path.size() - 1;
+    Frame & rootFrame = path.back();
+    rootFrame.cursor = graph->firstEdgeOf(rootFrame.node);
+    rootFrame.transition = NO_TRANSITION;
+    TableValue & rootValue = table[rootFrame.node];
+    if (rootValue.flags & VISITED_IN_INNER) {
+        rootValue.innerFeatures->disjunction(*auto_ptr<FeatureExp>(rootFrame.features->clone()));
+    }
+    else {
+        rootValue.flags |= VISITED_IN_INNER;
+        rootValue.innerFeatures = shared_ptr<FeatureExp>(rootFrame.features->clone());
+    }
+    rootValue.flags |= IN_INNER_PATH;
+
+    DVLOG(1) << "Starting inner search";
+
+    bool innerSearch = true;
+    while (innerSearch) {
+
+        sampleStats();
+
+        Frame & frame = path.back();
+
+        if (errorFound && isSatisfiable(frame.features)) {
+            DVLOG(3) << "Current features expression is still satisfiable";
+            errorFound = false;
+            skipTransition(frame);
+        }
+        else if (errorFound || !findNextEdge(frame)) {
+            DVLOG(3) << "Backtracking";
+            table[frame.node].flags &= ~IN_INNER_PATH;
+            if (path.size() - 1 == root) {
+                innerSearch = false;
+            }
+            else {
+                path.pop_back();
+            }
+        }
+        else {
+            const ProductGraph::Edge & edge = graph->getEdge(frame.cursor++);
+            if (edge.target == ProductGraph::FINAL
+                    || (table[edge.target].flags & IN_OUTER_PATH)) {
+                DVLOG(3) << "A cycle has been found";
+                DVLOG(1) << "Adding " << frame.nextFeatures->toString() << " to bad products";
+                addToBadProducts();
+                errorFound = true;
+                continue;
+            }
+
+            TableValue & tableValue = table[edge.target];
+            if (tableValue.flags & VISITED_IN_INNER) {
+                if (tableValue.flags & IN_INNER_PATH) {
+                    DVLOG(3) << "Next state is in the current path";
+                }
+                else if (graph->isAccepting(edge.target)) {
+                    /* If the next state is an accepting state, it has already
+                     * been visited for these features.
+                     */
+                    DVLOG(3) << "Next state is an accepting state";
+                }
+                else {
+                    shared_ptr<FeatureExp> toVerifyFeatures(frame.nextFeatures->clone());
+                    toVerifyFeatures->conjunction(*auto_ptr<FeatureExp>(tableValue.innerFeatures->clone())->negation());
+                    if (isSatisfiable(toVerifyFeatures)) {
+                        DVLOG(3) << "At least one valid product is still to be verify";
+                        tableValue.innerFeatures->disjunction(*auto_ptr<FeatureExp>(toVerifyFeatures->clone()));
+                        tableValue.flags |= IN_INNER_PATH;
+                        push(edge.target, toVerifyFeatures);
+                    }
+                }
+            }
+            else {
+                tableValue.innerFeatures = shared_ptr<FeatureExp>(frame.nextFeatures->clone());
+                tableValue.flags |= VISITED_IN_INNER | IN_INNER_PATH;
+                push(edge.target, frame.nextFeatures);
+            }
+        }
+    }
+
+    DVLOG(1) << "Exiting inner search";
+}
+
+void ProductSearch::sampleStats() {
+    if (++iterations % STATS_SAMPLING_PERIOD == 0) {
+        LOG(INFO) << "Iteration " << iterations << ", BDD statistics: "
+                  << expFactory->getStats().toString();
+    }
+}
+
+void ProductSearch::checkRep() const {
+    if (doCheckRep) {
+        assertTrue(graph);
+        assertTrue(algorithmState != Finished || path.empty());
+    }
+}
+
+} // namespace checker
+} // namespace core
@@ -0,0 +1,264 @@
+/*
+ * ProductSearch.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef CORE_CHECKER_PRODUCTSEARCH_HPP
+#define CORE_CHECKER_PRODUCTSEARCH_HPP
+
+#include "CounterExample.hpp"
+
+#include "core/features/BoolFeatureExp.hpp"
+#include "core/features/BoolFeatureExpFactory.hpp"
+#include "core/features/FeatureExp.hpp"
+#include "core/fts/fstm/forwards.hpp"
+
+#include "util/List.hpp"
+#include "util/Uncopyable.hpp"
+
+#include <memory>
+#include <tr1/memory>
+#include <vector>
+
+namespace core {
+namespace checker {
+
+/**
+ * A ProductSearch is a call to the nested depth first search algorithm of
+ * NestedSearch run on the precomputed product graph of an FSTM and of the
+ * never claim of its property.
+ *
+ * The search takes the edges of the product graph in the order in which
+ * NestedSearch takes the transitions of the FSTM and of the never claim, and
+ * handles the feature expressions in the same way, so that both find the same
+ * bad products. It does not need to apply and revert any transition: the
+ * path of the search is an explicit stack of product nodes, and the table of
+ * the visited states is an array indexed by these nodes.
+ *
+ * The product graph does not contain the nodes from which no error can be
+ * found, so a ProductSearch cannot detect deadlocks.
+ *
+ * @author mwi
+ */
+class ProductSearch : private util::Uncopyable {
+
+private:
+    /** Structure for the table values */
+    struct TableValue {
+        unsigned int flags;
+        std::tr1::shared_ptr<core::features::FeatureExp> innerFeatures;
+        std::tr1::shared_ptr<core::features::FeatureExp> outerFeatures;
+        TableValue() : flags(0), innerFeatures(), outerFeatures() {}
+    };
+
+    /** Structure for the nodes of the path of the search */
+    struct Frame {
+        /** The product node */
+        unsigned int node;
+        /** The index of the next edge to consider */
+        unsigned int cursor;
+        /** The FSTM transition of the edges for which nextFeatures is
+         *  computed, or NO_TRANSITION */
+        unsigned int transition;
+        /** True iff nextFeatures is satisfiable wrt the valid products */
+        bool satisfiable;
+        /** The current feature expression */
+        std::tr1::shared_ptr<core::features::FeatureExp> features;
+        /** The conjunction of features and of the guard of transition */
+        std::tr1::shared_ptr<core::features::FeatureExp> nextFeatures;
+
+        Frame(unsigned int node, unsigned int cursor,
+            const std::tr1::shared_ptr<core::features::FeatureExp> & features)
+            : node(node), cursor(cursor), transition(NO_TRANSITION),
+              satisfiable(false), features(features), nextFeatures() {}
+    };
+
+    /** Enumeration for the current state of the algorithm */
+    enum AlgorithmState {
+        Ready,
+        Running,
+        Finished
+    };
+
+    /* Flags*/
+
+    /** The state has been visited in the outer search */
+    static const unsigned int VISITED_IN_OUTER =        1 << 0;
+
+    /** The state has been visited in the inner search */
+    static const unsigned int VISITED_IN_INNER =        1 << 1;
+
+    /** The state is in the current outer search path */
+    static const unsigned int IN_OUTER_PATH =           1 << 2;
+
+    /** The state is in the current inner search path */
+    static const unsigned int IN_INNER_PATH =           1 << 3;
+
+    /** No FSTM transition */
+    static const unsigned int NO_TRANSITION =           ~0u;
+
+    /** Number of iterations between two samples of the BDD statistics */
+    static const unsigned long STATS_SAMPLING_PERIOD =  1 << 16;
+
+    /* Arguments */
+
+    /** Feature Diagram */
+    std::tr1::shared_ptr<core::features::FeatureExp> fd;
+
+    /** Product graph */
+    core::fts::fstm::ProductGraphPtr graph;
+
+    /** Factory for the feature expressions */
+    std::tr1::shared_ptr<core::features::BoolFeatureExpFactory> expFactory;
+
+    /* Results */
+
+    /** Bad products expression */
+    std::tr1::shared_ptr<core::features::FeatureExp> badProducts;
+
+    /** The set of counter examples for the bad products */
+    std::tr1::shared_ptr<util::List<CounterExample> > counterExamples;
+
+    /* Global variables */
+
+    /** Current state of the algorithm */
+    AlgorithmState algorithmState;
+
+    /** Number of iterations of the search loops so far */
+    unsigned long iterations;
+
+    /** Number of states explored by the outer search */
+    int explored;
+
+    /** Valid products expression, i.e. the conjunction of the feature
+     *  diagram and of the negation of the bad products expression.
+     */
+    std::auto_ptr<core::features::FeatureExp> validProducts;
+
+    /** True iff the current path has led to highlight an error */
+    bool errorFound;
+
+    /** The path of the search, the current node being on top */
+    std::vector<Frame> path;
+
+    /** Table containing the visited states, indexed by product node */
+    std::vector<TableValue> table;
+
+public:
+
+    /**
+     * @requires graph != null
+     * @effets Makes this be a ProductSearch algorithm ready to verify the
+     *         property of the product graph 'graph' according to the feature
+     *         diagram 'fd'.
+     */
+    ProductSearch(
+            const std::tr1::shared_ptr<core::features::FeatureExp> & fd,
+            const core::fts::fstm::ProductGraphPtr & graph,
+            const std::tr1::shared_ptr<core::features::BoolFeatureExpFactory> &
+                expFactory);
+
+    // Default destructor is fine
+
+    /**
+     * @requires this is ready
+     * @modifies this
+     * @effects Runs this.
+     */
+    void run();
+
+    /**
+     * @requires this has finished
+     * @return A feature expression representing the set of products violating
+     *         the specified property.
+     */
+    std::tr1::shared_ptr<core::features::FeatureExp> getBadProducts() const;
+
+    /**
+     * @requires this has finished
+     * @return The set of counter examples for the bad products.
+     */
+    std::tr1::shared_ptr<util::List<CounterExample> > getCounterExamples() const;
+
+    /**
+     * @requires this has finished
+     * @return The number of states explored by the outer search of this.
+     */
+    int getNbOfExploredStates() const;
+
+    /**
+     * @requires this has finished
+     * @return An estimation of the number of bytes allocated by the table of
+     *         the visited states and by the product graph.
+     */
+    unsigned long getTableBytes() const;
+
+private:
+
+    /**
+     * @return true iff 'features' is satisfiable wrt the valid products.
+     */
+    bool isSatisfiable(const std::tr1::shared_ptr<core::features::FeatureExp> & features) const;
+
+    /**
+     * @modifies frame
+     * @effects Makes the cursor of 'frame' be the next edge whose feature
+     *          expression is satisfiable wrt the valid products, if such
+     *          exists, and makes the next features of 'frame' be this latter
+     *          feature expression.
+     * @return true iff the mentioned edge has been found
+     */
+    bool findNextEdge(Frame & frame) const;
+
+    /**
+     * @modifies frame
+     * @effects Makes the cursor of 'frame' skip the other edges of the FSTM
+     *          transition of its next features, once they led to an error.
+     */
+    void skipTransition(Frame & frame) const;
+
+    /**
+     * @modifies this
+     * @effects Pushes the node 'node' with the current features 'features'
+     *          on the path.
+     */
+    void push(unsigned int node,
+        const std::tr1::shared_ptr<core::features::FeatureExp> & features);
+
+    /**
+     * @modifies this
+     * @effects Adds the next features of the top of the path to the bad
+     *          products.
+     */
+    void addToBadProducts();
+
+    /**
+     * @modifies this
+     * @effects Starts the outer search.
+     */
+    void startOuterSearch();
+
+    /**
+     * @modifies this
+     * @effects Starts the inner search from the top of the path.
+     */
+    void startInnerSearch();
+
+    /**
+     * @modifies this
+     * @effects Counts one more iteration and, every STATS_SAMPLING_PERIOD
+     *          iterations, logs a sample of the BDD statistics.
+     */
+    void sampleStats();
+
+    /**
+     * @effects Asserts the invariant representation holds for this.
+     */
+    void checkRep() const;
+};
+
+} // namespace checker
+} // namespace core
+
+#endif /* CORE_CHECKER_PRODUCTSEARCH_HPP */
@@ -0,0 +1,324 @@
+/*
+ * SafetySearch.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "SafetySearch.hpp"
+
+#include "util/Assert.hpp"
+
+#include <glog/logging.h>
+
+#include <ctime>
+
+using core::features::BoolFeatureExpFactory;
+using core::features::FeatureExp;
+
+using core::fts::FTS;
+using core::fts::TransitionPtr;
+
+using util::List;
+
+using std::auto_ptr;
+using std::clock;
+using std::clock_t;
+using std::tr1::shared_ptr;
+
+namespace core {
+namespace checker {
+
+// constructors
+SafetySearch::SafetySearch(
+        shared_ptr<FeatureExp> fd,
+        shared_ptr<FTS> fts,
+        shared_ptr<BoolFeatureExpFactory> expFactory) :
+
+        fd(fd), fts(fts), expFactory(expFactory),
+        counterExamples(new List<CounterExample>()), algorithmState(Ready),
+        iterations(0), explored(0) {
+
+    assertTrue(fts->hasProperty());
+
+    propertyAutomaton = fts->getPropertyAutomaton();
+    assertTrue(propertyAutomaton->isSafety());
+
+    checkRep();
+}
+
+// public methods
+void SafetySearch::run() {
+    assertTrue(algorithmState == Ready);
+
+    algorithmState = Running;
+    clock_t start = clock();
+
+    startSearch();
+
+    clock_t end = clock();
+    algorithmState = Finished;
+
+    LOG(INFO) << "CPU time used: "
+              << 1000.0 * (end - start) / CLOCKS_PER_SEC
+              << " ms\n";
+    LOG(INFO) << "BDD statistics: " << expFactory->getStats().toString();
+
+    checkRep();
+}
+
+shared_ptr<FeatureExp> SafetySearch::getBadProducts() const {
+    assertTrue(algorithmState == Finished);
+
+    return badProducts;
+}
+
+shared_ptr<List<CounterExample> > SafetySearch::getCounterExamples() const {
+    assertTrue(algorithmState == Finished);
+
+    return counterExamples;
+}
+
+int SafetySearch::getNbOfExploredStates() const {
+    assertTrue(algorithmState == Finished);
+
+    return explored;
+}
+
+unsigned long SafetySearch::getTableBytes() const {
+    assertTrue(algorithmState == Finished);
+
+    return table.bytes();
+}
+
+// private methods
+bool SafetySearch::isSatisfiable(const shared_ptr<FeatureExp> & features) const {
+    return auto_ptr<FeatureExp>(features->clone())->conjunction(
+            *auto_ptr<FeatureExp>(validProducts->clone()))->isSatisfiable();
+}
+
+bool SafetySearch::findNextTransition(
+        const shared_ptr<const FeatureExp> & features,
+        TransitionPtr & transition,
+        shared_ptr<FeatureExp> & nextFeatures) const {
+
+    bool found = false;
+    while (fts->hasNextTransition() && !found) {
+        transition = fts->nextTransition();
+        nextFeatures = shared_ptr<FeatureExp>(features->clone());
+        nextFeatures->conjunction(*transition->getFeatureExp());
+        if (isSatisfiable(nextFeatures)) {
+            found = true;
+        }
+    }
+    return found;
+}
+
+void SafetySearch::applyAll() {
+    propertyAutomaton->apply(propertyTransition);
+    propertyState = propertyAutomaton->getCurrentState();
+    fts->apply(transition);
+    state = fts->getCurrentState();
+}
+
+void SafetySearch::revertAll() {
+    transition = fts->revert();
+    state = fts->getCurrentState();
+    propertyTransition = propertyAutomaton->revert();
+    propertyState = propertyAutomaton->getCurrentState();
+}
+
+void SafetySearch::push(
+        const shared_ptr<FeatureExp> & nextCurrentFeatures,
+        const TransitionPtr & nextTransition,
+        const shared_ptr<FeatureExp> & nextNextFeatures) {
+
+    currentFeaturesStack.push(currentFeatures);
+    nextFeaturesStack.push(nextFeatures);
+    currentFeatures = nextCurrentFeatures;
+    nextFeatures = nextNextFeatures;
+    transition = nextTransition;
+}
+
+void SafetySearch::backtrack() {
+    if (fts->isInitialState()) {
+        search = false;
+    }
+    else {
+        revertAll();
+        currentFeatures = currentFeaturesStack.pop();
+        nextFeatures = nextFeaturesStack.pop();
+    }
+}
+
+void SafetySearch::addToBadProducts() {
+    counterExamples->addLast(CounterExample(*auto_ptr<FeatureExp>(
+            nextFeatures->clone()), fts->getPath()));
+    badProducts->disjunction(*auto_ptr<FeatureExp>(nextFeatures->clone()));
+    validProducts->conjunction(*auto_ptr<FeatureExp>(nextFeatures->clone()->negation()));
+}
+
+void SafetySearch::deadlock(const shared_ptr<const FeatureExp> & features) {
+    LOG(WARNING) << "Deadlock in "
+                 << CombinedState(state, propertyState).toString()
+                 << " for " << features->toString();
+
+    if (fts->isInitialState()) {
+        search = false;
+    }
+    else {
+        DVLOG(3) << "Reverting";
+        revertAll();
+    }
+}
+
+void SafetySearch::startSearch() {
+
+    // Declaring local variables
+    bool found;
+    shared_ptr<FeatureExp> verifiedFeatures;
+    shared_ptr<FeatureExp> toVerifyFeatures;
+    TransitionPtr nextTransition;
+    shared_ptr<FeatureExp> nextNextFeatures;
+    TableValue * tableValue;
+
+    // Initializing results
+    badProducts.reset(expFactory->getFalse());
+
+    // Initializing search
+    search = true;
+    errorFound = false;
+    validProducts = auto_ptr<FeatureExp>(fd->clone());
+    state = fts->getCurrentState();
+    propertyState = propertyAutomaton->getCurrentState();
+    currentFeatures.reset(expFactory->getTrue());
+    found = findNextTransition(currentFeatures, transition, nextFeatures);
+    if (!found) {
+        deadlock(currentFeatures);
+    }
+    table[CombinedState(state, propertyState)].features =
+            shared_ptr<FeatureExp>(currentFeatures->clone());
+    explored = 1;
+
+    DVLOG(1) << "Starting safety search";
+
+    while (search) {
+
+        sampleStats();
+
+        DVLOG(2) << "New iteration";
+
+        if (errorFound) {
+            /* The current path has led to highlight an error.
+             * @see NestedSearch#startOuterSearch
+             */
+            if (isSatisfiable(currentFeatures)) {
+                DVLOG(3) << "Current features expression is still satisfiable";
+                errorFound = false;
+                found = findNextTransition(currentFeatures, transition, nextFeatures);
+                if (found) {
+                    propertyAutomaton->resetTransitions();
+                }
+                else {
+                    DVLOG(3) << "Current state has no outgoing transition left";
+                    DVLOG(3) << "Backtracking";
+                    backtrack();
+                }
+            }
+            else {
+                DVLOG(3) << "Current features expression is no longer satisfiable";
+                DVLOG(3) << "Backtracking";
+                backtrack();
+            }
+        }
+        else if (propertyAutomaton->hasNextTransition()) {
+            DVLOG(3) << "Taking next transition";
+            propertyTransition = propertyAutomaton->nextTransition();
+            applyAll();
+            DVLOG(3) << "Next state: " << CombinedState(state, propertyState).toString();
+            if (propertyState->isFinal()) {
+                DVLOG(3) << "Next state is final";
+                DVLOG(1) << "Adding " << nextFeatures->toString() << " to bad products";
+                addToBadProducts();
+                DVLOG(3) << "Reverting";
+                revertAll();
+                errorFound = true;
+            }
+            else if (!propertyAutomaton->hasNextTransition()) {
+                DVLOG(3) << "Next state has no outgoing transition";
+                DVLOG(3) << "Reverting";
+                revertAll();
+            }
+            else {
+                tableValue = &table[CombinedState(state,
+                        transition->getEventId(), propertyState)];
+                if (tableValue->features) {
+                    /* The features only decrease along a path, so that a
+                     * state of the current path is never explored again. */
+                    DVLOG(3) << "Next state has already been visited";
+                    verifiedFeatures = tableValue->features;
+                    toVerifyFeatures = shared_ptr<FeatureExp>(nextFeatures->clone());
+                    toVerifyFeatures->conjunction(*auto_ptr<FeatureExp>(verifiedFeatures->clone())->negation());
+                    if (isSatisfiable(toVerifyFeatures)) {
+                        DVLOG(3) << "At least one valid product is still to be verify";
+                        verifiedFeatures->disjunction(*auto_ptr<FeatureExp>(toVerifyFeatures->clone()));
+                        found = findNextTransition(toVerifyFeatures, nextTransition, nextNextFeatures);
+                        if (found) {
+                            push(toVerifyFeatures, nextTransition, nextNextFeatures);
+                        }
+                        else {
+                            deadlock(toVerifyFeatures);
+                        }
+                    }
+                    else {
+                        DVLOG(3) << "Reverting";
+                        revertAll();
+                    }
+                }
+                else {
+                    tableValue->features = shared_ptr<FeatureExp>(nextFeatures->clone());
+                    ++explored;
+                    found = findNextTransition(nextFeatures, nextTransition, nextNextFeatures);
+                    if (found) {
+                        push(nextFeatures, nextTransition, nextNextFeatures);
+                    }
+                    else {
+                        deadlock(nextFeatures);
+                    }
+                }
+            }
+        }
+        else {
+            found = findNextTransition(currentFeatures, transition, nextFeatures);
+            if (found) {
+                propertyAutomaton->resetTransitions();
+            }
+            else {
+                DVLOG(3) << "Current state has no outgoing transition left";
+                DVLOG(3) << "Backtracking";
+                backtrack();
+            }
+        }
+    }
+
+    LOG(INFO) << "Safety search complete [" << explored << " explored].";
+
+    DVLOG(1) << "Exiting safety search";
+}
+
+void SafetySearch::sampleStats() {
+    if (++iterations % STATS_SAMPLING_PERIOD == 0) {
+        LOG(INFO) << "Iteration " << iterations << ", BDD statistics: "
+                  << expFactory->getStats().toString();
+    }
+}
+
+void SafetySearch::checkRep() const {
+    if (doCheckRep) {
+        assertTrue(fts);
+        assertTrue(propertyAutomaton);
+        assertTrue(expFactory);
+    }
+}
+
+} // namespace checker
+} // namespace core
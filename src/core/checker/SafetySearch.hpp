@@ -0,0 +1,305 @@
+/*
+ * SafetySearch.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef CORE_CHECKER_SAFETYSEARCH_HPP
+#define	CORE_CHECKER_SAFETYSEARCH_HPP
+
+#include "CombinedStateTable.hpp"
+
+#include "CombinedState.hpp"
+#include "CounterExample.hpp"
+
+#include "core/fts/FTS.hpp"
+#include "core/fts/PropertyAutomaton.hpp"
+#include "core/fts/PropertyState.hpp"
+#include "core/fts/PropertyTransition.hpp"
+#include "core/fts/State.hpp"
+#include "core/fts/Transition.hpp"
+#include "core/fts/forwards.hpp"
+
+#include "core/features/BoolFeatureExp.hpp"
+#include "core/features/BoolFeatureExpFactory.hpp"
+#include "core/features/FeatureExp.hpp"
+
+#include "util/List.hpp"
+#include "util/Stack.hpp"
+#include "util/Uncopyable.hpp"
+
+#include <memory>
+#include <tr1/memory>
+
+namespace core {
+namespace checker {
+
+/**
+ * A SafetySearch is a call to a depth first search algorithm to model check a
+ * given featured transition system against a given safety property.
+ *
+ * The property automaton of a safety property accepts a run only when the run
+ * reaches a final state. A violation is thus found as soon as a final state is
+ * reached, and there is no accepting cycle to search for: the algorithm is the
+ * outer search of NestedSearch, without inner searches. The table only records
+ * the features for which each combined state has been visited, the combined
+ * states being told apart by the event that entered their FTS state, which the
+ * guards of the property automaton can read.
+ *
+ * A deadlocked state cannot reach a final state, so that deadlocks are logged
+ * as warnings and the search backtracks from them, as it does for any other
+ * state without successors. They are neither bad products nor errors.
+ *
+ * The arguments of the call must be given when constructing the algorithm.
+ * The caller can then use the 'run' method to run the algorithm and retrieve
+ * the results afterwards.
+ *
+ * @author mwi
+ */
+class SafetySearch : private util::Uncopyable {
+
+private:
+
+    /* Arguments */
+
+    /** Feature Diagram */
+    std::tr1::shared_ptr<core::features::FeatureExp> fd;
+
+    /** Featured Transition System */
+    std::tr1::shared_ptr<core::fts::FTS> fts;
+
+    /** Property automaton */
+    std::tr1::shared_ptr<core::fts::PropertyAutomaton> propertyAutomaton;
+
+    /** Factory for the feature expressions */
+    std::tr1::shared_ptr<core::features::BoolFeatureExpFactory> expFactory;
+
+    /* Results */
+
+    /** Bad products expression, i.e. conjunction of all the feature
+     *  expressions for which an error has been highlighted.
+     */
+    std::tr1::shared_ptr<core::features::FeatureExp> badProducts;
+
+    /**
+     * The set of counter examples for the bad products.
+     */
+    std::tr1::shared_ptr<util::List<CounterExample> > counterExamples;
+
+    /* Private structures and classes */
+
+    /** Structure for the table values
+     *  @see SafetySearch#table
+     */
+    struct TableValue {
+        /** The features for which the state has been visited, or null if it
+         *  has not been visited yet. */
+        std::tr1::shared_ptr<core::features::FeatureExp> features;
+        TableValue() : features() {}
+    };
+
+    /** Enumeration for the current state of the algorithm */
+    enum AlgorithmState {
+        Ready,
+        Running,
+        Finished
+    };
+
+    /** Number of iterations between two samples of the BDD statistics */
+    static const unsigned long STATS_SAMPLING_PERIOD =  1 << 16;
+
+    /* Global variables */
+
+    /** Current state of the algorithm */
+    AlgorithmState algorithmState;
+
+    /** Number of iterations of the search loop so far */
+    unsigned long iterations;
+
+    /** Number of explored states */
+    int explored;
+
+    /** Valid products expression, i.e. the conjunction of the feature
+     *  diagram and of the negation of the bad products expression.
+     */
+    std::auto_ptr<core::features::FeatureExp> validProducts;
+
+    /** True iff the search is running */
+    bool search;
+
+    /** True iff the current path has led to highlight an error */
+    bool errorFound;
+
+    /** Current state of the FTS */
+    core::fts::StatePtr state;
+
+    /** Current state of the property automaton */
+    core::fts::PropertyStatePtr propertyState;
+
+    /** Next FTS transition */
+    core::fts::TransitionPtr transition;
+
+    /** Next property automaton transition */
+    core::fts::PropertyTransitionPtr propertyTransition;
+
+    /** Current feature expression */
+    std::tr1::shared_ptr<core::features::FeatureExp> currentFeatures;
+
+    /** Next feature expression, i.e the conjunction of the current features
+     *  expression and of the feature expression labeling the next FTS
+     *  transition.
+     */
+    std::tr1::shared_ptr<core::features::FeatureExp> nextFeatures;
+
+    /** Stack containing the previous features expressions */
+    util::Stack<std::tr1::shared_ptr<core::features::FeatureExp> > currentFeaturesStack;
+
+    /** Stack containing the previous next feature expression.
+     *  @see NestedSearch#nextFeaturesStack
+     */
+    util::Stack<std::tr1::shared_ptr<core::features::FeatureExp> > nextFeaturesStack;
+
+    /** Table containing the visited states. */
+    CombinedStateTable<TableValue> table;
+
+public:
+
+    /**
+     * @requires 'fts' has a property && its property automaton is a safety
+     *            automaton
+     * @effets Makes this be a SafetySearch algorithm ready to verify the
+     *         property of 'fts' according to the feature diagram 'fd'.
+     */
+    SafetySearch(
+            std::tr1::shared_ptr<core::features::FeatureExp> fd,
+            std::tr1::shared_ptr<core::fts::FTS> fts,
+            std::tr1::shared_ptr<core::features::BoolFeatureExpFactory> expFactory);
+
+    // Default destructor is fine
+
+    /**
+     * @requires this is ready
+     * @modifies this
+     * @effects Runs this.
+     */
+    void run();
+
+    /**
+     * @requires this has finished
+     * @return A feature expression representing the set of products violating
+     *         the specified property.
+     */
+    std::tr1::shared_ptr<core::features::FeatureExp> getBadProducts() const;
+
+    /**
+     * @requires this has finished
+     * @return The set of counter examples for the bad products.
+     */
+    std::tr1::shared_ptr<util::List<CounterExample> > getCounterExamples() const;
+
+    /**
+     * @requires this has finished
+     * @return The number of states explored by this.
+     */
+    int getNbOfExploredStates() const;
+
+    /**
+     * @requires this has finished
+     * @return An estimation of the number of bytes allocated by the table of
+     *         the visited combined states.
+     */
+    unsigned long getTableBytes() const;
+
+private:
+
+    /**
+     * @return true iff 'features' is satisfiable wrt the valid products, i.e.
+     *         iff the conjunction of 'features' and the valid products
+     *         expression is satisfiable.
+     */
+    bool isSatisfiable(const std::tr1::shared_ptr<core::features::FeatureExp> & features) const;
+
+    /**
+     * @modifies transition, nextFeatures
+     * @effects Makes 'transition' be the next transition of the FTS leading
+     *          to a satisfiable (wrt the valid products) feature expression,
+     *          if such exists.
+     *          Makes 'nextFeatures' be this latter feature expression.
+     * @return true iff the mentioned transition has been found
+     */
+    bool findNextTransition(
+        const std::tr1::shared_ptr<const core::features::FeatureExp> & features,
+        core::fts::TransitionPtr & transition,
+        std::tr1::shared_ptr<core::features::FeatureExp> & nextFeatures) const;
+
+    /**
+     * @modifies this
+     * @effects Apply both the next property automaton transition and the next
+     *          FTS transition.
+     */
+    void applyAll();
+
+    /**
+     * @modifies this
+     * @effects Revert both the previous FTS transition and property automaton
+     *          transition.
+     */
+    void revertAll();
+
+    /**
+     * @modifies this
+     * @effects Push the current features and the next features into the
+     *          stacks and updates the value of the current features, the next
+     *          features and the next FTS transition.
+     */
+    void push(
+        const std::tr1::shared_ptr<core::features::FeatureExp> & nextCurrentFeatures,
+        const core::fts::TransitionPtr & nextTransition,
+        const std::tr1::shared_ptr<core::features::FeatureExp> & nextNextFeatures);
+
+    /**
+     * @modifies this
+     * @effects Pop the current features and the next features from the
+     *          stacks and revert both the previous FTS transition and property
+     *          automaton transition if possible. Stop the search if not.
+     */
+    void backtrack();
+
+    /**
+     * @modifies this
+     * @effects Adds the next features expression to the bad products.
+     */
+    void addToBadProducts();
+
+    /**
+     * @modifies this
+     * @effects Logs that the current state has no outgoing transition for the
+     *          given features and reverts the transitions that led to it.
+     *          Stops the search if the current state is the initial one.
+     */
+    void deadlock(
+        const std::tr1::shared_ptr<const core::features::FeatureExp> & features);
+
+    /**
+     * @modifies this
+     * @effects Starts the search.
+     */
+    void startSearch();
+
+    /**
+     * @modifies this
+     * @effects Counts one more iteration and, every STATS_SAMPLING_PERIOD
+     *          iterations, logs a sample of the BDD statistics.
+     */
+    void sampleStats();
+
+    /**
+     * @effects Asserts the invariant representation holds for this.
+     */
+    void checkRep() const;
+};
+
+} // namespace checker
+} // namespace core
+
+#endif	/* CORE_CHECKER_SAFETYSEARCH_HPP */
@@ -78,6 +78,17 @@ public:
      */
     V & operator[](const std::tr1::shared_ptr<const core::fts::State> & key);
 
+    /**
+     * @return the number of keys in this.
+     */
+    unsigned long size() const;
+
+    /**
+     * @return an estimation of the number of bytes allocated by this,
+     *          excluding the memory owned by the keys and the values.
+     */
+    unsigned long bytes() const;
+
     /**
      * @modifies this
      * @effects Remove the value at 'key' if such exits.
@@ -107,6 +118,19 @@ V & StatePtrTable<V>::operator[](const std::tr1::shared_ptr<const core::fts::Sta
     return result;
 }
 
+template<typename V>
+unsigned long StatePtrTable<V>::size() const {
+    return map.size();
+}
+
+template<typename V>
+unsigned long StatePtrTable<V>::bytes() const {
+    // Each node holds a key, a value and a link to the next node.
+    return map.size() * (sizeof(typename std::tr1::unordered_map<std::tr1::shared_ptr<const core::fts::State>, V,
+            Hash, Pred>::value_type) + sizeof(void *))
+        + map.bucket_count() * sizeof(void *);
+}
+
 template<typename V>
 void StatePtrTable<V>::remove(const std::tr1::shared_ptr<const core::fts::State > & key) {
     map.erase(key);
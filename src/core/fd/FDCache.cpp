@@ -0,0 +1,233 @@
+/*
+ * FDCache.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "FDCache.hpp"
+
+#include "core/features/BoolFeatureExp.hpp"
+
+#include "math/BddCodec.hpp"
+#include "math/BoolFct.hpp"
+#include "math/BoolVar.hpp"
+
+#include "util/Assert.hpp"
+#include "util/MappedFile.hpp"
+
+#include <glog/logging.h>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+using core::features::BoolFeatureExp;
+using core::features::BoolFeatureExpFactory;
+using core::features::FeatureExp;
+
+using math::BddDecoder;
+using math::BddEncoder;
+using math::BddNode;
+using math::BoolFct;
+using math::BoolVar;
+
+using std::auto_ptr;
+using std::ios;
+using std::map;
+using std::ofstream;
+using std::ostringstream;
+using std::string;
+using std::vector;
+
+using util::MappedFile;
+
+namespace core {
+namespace fd {
+
+namespace {
+
+/* The magic number of the entries ("PVLF" in little endian). */
+const unsigned int FDCacheMagic = 0x464C5650;
+
+/* The version of the format of the entries. */
+const unsigned int FDCacheVersion = 1;
+
+struct FDCacheHeader {
+    unsigned int magic;
+    unsigned int version;
+    unsigned int nbOfFeatures;
+    unsigned int nbOfNodes;
+    int root;
+    unsigned int stringsSize;
+};
+
+/**
+ * @modifies hash
+ * @effects Mixes the bytes of 'str' into the 64-bit FNV-1a hash 'hash'.
+ */
+void mix(unsigned long long & hash, const string & str) {
+    for (string::const_iterator it = str.begin(); it != str.end(); ++it) {
+        hash ^= static_cast<unsigned char>(*it);
+        hash *= 1099511628211ULL;
+    }
+}
+
+/**
+ * @modifies out
+ * @effects Writes the elements of 'v' on 'out'.
+ */
+template <typename T>
+void writeVector(std::ostream & out, const vector<T> & v) {
+    if (!v.empty()) {
+        out.write(reinterpret_cast<const char *>(&v[0]), v.size() * sizeof(T));
+    }
+}
+
+} // namespace
+
+// constructors
+FDCache::FDCache(const string & directory,
+        const BoolFeatureExpFactory & expFactory)
+        : directory(directory), expFactory(expFactory) {
+    if (mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST) {
+        LOG(WARNING) << "Cannot create the FD cache directory " << directory;
+    }
+
+    checkRep();
+}
+
+// public methods
+string FDCache::makeKey(const string & source, const string & filter) {
+    unsigned long long hash = 14695981039346656037ULL;
+    mix(hash, source);
+    // The separator cannot appear in a text source.
+    mix(hash, string(1, '\0'));
+    mix(hash, filter);
+
+    ostringstream oss;
+    oss.fill('0');
+    oss.width(16);
+    oss << std::hex << hash;
+    return oss.str();
+}
+
+FeatureExp * FDCache::load(const string & key) const {
+    MappedFile file(getPath(key));
+    if (!file.isMapped() || file.getSize() < sizeof(FDCacheHeader)) {
+        return NULL;
+    }
+
+    const char * data = file.getData();
+    const FDCacheHeader * header =
+            reinterpret_cast<const FDCacheHeader *>(data);
+    if (header->magic != FDCacheMagic || header->version != FDCacheVersion
+            || header->stringsSize == 0
+            || file.getSize() != sizeof(FDCacheHeader)
+                + size_t(header->nbOfFeatures) * sizeof(unsigned int)
+                + size_t(header->nbOfNodes) * sizeof(BddNode)
+                + header->stringsSize) {
+        return NULL;
+    }
+    const unsigned int * featureNames = reinterpret_cast<const unsigned int *>(
+            data + sizeof(FDCacheHeader));
+    const BddNode * nodes = reinterpret_cast<const BddNode *>(
+            featureNames + header->nbOfFeatures);
+    const char * strings = reinterpret_cast<const char *>(
+            nodes + header->nbOfNodes);
+    if (strings[header->stringsSize - 1] != '\0' || header->root < 0
+            || static_cast<unsigned int>(header->root >> 1) > header->nbOfNodes
+            || !BddDecoder::isValid(nodes, header->nbOfNodes,
+                header->nbOfFeatures)) {
+        return NULL;
+    }
+
+    vector<int> varIds;
+    for (unsigned int i = 0; i < header->nbOfFeatures; ++i) {
+        if (featureNames[i] >= header->stringsSize
+                || strings[featureNames[i]] == '\0') {
+            return NULL;
+        }
+        varIds.push_back(BoolVar::makeBoolVar(
+                string(strings + featureNames[i])).getId());
+    }
+    BddDecoder decoder(nodes, header->nbOfNodes, varIds);
+    FeatureExp * result = expFactory.create(decoder.decode(header->root));
+
+    DVLOG(1) << "FD loaded from the cache entry " << key;
+    return result;
+}
+
+void FDCache::store(const string & key, const FeatureExp & fd) const {
+    BddEncoder encoder;
+    const int root = encoder.encode(
+            static_cast<const BoolFeatureExp &>(fd).getBoolFct());
+
+    // Map the BoolVar ids of the nodes to feature indexes, in the order of
+    // the ids.
+    vector<BddNode> nodes(encoder.getNodes());
+    map<int, unsigned int> features;
+    for (vector<BddNode>::const_iterator it = nodes.begin();
+            it != nodes.end(); ++it) {
+        features[it->var] = 0;
+    }
+    string strings;
+    vector<unsigned int> featureNames;
+    for (map<int, unsigned int>::iterator it = features.begin();
+            it != features.end(); ++it) {
+        it->second = featureNames.size();
+        featureNames.push_back(strings.size());
+        strings.append(BoolVar::makeBoolVar(it->first).getName());
+        strings.push_back('\0');
+    }
+    for (vector<BddNode>::iterator it = nodes.begin(); it != nodes.end();
+            ++it) {
+        it->var = features[it->var];
+    }
+    strings.resize((strings.size() + 4) & ~3u, '\0');
+
+    FDCacheHeader header;
+    header.magic = FDCacheMagic;
+    header.version = FDCacheVersion;
+    header.nbOfFeatures = featureNames.size();
+    header.nbOfNodes = nodes.size();
+    header.root = root;
+    header.stringsSize = strings.size();
+
+    ostringstream tmpPath;
+    tmpPath << getPath(key) << "." << getpid();
+    ofstream out(tmpPath.str().c_str(), ios::binary | ios::out);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    writeVector(out, featureNames);
+    writeVector(out, nodes);
+    out.write(strings.data(), strings.size());
+    out.close();
+    if (!out || std::rename(tmpPath.str().c_str(), getPath(key).c_str()) != 0) {
+        std::remove(tmpPath.str().c_str());
+        LOG(WARNING) << "Cannot store the FD cache entry " << getPath(key);
+        return;
+    }
+
+    DVLOG(1) << "FD stored in the cache entry " << key;
+}
+
+// private methods
+string FDCache::getPath(const string & key) const {
+    return directory + "/" + key + ".fd";
+}
+
+void FDCache::checkRep() const {
+    if (doCheckRep) {
+        assertTrue(directory.length() > 0);
+    }
+}
+
+} // namespace fd
+} // namespace core
@@ -0,0 +1,103 @@
+/*
+ * FDCache.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef CORE_FD_FDCACHE_HPP
+#define	CORE_FD_FDCACHE_HPP
+
+#include "core/features/BoolFeatureExpFactory.hpp"
+#include "core/features/FeatureExp.hpp"
+
+#include "util/Uncopyable.hpp"
+
+#include <string>
+
+namespace core {
+namespace fd {
+
+/**
+ * An FDCache is a persistent cache of the feature expressions of feature
+ * diagrams, stored as files in a directory. Each entry is identified by a key
+ * computed from the source of the feature diagram and its filter, so that a
+ * feature diagram only has to be built again once its source has changed.
+ *
+ * An entry is a sequence of 32-bit fields in native byte order:
+ *   unsigned int  magic, version, nbOfFeatures, nbOfNodes, root, stringsSize
+ *   unsigned int  featureNames[nbOfFeatures]   // offsets in strings
+ *   math::BddNode nodes[nbOfNodes]
+ *   char          strings[stringsSize]         // NUL-terminated
+ *
+ * The variable v of a BDD node is the feature featureNames[v]. The features are
+ * stored in the order of their boolean variables, and their boolean variables
+ * are created in that order when loaded, so that the variable order of the
+ * BDD is kept when its features are new.
+ *
+ * @author mwi
+ */
+class FDCache : private util::Uncopyable {
+
+private:
+    /* The directory of the entries */
+    const std::string directory;
+
+    /* The factory of the loaded feature expressions */
+    const core::features::BoolFeatureExpFactory & expFactory;
+
+    /*
+     * Representation Invariant:
+     *   I(c) = c.directory.length > 0
+     */
+
+public:
+    /**
+     * @requires directory.length > 0
+     * @effects Makes this be a cache storing its entries in the directory
+     *          'directory', created if needed, and loading them with the
+     *          factory 'expFactory'.
+     */
+    FDCache(const std::string & directory,
+            const core::features::BoolFeatureExpFactory & expFactory);
+
+    // The default destructor is fine.
+
+    /**
+     * @return the key of the feature diagram of source 'source' on which the
+     *          filter 'filter' has been applied.
+     */
+    static std::string makeKey(const std::string & source,
+            const std::string & filter);
+
+    /**
+     * @return a new feature expression for the entry 'key' of this, or null
+     *          iff this has no valid entry 'key'.
+     */
+    core::features::FeatureExp * load(const std::string & key) const;
+
+    /**
+     * @requires fd is a valid BoolFeatureExp
+     * @modifies the directory of this
+     * @effects Stores 'fd' as the entry 'key' of this. The entry is written
+     *          aside and then renamed, so that concurrent runs never load a
+     *          partial entry. Logs a warning if the entry cannot be written.
+     */
+    void store(const std::string & key,
+            const core::features::FeatureExp & fd) const;
+
+private:
+    /**
+     * @return the path of the file of the entry 'key'.
+     */
+    std::string getPath(const std::string & key) const;
+
+    /**
+     * @effects Asserts the rep invariant holds for this.
+     */
+    void checkRep() const;
+};
+
+} // namespace fd
+} // namespace core
+
+#endif	/* CORE_FD_FDCACHE_HPP */
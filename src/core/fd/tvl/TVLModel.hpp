@@ -8,12 +8,15 @@
 #define	CORE_FD_TVL_TVLMODEL_HPP
 
 #include "core/fd/FD.hpp"
+#include "core/fd/FDCache.hpp"
 
 #include "core/features/FeatureExp.hpp"
+#include "core/features/forwards.hpp"
 #include "core/features/BoolFeatureExpFactory.hpp"
 
 #include "math/BoolFctFactory.hpp"
 
+#include <istream>
 #include <string>
 
 namespace core {
@@ -21,53 +24,51 @@ namespace fd {
 namespace tvl {
 
 /**
- * A TVLModel is a TVL implementation of the FD interface.
+ * A TVLModel is a TVL implementation of the FD interface. The model is parsed
+ * in process by a TVLParser. Given an FDCache, the feature expression of the
+ * model is loaded from the cache when its source and filter are unchanged, and
+ * stored in the cache otherwise.
  *
  * @author bdawagne
  */
 class TVLModel : public core::fd::FD {
 
 private:
-    static const char* WC_PATH;
-
-    static const char* CLAUSES_PATH;
-
-    static const char* MAPPING_PATH;
-
-    static const char* COMMAND;
-
-    static const char* TVL_HOME_VAR;
-
-    char* TVLhome;
-
     std::tr1::shared_ptr<math::BoolFctFactory> & fctFactory;
     std::tr1::shared_ptr<core::features::BoolFeatureExpFactory> & expFactory;
 
+    /* The feature expression of the valid products */
+    core::features::FeatureExpPtr featureExp;
+
     /*
      * Representation Invariant
-     *   I(c) = true
+     *   I(c) = c.featureExp != null
      */
 
 public:
     /**
      * @requires 'stream' is a valid TVL model stream
-     * @effects Make this be the TVL model contained in the stream 'stream'
+     * @effects Make this be the TVL model contained in the stream 'stream',
+     *          cached in 'cache' if not null.
      */
     TVLModel(
             std::istream & stream,
             std::tr1::shared_ptr<math::BoolFctFactory> & fctFactory,
-            std::tr1::shared_ptr<core::features::BoolFeatureExpFactory> & expFactory);
+            std::tr1::shared_ptr<core::features::BoolFeatureExpFactory> & expFactory,
+            const core::fd::FDCache * cache = NULL);
 
     /**
      * @requires 'stream' is a valid TVL model stream
      * @effects Make this be the TVL model contained in the stream 'stream'
-     *          on which the filter 'filter' has been applied.
+     *          on which the filter 'filter' has been applied, cached in
+     *          'cache' if not null.
      */
     TVLModel(
             std::istream & stream,
             const std::string & filter,
             std::tr1::shared_ptr<math::BoolFctFactory> & fctFactory,
-            std::tr1::shared_ptr<core::features::BoolFeatureExpFactory> & expFactory);
+            std::tr1::shared_ptr<core::features::BoolFeatureExpFactory> & expFactory,
+            const core::fd::FDCache * cache = NULL);
 
     // Default destructor is fine
 
@@ -76,20 +77,17 @@ public:
 
 private:
     /**
-     * @effects Applies a filter to the working copy of the TVL model file.
-     */
-    void addFilter(const std::string & filter);
-
-    /**
-     * @effects Generates the clause dimacs file and the map file from the
-     *          working copy of the TVL model file.
-     */
-    void generateDimacsFiles() const;
-
-    /**
-     * @effects Creates boolean variables from the generated map file.
+     * @modifies this, cache
+     * @effects Makes the feature expression of this be the entry of 'cache'
+     *          for 'source' and 'filter', if any. Otherwise, parses the TVL
+     *          model 'source', applies the filter 'filter', i.e. a body of
+     *          constraints of the root feature, to it and stores the result in
+     *          'cache' if not null.
+     * @throws logic_error iff 'source' is not a valid TVL model or 'filter'
+     *          is not a valid feature body.
      */
-    void createBoolVars() const;
+    void load(const std::string & source, const std::string & filter,
+            const core::fd::FDCache * cache);
 
     /**
      * @effects Asserts the rep invariant holds for this.
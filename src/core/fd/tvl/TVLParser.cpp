@@ -0,0 +1,462 @@
+/*
+ * TVLParser.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "TVLParser.hpp"
+
+#include "core/features/BoolFeatureExp.hpp"
+#include "core/features/FeatureExp.hpp"
+
+#include "util/Assert.hpp"
+
+#include <cctype>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+
+using core::features::BoolFeatureExpFactory;
+using core::features::FeatureExp;
+using core::features::FeatureExpPtr;
+
+using std::logic_error;
+using std::map;
+using std::ostringstream;
+using std::string;
+using std::vector;
+
+namespace core {
+namespace fd {
+namespace tvl {
+
+namespace {
+
+/* The keywords of TVL, which cannot be feature names. */
+const char * const Keywords[] = {
+    "root", "group", "opt", "shared", "oneOf", "someOf", "allOf", "ifIn",
+    "ifOut", "true", "false", "requires", "excludes"
+};
+
+/* The keywords declaring attributes, which are not supported. */
+const char * const AttributeKeywords[] = {
+    "int", "real", "bool", "enum", "struct", "data", "const"
+};
+
+/* The operators of TVL, the longest first. */
+const char * const Operators[] = {
+    "<->", "->", "<-", "&&", "||", "..", "!", "(", ")", "{", "}", "[", "]",
+    ",", ";", ":", "*"
+};
+
+bool contains(const char * const words[], unsigned int size,
+        const string & word) {
+    for (unsigned int i = 0; i < size; ++i) {
+        if (word == words[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool isNameChar(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+} // namespace
+
+// constructors
+TVLParser::TVLParser(const string & input,
+        const BoolFeatureExpFactory & expFactory)
+        : expFactory(expFactory), tokens(), next(0), rootName(),
+          sharedParents() {
+    tokenize(input);
+
+    checkRep();
+}
+
+// public methods
+FeatureExpPtr TVLParser::parse() {
+    FeatureExpPtr result(expFactory.getTrue());
+    while (next < tokens.size()) {
+        if (accept("root")) {
+            if (!rootName.empty()) {
+                error();
+            }
+            rootName = name();
+            result->conjunction(*FeatureExpPtr(expFactory.create(rootName)));
+            result->conjunction(*feature(rootName));
+        } else {
+            result->conjunction(*feature(name()));
+        }
+    }
+    if (rootName.empty()) {
+        throw logic_error("Syntax Error: the TVL model has no root feature");
+    }
+    result->conjunction(*sharedConstraints());
+
+    checkRep();
+    return result;
+}
+
+FeatureExpPtr TVLParser::parseBody(const string & featureName) {
+    FeatureExpPtr result(body(featureName));
+    if (next < tokens.size()) {
+        error();
+    }
+    result->conjunction(*sharedConstraints());
+
+    checkRep();
+    return result;
+}
+
+const string & TVLParser::getRootName() const {
+    assertTrue(!rootName.empty());
+
+    return rootName;
+}
+
+// private methods
+void TVLParser::tokenize(const string & input) {
+    const unsigned int nbOperators = sizeof(Operators) / sizeof(Operators[0]);
+    int line = 1;
+    string::size_type i = 0;
+    while (i < input.length()) {
+        const char c = input[i];
+        if (c == '\n') {
+            ++line;
+            ++i;
+        } else if (std::isspace(static_cast<unsigned char>(c))) {
+            ++i;
+        } else if (input.compare(i, 2, "//") == 0) {
+            i = input.find('\n', i);
+            if (i == string::npos) {
+                i = input.length();
+            }
+        } else if (input.compare(i, 2, "/*") == 0) {
+            string::size_type end = input.find("*/", i + 2);
+            if (end == string::npos) {
+                throw logic_error("Syntax Error: unterminated comment in the TVL model");
+            }
+            for (; i < end; ++i) {
+                if (input[i] == '\n') {
+                    ++line;
+                }
+            }
+            i = end + 2;
+        } else if (isNameChar(c)) {
+            string::size_type begin = i;
+            while (i < input.length() && isNameChar(input[i])) {
+                ++i;
+            }
+            tokens.push_back(Token(input.substr(begin, i - begin), line));
+        } else {
+            unsigned int op = 0;
+            while (op < nbOperators && input.compare(i, string(Operators[op]).length(),
+                    Operators[op]) != 0) {
+                ++op;
+            }
+            if (op == nbOperators) {
+                ostringstream oss;
+                oss << "Syntax Error: unexpected symbol '" << c << "' at line "
+                    << line << " in the TVL model";
+                throw logic_error(oss.str());
+            }
+            tokens.push_back(Token(Operators[op], line));
+            i += string(Operators[op]).length();
+        }
+    }
+}
+
+FeatureExpPtr TVLParser::feature(const string & name) {
+    FeatureExpPtr result(expFactory.getTrue());
+    if (accept("group")) {
+        result->conjunction(*group(name));
+    }
+    if (accept("{")) {
+        result->conjunction(*body(name));
+        expect("}");
+    }
+    return result;
+}
+
+FeatureExpPtr TVLParser::body(const string & name) {
+    FeatureExpPtr result(expFactory.getTrue());
+    while (next < tokens.size() && !peek("}")) {
+        result->conjunction(*element(name));
+    }
+    return result;
+}
+
+FeatureExpPtr TVLParser::element(const string & name) {
+    const unsigned int nbAttributeKeywords =
+            sizeof(AttributeKeywords) / sizeof(AttributeKeywords[0]);
+
+    if (accept("group")) {
+        return group(name);
+    }
+    if (contains(AttributeKeywords, nbAttributeKeywords, tokens[next].text)) {
+        ostringstream oss;
+        oss << "Unsupported: attribute declared at line " << tokens[next].line
+            << " in the TVL model";
+        throw logic_error(oss.str());
+    }
+
+    FeatureExpPtr guard;
+    if (accept("ifIn")) {
+        guard.reset(expFactory.create(name));
+        expect(":");
+    } else if (accept("ifOut")) {
+        guard.reset(expFactory.create(name));
+        guard->negation();
+        expect(":");
+    }
+    FeatureExpPtr result(exp());
+    expect(";");
+    if (guard) {
+        result = implies(guard, result);
+    }
+    return result;
+}
+
+FeatureExpPtr TVLParser::group(const string & parent) {
+    int min = 0;
+    int max = 0;
+    bool anyMin = false;
+    bool anyMax = false;
+    if (accept("oneOf")) {
+        min = 1;
+        max = 1;
+    } else if (accept("someOf")) {
+        min = 1;
+        anyMax = true;
+    } else if (accept("allOf")) {
+        anyMin = true;
+        anyMax = true;
+    } else {
+        expect("[");
+        min = integer();
+        expect("..");
+        if (accept("*")) {
+            anyMax = true;
+        } else {
+            max = integer();
+        }
+        expect("]");
+    }
+
+    FeatureExpPtr result(expFactory.getTrue());
+    vector<FeatureExpPtr> mandatory;
+    expect("{");
+    do {
+        const bool optional = accept("opt");
+        const bool shared = accept("shared");
+        const string child(name());
+        FeatureExpPtr childExp(expFactory.create(child));
+        if (!optional) {
+            mandatory.push_back(FeatureExpPtr(childExp->clone()));
+        }
+        FeatureExpPtr parentExp(expFactory.create(parent));
+        if (shared) {
+            // child -> (p1 || ... || pn) is added once all groups are parsed
+            map<string, FeatureExpPtr>::iterator it = sharedParents.find(child);
+            if (it == sharedParents.end()) {
+                sharedParents[child] = parentExp;
+            } else {
+                it->second->disjunction(*parentExp);
+            }
+        } else {
+            result->conjunction(*implies(childExp, parentExp));
+        }
+        result->conjunction(*feature(child));
+    } while (accept(","));
+    expect("}");
+
+    if (anyMax) {
+        max = mandatory.size();
+    }
+    if (anyMin) {
+        min = mandatory.size();
+    }
+    result->conjunction(*implies(FeatureExpPtr(expFactory.create(parent)),
+            cardinality(mandatory, min, max)));
+    return result;
+}
+
+FeatureExpPtr TVLParser::sharedConstraints() {
+    FeatureExpPtr result(expFactory.getTrue());
+    for (map<string, FeatureExpPtr>::const_iterator it = sharedParents.begin();
+            it != sharedParents.end(); ++it) {
+        result->conjunction(*implies(
+                FeatureExpPtr(expFactory.create(it->first)), it->second));
+    }
+    sharedParents.clear();
+    return result;
+}
+
+FeatureExpPtr TVLParser::exp() {
+    FeatureExpPtr result(impliesExp());
+    while (accept("<->")) {
+        FeatureExpPtr rhs(impliesExp());
+        FeatureExpPtr converse(implies(FeatureExpPtr(rhs->clone()),
+                FeatureExpPtr(result->clone())));
+        result = implies(result, rhs);
+        result->conjunction(*converse);
+    }
+    return result;
+}
+
+FeatureExpPtr TVLParser::impliesExp() {
+    FeatureExpPtr result(orExp());
+    if (accept("->") || accept("requires")) {
+        result = implies(result, impliesExp());
+    } else if (accept("<-")) {
+        result = implies(impliesExp(), result);
+    } else if (accept("excludes")) {
+        FeatureExpPtr rhs(impliesExp());
+        rhs->negation();
+        result = implies(result, rhs);
+    }
+    return result;
+}
+
+FeatureExpPtr TVLParser::orExp() {
+    FeatureExpPtr result(andExp());
+    while (accept("||")) {
+        result->disjunction(*andExp());
+    }
+    return result;
+}
+
+FeatureExpPtr TVLParser::andExp() {
+    FeatureExpPtr result(unaryExp());
+    while (accept("&&")) {
+        result->conjunction(*unaryExp());
+    }
+    return result;
+}
+
+FeatureExpPtr TVLParser::unaryExp() {
+    FeatureExpPtr result;
+    if (accept("!")) {
+        result = unaryExp();
+        result->negation();
+    } else if (accept("(")) {
+        result = exp();
+        expect(")");
+    } else if (accept("true")) {
+        result.reset(expFactory.getTrue());
+    } else if (accept("false")) {
+        result.reset(expFactory.getFalse());
+    } else {
+        result.reset(expFactory.create(name()));
+    }
+    return result;
+}
+
+string TVLParser::name() {
+    const unsigned int nbKeywords = sizeof(Keywords) / sizeof(Keywords[0]);
+
+    if (next >= tokens.size()
+            || !isNameChar(tokens[next].text[0])
+            || std::isdigit(static_cast<unsigned char>(tokens[next].text[0]))
+            || contains(Keywords, nbKeywords, tokens[next].text)) {
+        error();
+    }
+    return tokens[next++].text;
+}
+
+int TVLParser::integer() {
+    if (next >= tokens.size()) {
+        error();
+    }
+    const string & text = tokens[next].text;
+    for (string::const_iterator it = text.begin(); it != text.end(); ++it) {
+        if (!std::isdigit(static_cast<unsigned char>(*it))) {
+            error();
+        }
+    }
+    ++next;
+    return std::atoi(text.c_str());
+}
+
+bool TVLParser::peek(const string & text) const {
+    return next < tokens.size() && tokens[next].text == text;
+}
+
+bool TVLParser::accept(const string & text) {
+    if (peek(text)) {
+        ++next;
+        return true;
+    }
+    return false;
+}
+
+void TVLParser::expect(const string & text) {
+    if (!accept(text)) {
+        error();
+    }
+}
+
+void TVLParser::error() const {
+    ostringstream oss;
+    oss << "Syntax Error: unexpected ";
+    if (next < tokens.size()) {
+        oss << "token '" << tokens[next].text << "' at line "
+            << tokens[next].line;
+    } else {
+        oss << "end";
+    }
+    oss << " in the TVL model";
+    throw logic_error(oss.str());
+}
+
+FeatureExpPtr TVLParser::implies(const FeatureExpPtr & lhs,
+        const FeatureExpPtr & rhs) {
+    FeatureExpPtr result(lhs);
+    result->negation();
+    result->disjunction(*rhs);
+    return result;
+}
+
+FeatureExpPtr TVLParser::cardinality(const vector<FeatureExpPtr> & features,
+        int min, int max) const {
+    const int size = features.size();
+    if (min > size || min > max) {
+        return FeatureExpPtr(expFactory.getFalse());
+    }
+
+    // atLeast[j] holds iff at least j of the features seen so far are selected
+    vector<FeatureExpPtr> atLeast;
+    atLeast.push_back(FeatureExpPtr(expFactory.getTrue()));
+    for (int j = 1; j <= size; ++j) {
+        atLeast.push_back(FeatureExpPtr(expFactory.getFalse()));
+    }
+    for (int i = 0; i < size; ++i) {
+        for (int j = i + 1; j >= 1; --j) {
+            FeatureExp * selected = atLeast[j - 1]->clone();
+            selected->conjunction(*FeatureExpPtr(features[i]->clone()));
+            atLeast[j]->disjunction(*FeatureExpPtr(selected));
+        }
+    }
+
+    FeatureExpPtr result(atLeast[min]);
+    if (max < size) {
+        result->conjunction(*atLeast[max + 1]->negation());
+    }
+    return result;
+}
+
+void TVLParser::checkRep() const {
+    if (doCheckRep) {
+        assertTrue(next <= tokens.size());
+        for (map<string, FeatureExpPtr>::const_iterator it =
+                sharedParents.begin(); it != sharedParents.end(); ++it) {
+            assertTrue(it->second);
+        }
+    }
+}
+
+} // namespace tvl
+} // namespace fd
+} // namespace core
@@ -0,0 +1,281 @@
+/*
+ * TVLParser.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef CORE_FD_TVL_TVLPARSER_HPP
+#define	CORE_FD_TVL_TVLPARSER_HPP
+
+#include "core/features/BoolFeatureExpFactory.hpp"
+#include "core/features/forwards.hpp"
+
+#include "util/Uncopyable.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace core {
+namespace fd {
+namespace tvl {
+
+/**
+ * TVLParser is a recursive descent parser for the Boolean fragment of the
+ * Textual Variability Language (TVL). It translates a TVL model into the
+ * feature expression of its valid products.
+ *
+ * The EBNF LL(1) grammar of the accepted TVL models is as follows:
+ *
+ *   Model: ('root'? Feature)*
+ *
+ *   Feature: NAME ('group' Group)? ('{' Body '}')?
+ *
+ *   Body: Element*
+ *
+ *   Element: 'group' Group
+ *          | ('ifIn' | 'ifOut') ':' Exp ';'
+ *          | Exp ';'
+ *
+ *   Group: Cardinality '{' Child (',' Child)* '}'
+ *
+ *   Cardinality: 'oneOf' | 'someOf' | 'allOf' | '[' INT '..' (INT | '*') ']'
+ *
+ *   Child: 'opt'? 'shared'? Feature
+ *
+ *   Exp: ImpliesExp ('<->' ImpliesExp)*
+ *
+ *   ImpliesExp: OrExp (('->' | '<-' | 'requires' | 'excludes') ImpliesExp)?
+ *
+ *   OrExp: AndExp ('||' AndExp)*
+ *
+ *   AndExp: UnaryExp ('&&' UnaryExp)*
+ *
+ *   UnaryExp: '!' UnaryExp | '(' Exp ')' | 'true' | 'false' | NAME
+ *
+ *   NAME: ('a'..'z'|'A'..'Z'|'_') ('a'..'z'|'A'..'Z'|'0'..'9'|'_')*
+ *
+ * Exactly one feature is declared 'root'. A feature declared outside a group
+ * extends the feature of the same name. The features of a group require their
+ * parent, except the 'shared' ones, which require one of the parents of the
+ * groups they are shared in. The parent of a group requires the number of non
+ * optional features of the group to be within the cardinality of the group. A
+ * constraint guarded by 'ifIn' (resp. 'ifOut') only holds when its feature is
+ * (resp. is not) selected, the other constraints always hold.
+ *
+ * Whitespaces, tabs, newlines, carriage returns and comments, i.e. '//' to the
+ * end of the line and '/ *' to '* /', are ignored. Attributes are not
+ * supported.
+ *
+ * @author mwi
+ */
+class TVLParser : private util::Uncopyable {
+
+private:
+    /* A token of the input, along with the line it starts on. */
+    struct Token {
+        std::string text;
+        int line;
+        Token(const std::string & text, int line) : text(text), line(line) {}
+    };
+
+    /* The factory of the feature expressions. */
+    const core::features::BoolFeatureExpFactory & expFactory;
+
+    /* The tokens of the input. */
+    std::vector<Token> tokens;
+
+    /* The index of the next token to parse. */
+    unsigned int next;
+
+    /* The name of the root feature, once parsed. */
+    std::string rootName;
+
+    /* The disjunction of the parents of each shared feature parsed so far. */
+    std::map<std::string, core::features::FeatureExpPtr> sharedParents;
+
+    /*
+     * Representation Invariant:
+     *   I(c) = c.next <= c.tokens.size
+     *       && forall name in c.sharedParents: c.sharedParents[name] != null
+     */
+
+public:
+    /**
+     * @effects Makes this be a new parser for the TVL input 'input', whose
+     *           feature expressions are created by 'expFactory'.
+     * @throws logic_error iff 'input' contains an unexpected character.
+     */
+    TVLParser(const std::string & input,
+            const core::features::BoolFeatureExpFactory & expFactory);
+
+    // The defaut destructor is fine.
+
+    /**
+     * @modifies this
+     * @effects Parses the input of this as a TVL model.
+     * @return the feature expression of the valid products of the model.
+     * @throws logic_error iff the input is not a valid TVL model.
+     */
+    core::features::FeatureExpPtr parse();
+
+    /**
+     * @modifies this
+     * @effects Parses the input of this as the body of the feature
+     *           'featureName'.
+     * @return the feature expression of the constraints of the body.
+     * @throws logic_error iff the input is not a valid feature body.
+     */
+    core::features::FeatureExpPtr parseBody(const std::string & featureName);
+
+    /**
+     * @requires a model has been parsed
+     * @return the name of the root feature of the parsed model.
+     */
+    const std::string & getRootName() const;
+
+private:
+    /**
+     * @modifies this
+     * @effects Splits 'input' into tokens.
+     * @throws logic_error iff 'input' contains an unexpected character.
+     */
+    void tokenize(const std::string & input);
+
+    /**
+     * @modifies this
+     * @effects Applies the Feature production rule for the feature 'name',
+     *           whose NAME has already been parsed.
+     * @return the feature expression of the constraints of the feature.
+     */
+    core::features::FeatureExpPtr feature(const std::string & name);
+
+    /**
+     * @modifies this
+     * @effects Applies the Body production rule for the feature 'name'.
+     * @return the feature expression of the constraints of the body.
+     */
+    core::features::FeatureExpPtr body(const std::string & name);
+
+    /**
+     * @modifies this
+     * @effects Applies the Element production rule for the feature 'name'.
+     * @return the feature expression of the constraint of the element.
+     */
+    core::features::FeatureExpPtr element(const std::string & name);
+
+    /**
+     * @modifies this
+     * @effects Applies the Group production rule for the parent feature
+     *           'parent', whose 'group' keyword has already been parsed.
+     * @return the feature expression of the constraints of the group.
+     */
+    core::features::FeatureExpPtr group(const std::string & parent);
+
+    /**
+     * @modifies this
+     * @effects Clears the parents of the shared features.
+     * @return the feature expression requiring each shared feature parsed so
+     *          far to have one of its parents selected.
+     */
+    core::features::FeatureExpPtr sharedConstraints();
+
+    /**
+     * @modifies this
+     * @effects Applies the Exp production rule.
+     * @return the parsed feature expression.
+     */
+    core::features::FeatureExpPtr exp();
+
+    /**
+     * @modifies this
+     * @effects Applies the ImpliesExp production rule.
+     * @return the parsed feature expression.
+     */
+    core::features::FeatureExpPtr impliesExp();
+
+    /**
+     * @modifies this
+     * @effects Applies the OrExp production rule.
+     * @return the parsed feature expression.
+     */
+    core::features::FeatureExpPtr orExp();
+
+    /**
+     * @modifies this
+     * @effects Applies the AndExp production rule.
+     * @return the parsed feature expression.
+     */
+    core::features::FeatureExpPtr andExp();
+
+    /**
+     * @modifies this
+     * @effects Applies the UnaryExp production rule.
+     * @return the parsed feature expression.
+     */
+    core::features::FeatureExpPtr unaryExp();
+
+    /**
+     * @modifies this
+     * @effects Parses a NAME which is not a keyword.
+     * @return the parsed name.
+     */
+    std::string name();
+
+    /**
+     * @modifies this
+     * @effects Parses an INT.
+     * @return the parsed integer.
+     */
+    int integer();
+
+    /**
+     * @return true iff the next token is 'text'.
+     */
+    bool peek(const std::string & text) const;
+
+    /**
+     * @modifies this
+     * @effects Parses the next token iff it is 'text'.
+     * @return true iff the next token is 'text'.
+     */
+    bool accept(const std::string & text);
+
+    /**
+     * @modifies this
+     * @effects Parses the next token.
+     * @throws logic_error iff the next token is not 'text'.
+     */
+    void expect(const std::string & text);
+
+    /**
+     * @throws logic_error reporting the next token as unexpected.
+     */
+    void error() const;
+
+    /**
+     * @return the feature expression 'lhs' -> 'rhs'.
+     */
+    static core::features::FeatureExpPtr implies(
+            const core::features::FeatureExpPtr & lhs,
+            const core::features::FeatureExpPtr & rhs);
+
+    /**
+     * @return a feature expression which holds iff the number of features of
+     *          'features' which are selected is between 'min' and 'max'.
+     */
+    core::features::FeatureExpPtr cardinality(
+            const std::vector<core::features::FeatureExpPtr> & features,
+            int min, int max) const;
+
+    /**
+     * @effects Asserts the rep invariant holds for this.
+     */
+    void checkRep() const;
+};
+
+} // namespace tvl
+} // namespace fd
+} // namespace core
+
+#endif	/* CORE_FD_TVL_TVLPARSER_HPP */
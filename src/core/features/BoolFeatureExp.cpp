@@ -107,10 +107,27 @@ string BoolFeatureExp::toString() const {
         return function->toString();
 }
 
+string BoolFeatureExp::toMinimizedString() const {
+    assertTrue(isValid());
+
+    Minimizer minimizer;
+    return toMinimizedString(minimizer);
+}
+
+string BoolFeatureExp::toMinimizedString(const Minimizer & minimizer) const {
+    assertTrue(isValid());
+
+    return minimizer.minimize(*function);
+}
+
 FeatureExp * BoolFeatureExp::clone() const {
     return new BoolFeatureExp(function->clone());
 }
 
+const BoolFct & BoolFeatureExp::getBoolFct() const {
+    return *function;
+}
+
 void BoolFeatureExp::checkRep() const {
     if(doCheckRep) {
         assertTrue(function.get());
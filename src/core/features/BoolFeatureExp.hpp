@@ -56,8 +56,16 @@ public:
     bool implies(const FeatureExp & expression) const;
     bool isValid() const;
     std::string toString() const;
+    std::string toMinimizedString() const;
+    std::string toMinimizedString(
+        const math::minimize::Minimizer & minimizer) const;
     FeatureExp * clone() const;
 
+    /**
+     * @return the boolean function representing this.
+     */
+    const math::BoolFct & getBoolFct() const;
+
     void * operator new(size_t size) {
         return memoryManager.allocate(size);
     }
@@ -16,6 +16,7 @@
 
 using math::BoolFct;
 using math::BoolFctFactory;
+using math::BoolFctStats;
 using math::BoolVar;
 
 using std::string;
@@ -47,5 +48,9 @@ BoolFeatureExp * BoolFeatureExpFactory::getFalse() const {
     return new BoolFeatureExp(functionFactory->getFalse());
 }
 
+BoolFctStats BoolFeatureExpFactory::getStats() const {
+    return functionFactory->getStats();
+}
+
 } // namespace features
 } // namespace core
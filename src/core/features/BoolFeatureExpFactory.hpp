@@ -9,6 +9,7 @@
 
 #include "forwards.hpp"
 #include "math/forwards.hpp"
+#include "math/BoolFctStats.hpp"
 
 #include "util/Uncopyable.hpp"
 
@@ -59,6 +60,12 @@ public:
      * @return an unsatisfiable boolean feature expression
      */
     BoolFeatureExp * getFalse() const;
+
+    /**
+     * @return a snapshot of the statistics of the boolean function engine
+     *          used by this.
+     */
+    math::BoolFctStats getStats() const;
 };
 
 } // namespace features
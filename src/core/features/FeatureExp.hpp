@@ -13,6 +13,12 @@
 
 #include <string>
 
+namespace math {
+namespace minimize {
+class Minimizer;
+}
+}
+
 namespace core {
 namespace features {
 
@@ -84,6 +90,21 @@ public:
      */
     virtual bool isValid() const = 0;
 
+    /**
+     * @requires this is valid
+     * @return a minimized Boolean expression equivalent to this.
+     */
+    virtual std::string toMinimizedString() const = 0;
+
+    /**
+     * @requires this is valid
+     * @modifies minimizer
+     * @return a minimized Boolean expression equivalent to this, computed by
+     *          'minimizer'.
+     */
+    virtual std::string toMinimizedString(
+        const math::minimize::Minimizer & minimizer) const = 0;
+
     // mandatory virtual destructor
     virtual ~FeatureExp() {}
 };
@@ -38,6 +38,9 @@ namespace fts {
 class PropertyAutomaton : private util::Uncopyable {
 
 public:
+    /* The component of the states on no cycle. */
+    enum { NO_COMPONENT = -1 };
+
     /**
      * @requires transition != null && transition is a valid transition leaving
      *            this.currentState
@@ -64,6 +67,21 @@ public:
      */
     virtual PropertyStatePtr getCurrentState() const = 0;
 
+    /**
+     * @return true iff this is a safety automaton, i.e., iff it accepts a run
+     *          only when the run reaches a final state, so that no accepting
+     *          cycle needs to be searched for.
+     */
+    virtual bool isSafety() const = 0;
+
+    /**
+     * @return the id of the strongly connected component of
+     *          this.currentState, or NO_COMPONENT if this.currentState is on
+     *          no cycle of this. A cycle of the product with the FTS only goes
+     *          through states of a same component.
+     */
+    virtual int getComponent() const = 0;
+
     /**
      * @return this.initialState
      */
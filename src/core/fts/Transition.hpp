@@ -28,6 +28,20 @@ public:
      */
     virtual core::features::FeatureExpPtr getFeatureExp() const = 0;
 
+    /**
+     * @return the id of the feature expression of this, or -1 if unknown.
+     *          Two transitions of the same FTS with the same non-negative id
+     *          have the same feature expression.
+     */
+    virtual int getGuardId() const = 0;
+
+    /**
+     * @return the id of the event of this, which is not negative. Two
+     *          transitions of the same FTS with the same id have the same
+     *          event.
+     */
+    virtual int getEventId() const = 0;
+
     // mandatory virtual destructor
     virtual ~Transition() {}
 };
@@ -7,7 +7,7 @@
 #ifndef CORE_FTS_FSTM_CHANGELISTENER_HPP
 #define	CORE_FTS_FSTM_CHANGELISTENER_HPP
 
-#include <string>
+#include "forwards.hpp"
 
 namespace core {
 namespace fts {
@@ -23,13 +23,14 @@ class ChangeListener {
 
 public:
     /**
-     * @requires newState.length > 0
+     * @requires newState != null
      * @modifies anything
-     * @effects Informs the state has changed to the state labeled 'newState'
-     *           in response to the event named 'newEvent'.
+     * @effects Informs the state has changed to the state 'newState' in
+     *           response to the event 'newEvent', which is null if 'newState'
+     *           is the initial state.
      */
-    virtual void stateChanged(const std::string & newState,
-        const std::string & newEvent) = 0;
+    virtual void stateChanged(const FstmStatePtr & newState,
+        const FstmEventPtr & newEvent) = 0;
 
     // mandatory virtual destructor
     virtual ~ChangeListener() {}
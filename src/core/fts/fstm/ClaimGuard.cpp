@@ -0,0 +1,151 @@
+/*
+ * ClaimGuard.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "ClaimGuard.hpp"
+
+#include "util/Assert.hpp"
+#include "util/strings.hpp"
+#include "util/parser/BoolExp.hpp"
+#include "util/parser/BoolValue.hpp"
+#include "util/parser/Var.hpp"
+
+#include <utility>
+
+using std::make_pair;
+using std::string;
+using std::vector;
+using util::parser::AndExp;
+using util::parser::BoolExp;
+using util::parser::BoolValue;
+using util::parser::NotExp;
+using util::parser::OrExp;
+using util::parser::Var;
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+const int ClaimGuard::NO_VARIABLE;
+
+const unsigned int ClaimGuard::LOCAL_STACK_SIZE;
+
+// constructors
+ClaimGuard::ClaimGuard(const BoolExp & exp, VariableTable & variables)
+        : code(), maxDepth(0) {
+    CodeGenVisitor visitor(code, variables);
+    exp.accept(visitor);
+    maxDepth = visitor.getMaxDepth();
+
+    checkRep();
+}
+
+// public methods
+bool ClaimGuard::eval(int stateVar, int eventVar) const {
+    // The stack only goes to the heap for the unusually deep guards.
+    char localStack[LOCAL_STACK_SIZE];
+    vector<char> heapStack;
+    char * stack = localStack;
+    if (maxDepth > LOCAL_STACK_SIZE) {
+        heapStack.resize(maxDepth);
+        stack = &heapStack[0];
+    }
+
+    int top = -1;
+    vector<int>::const_iterator it;
+    for (it = code.begin(); it != code.end(); ++it) {
+        switch (*it) {
+        case PUSH_FALSE:
+            stack[++top] = false;
+            break;
+        case PUSH_TRUE:
+            stack[++top] = true;
+            break;
+        case NOT:
+            stack[top] = !stack[top];
+            break;
+        case AND:
+            --top;
+            stack[top] = stack[top] && stack[top + 1];
+            break;
+        case OR:
+            --top;
+            stack[top] = stack[top] || stack[top + 1];
+            break;
+        default:
+            stack[++top] = (*it == stateVar || *it == eventVar);
+            break;
+        }
+    }
+    return stack[top];
+}
+
+int ClaimGuard::lookup(const VariableTable & variables, const string & name) {
+    string varName(name);
+    util::toLowercaseFirst(varName);
+    VariableTable::const_iterator it = variables.find(varName);
+    return it != variables.end() ? it->second : NO_VARIABLE;
+}
+
+// private methods
+void ClaimGuard::checkRep() const {
+    if (doCheckRep) {
+        int depth = 0;
+        vector<int>::const_iterator it;
+        for (it = code.begin(); it != code.end(); ++it) {
+            if (*it == AND || *it == OR) {
+                depth--;
+            } else if (*it != NOT) {
+                depth++;
+            }
+            assertTrue(depth >= 1 && depth <= (int) maxDepth);
+        }
+        assertTrue(depth == 1);
+    }
+}
+
+// code generation visitor
+ClaimGuard::CodeGenVisitor::CodeGenVisitor(vector<int> & code,
+        VariableTable & variables)
+        : code(code), variables(variables), depth(0), maxDepth(0) {}
+
+unsigned int ClaimGuard::CodeGenVisitor::getMaxDepth() const {
+    return maxDepth;
+}
+
+void ClaimGuard::CodeGenVisitor::orExp(const OrExp &) {
+    emit(OR, -1);
+}
+
+void ClaimGuard::CodeGenVisitor::andExp(const AndExp &) {
+    emit(AND, -1);
+}
+
+void ClaimGuard::CodeGenVisitor::notExp(const NotExp &) {
+    emit(NOT, 0);
+}
+
+void ClaimGuard::CodeGenVisitor::boolValue(const BoolValue & val) {
+    emit(val.getValue() ? PUSH_TRUE : PUSH_FALSE, 1);
+}
+
+void ClaimGuard::CodeGenVisitor::var(const Var & v) {
+    // Numbers the variable on its first occurrence in the never claim.
+    VariableTable::const_iterator it = variables.insert(
+            make_pair(v.getName(), (int) variables.size())).first;
+    emit(it->second, 1);
+}
+
+void ClaimGuard::CodeGenVisitor::emit(int instruction, int delta) {
+    code.push_back(instruction);
+    depth += delta;
+    if (depth > maxDepth) {
+        maxDepth = depth;
+    }
+}
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
@@ -0,0 +1,152 @@
+/*
+ * ClaimGuard.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef CORE_FTS_FSTM_CLAIMGUARD_HPP
+#define CORE_FTS_FSTM_CLAIMGUARD_HPP
+
+#include "util/parser/forwards.hpp"
+#include "util/parser/Visitor.hpp"
+
+#include <string>
+#include <tr1/unordered_map>
+#include <vector>
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+/**
+ * ClaimGuard is the guard of a never claim transition compiled into a short
+ * program in reverse Polish notation, so that it can be evaluated without
+ * walking its Boolean expression.
+ *
+ * The variables of the guards of a never claim are numbered from 0 by a
+ * variable table shared by these guards. A variable of a guard holds iff it
+ * is named after the current state or the last event of the FSTM, the first
+ * letter being lowercase (see FstmEvalVisitor). The evaluation context of a
+ * guard is thus the pair of the numbers of the variables named after the
+ * current state and the last event, if any.
+ *
+ * @author mwi
+ */
+class ClaimGuard {
+
+public:
+    /* Maps the names of the variables to their numbers. */
+    typedef std::tr1::unordered_map<std::string, int> VariableTable;
+
+    /* The number of a variable that is not in a variable table. */
+    static const int NO_VARIABLE = -1;
+
+private:
+    /* The instructions. A non-negative instruction pushes the value of the
+     * variable with that number, the others are opcodes. */
+    enum OpCode {
+        PUSH_FALSE = -1,
+        PUSH_TRUE = -2,
+        NOT = -3,
+        AND = -4,
+        OR = -5
+    };
+
+    /* The depth of the evaluation stacks kept on the call stack of eval. */
+    static const unsigned int LOCAL_STACK_SIZE = 64;
+
+    std::vector<int> code;
+    /* The maximal depth of the evaluation stack reached by code. */
+    unsigned int maxDepth;
+
+    /*
+     * Abstraction Function:
+     *   AF(c) = guard g such that
+     *     g.exp is the Boolean expression in reverse Polish notation c.code
+     *
+     * Representation Invariant:
+     *   I(c) = c.code is a valid program that leaves one value on a stack of
+     *     depth c.maxDepth
+     */
+
+public:
+    /**
+     * @modifies variables
+     * @effects Makes this be the guard 'exp' compiled with the variable table
+     *           'variables', to which the variables of 'exp' are added.
+     */
+    ClaimGuard(const util::parser::BoolExp & exp, VariableTable & variables);
+
+    // The default destructor, copy constructor and assignment are fine.
+
+    /**
+     * @return the value of this when the variables with numbers 'stateVar'
+     *          and 'eventVar' hold and all the other variables do not. Any of
+     *          them may be NO_VARIABLE. Each call evaluates this on its own
+     *          stack, so that this can be evaluated concurrently.
+     */
+    bool eval(int stateVar, int eventVar) const;
+
+    /**
+     * @return the number of the variable named after the FSTM state or event
+     *          named 'name' in 'variables', or NO_VARIABLE if there is none.
+     */
+    static int lookup(const VariableTable & variables,
+        const std::string & name);
+
+private:
+    /**
+     * @effects Asserts the rep invariant holds for this.
+     */
+    void checkRep() const;
+
+    /**
+     * Visitor that appends the instructions of the Boolean expressions it
+     * visits to a program.
+     */
+    class CodeGenVisitor : public util::parser::Visitor {
+
+    private:
+        std::vector<int> & code;
+        VariableTable & variables;
+        /* The current and the maximal depths of the evaluation stack. */
+        unsigned int depth;
+        unsigned int maxDepth;
+
+    public:
+        /**
+         * @effects Makes this be a new visitor appending to 'code' and
+         *           numbering the variables with 'variables'.
+         */
+        CodeGenVisitor(std::vector<int> & code, VariableTable & variables);
+
+        // The default destructor is fine.
+
+        /**
+         * @return the maximal depth of the evaluation stack of the generated
+         *          program.
+         */
+        unsigned int getMaxDepth() const;
+
+        // overridden methods
+        void orExp(const util::parser::OrExp & exp);
+        void andExp(const util::parser::AndExp & exp);
+        void notExp(const util::parser::NotExp & exp);
+        void boolValue(const util::parser::BoolValue & val);
+        void var(const util::parser::Var & v);
+
+    private:
+        /**
+         * @modifies this
+         * @effects Appends 'instruction' to the program, which changes the
+         *           depth of the evaluation stack by 'delta'.
+         */
+        void emit(int instruction, int delta);
+    }; // end CodeGenVisitor
+};
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
+
+#endif /* CORE_FTS_FSTM_CLAIMGUARD_HPP */
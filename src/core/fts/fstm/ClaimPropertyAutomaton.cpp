@@ -8,33 +8,50 @@
 
 #include "ClaimPropertyState.hpp"
 #include "ClaimPropertyTransition.hpp"
-#include "FstmEvalVisitor.hpp"
+#include "FstmEvent.hpp"
+#include "FstmState.hpp"
+#include "FstmTransition.hpp"
+#include "TransitionTable.hpp"
 
+#include "neverclaim/ClaimState.hpp"
+#include "neverclaim/ClaimTransition.hpp"
 #include "neverclaim/NeverClaim.hpp"
 
 #include "util/Assert.hpp"
-#include "util/Stack.hpp"
 
-#include "util/parser/EvalVisitor.hpp"
 #include "util/parser/BoolExp.hpp"
+#include "util/parser/BoolValue.hpp"
+#include "util/parser/OrExp.hpp"
 
 #include <glog/logging.h>
 
+#include <algorithm>
+#include <map>
+#include <set>
+#include <tr1/unordered_map>
+#include <tr1/unordered_set>
 #include <utility>
 
-using neverclaim::ClaimState;
 using neverclaim::ClaimStatePtr;
+using neverclaim::ClaimTransition;
 using neverclaim::ClaimTransitionGeneratorPtr;
+using neverclaim::ClaimTransitionPtr;
 using neverclaim::NeverClaim;
 
+using util::parser::BoolExp;
+using util::parser::BoolValue;
+using util::parser::OrExp;
+
 using std::make_pair;
+using std::map;
 using std::pair;
+using std::set;
 using std::string;
 using std::vector;
 using std::tr1::dynamic_pointer_cast;
 using std::tr1::shared_ptr;
-
-using util::parser::EvalVisitor;
+using std::tr1::unordered_map;
+using std::tr1::unordered_set;
 
 namespace core {
 namespace fts {
@@ -42,12 +59,24 @@ namespace fstm {
 
 // constructors
 ClaimPropertyAutomaton::ClaimPropertyAutomaton(const string & ltl,
-        const string & curFtsState)
-        : neverClaim(NeverClaim::create(ltl)), currentFtsState(curFtsState),
-          currentFtsEvent(), currentState(neverClaim->getInitialState()),
-          executables(), nextIndex(0), fetchedIndex(), snapshots() {
-
-    executables.reset(getExecutables(*currentState));
+        const FstmStatePtr & curFtsState, const TransitionTablePtr & model)
+        : neverClaim(NeverClaim::create(ltl)), claimStates(), transitions(),
+          targets(), guards(), variables(), stateVariables(),
+          eventVariables(), offsets(), components(), safety(true),
+          currentFtsState(ClaimGuard::NO_VARIABLE),
+          currentFtsEvent(ClaimGuard::NO_VARIABLE), currentState(0),
+          nextIndex(0), fetchedIndex(), snapshots() {
+    assertTrue(curFtsState);
+
+    initTables();
+    if (model) {
+        reduce(*model);
+    }
+    initComponents();
+    LOG(INFO) << "Never claim of a " << (safety ? "safety" : "liveness")
+              << " property";
+    currentFtsState = lookup(stateVariables, curFtsState->getId(),
+            curFtsState->getName());
 
     checkRep();
 }
@@ -58,16 +87,17 @@ void ClaimPropertyAutomaton::apply(const PropertyTransitionPtr & transition) {
             dynamic_pointer_cast<ClaimPropertyTransition>(transition);
 
     assertTrue(t);
-    assertTrue(currentState == t->getSource());
+    assertTrue(claimStates[currentState] == t->getSource());
 
-    snapshots.push(SnapshotPtr(new Snapshot(t, executables, nextIndex)));
+    const unsigned int applied = indexOf(t);
+    snapshots.push(Snapshot(applied, nextIndex));
 
-    currentState = t->getTarget();
-    executables.reset(getExecutables(*currentState));
-    nextIndex = 0;
+    currentState = targets[applied];
+    nextIndex = offsets[currentState];
     fetchedIndex.unset();
 
-    DVLOG(5) << "current state changed to " << currentState->getLabel();
+    DVLOG(5) << "current state changed to "
+             << claimStates[currentState]->getLabel();
 
     checkRep();
 }
@@ -75,23 +105,30 @@ void ClaimPropertyAutomaton::apply(const PropertyTransitionPtr & transition) {
 PropertyTransitionPtr ClaimPropertyAutomaton::revert() {
     assertTrue(!isInitialState());
 
-    SnapshotPtr snapshot = snapshots.pop();
+    const Snapshot snapshot = snapshots.pop();
 
-    currentState = snapshot->applied->getSource();
-    executables = snapshot->executables;
-    nextIndex = snapshot->nextIndex;
+    currentState = snapshots.empty() ? 0 : targets[snapshots.peek().applied];
+    nextIndex = snapshot.nextIndex;
     fetchedIndex.unset();
 
     checkRep();
-    return snapshot->applied;
+    return transitions[snapshot.applied];
 }
 
 PropertyStatePtr ClaimPropertyAutomaton::getCurrentState() const {
-    return ClaimPropertyState::makePropertyState(currentState);
+    return ClaimPropertyState::makePropertyState(claimStates[currentState]);
+}
+
+bool ClaimPropertyAutomaton::isSafety() const {
+    return safety;
+}
+
+int ClaimPropertyAutomaton::getComponent() const {
+    return components[currentState];
 }
 
 bool ClaimPropertyAutomaton::isInitialState() const {
-    return snapshots.count() <= 0;
+    return snapshots.empty();
 }
 
 bool ClaimPropertyAutomaton::hasNextTransition() const {
@@ -106,41 +143,415 @@ PropertyTransitionPtr ClaimPropertyAutomaton::nextTransition() {
     fetchedIndex.unset();
 
     checkRep();
-    return executables->at(i);
+    return transitions[i];
 }
 
 void ClaimPropertyAutomaton::resetTransitions() {
-    nextIndex = 0;
+    nextIndex = offsets[currentState];
     fetchedIndex.unset();
 
     checkRep();
 }
 
-void ClaimPropertyAutomaton::stateChanged(const string & newState,
-        const string & newEvent) {
-    assertTrue(newState.length() > 0);
+void ClaimPropertyAutomaton::stateChanged(const FstmStatePtr & newState,
+        const FstmEventPtr & newEvent) {
+    assertTrue(newState);
 
-    currentFtsState = newState;
-    currentFtsEvent = newEvent;
+    currentFtsState = lookup(stateVariables, newState->getId(),
+            newState->getName());
+    currentFtsEvent = !newEvent ? ClaimGuard::NO_VARIABLE : lookup(
+            eventVariables, newEvent->getId(), newEvent->getName());
 
     fetchedIndex.unset();
 
     checkRep();
 }
 
+unsigned int ClaimPropertyAutomaton::getNbOfClaimStates() const {
+    return claimStates.size();
+}
+
+ClaimStatePtr ClaimPropertyAutomaton::getClaimState(unsigned int id) const {
+    assertTrue(id < claimStates.size());
+
+    return claimStates[id];
+}
+
+unsigned int ClaimPropertyAutomaton::firstIndexOf(unsigned int id) const {
+    assertTrue(id < claimStates.size());
+
+    return offsets[id];
+}
+
+unsigned int ClaimPropertyAutomaton::endIndexOf(unsigned int id) const {
+    assertTrue(id < claimStates.size());
+
+    return offsets[id + 1];
+}
+
+unsigned int ClaimPropertyAutomaton::getTargetOf(unsigned int index) const {
+    assertTrue(index < targets.size());
+
+    return targets[index];
+}
+
+int ClaimPropertyAutomaton::getComponentOf(unsigned int id) const {
+    assertTrue(id < claimStates.size());
+
+    return components[id];
+}
+
+const ClaimGuard & ClaimPropertyAutomaton::getGuardOf(unsigned int index)
+        const {
+    assertTrue(index < guards.size());
+
+    return guards[index];
+}
+
+int ClaimPropertyAutomaton::getVariable(const string & name) const {
+    return ClaimGuard::lookup(variables, name);
+}
+
 // private methods
-vector<ClaimPropertyTransitionPtr> *
-ClaimPropertyAutomaton::getExecutables(const ClaimState & state) const {
-    vector<ClaimPropertyTransitionPtr> * transitions =
-            new vector<ClaimPropertyTransitionPtr>();
+void ClaimPropertyAutomaton::initTables() {
+    unordered_map<string, unsigned int> ids;
+    claimStates.push_back(neverClaim->getInitialState());
+    ids.insert(make_pair(claimStates[0]->getLabel(), 0u));
+
+    // The states are numbered in breadth-first order.
+    for (unsigned int id = 0; id < claimStates.size(); id++) {
+        offsets.push_back(transitions.size());
+
+        ClaimTransitionGeneratorPtr g =
+                neverClaim->executables(*claimStates[id]);
+        while (g->hasNext()) {
+            ClaimPropertyTransitionPtr t(
+                    new ClaimPropertyTransition(g->next()));
+            pair<unordered_map<string, unsigned int>::iterator, bool> target =
+                    ids.insert(make_pair(t->getTarget()->getLabel(),
+                            (unsigned int) claimStates.size()));
+            if (target.second) {
+                claimStates.push_back(t->getTarget());
+            }
+            transitions.push_back(t);
+            targets.push_back(target.first->second);
+            guards.push_back(ClaimGuard(*t->getBoolExp(), variables));
+        }
+    }
+    offsets.push_back(transitions.size());
+}
+
+vector<ClaimPropertyAutomaton::Letter> ClaimPropertyAutomaton::lettersOf(
+        const TransitionTable & model) {
+    set<Letter> letters;
+    const FstmStatePtr initialState = model.getInitialState();
+    letters.insert(Letter(lookup(stateVariables, initialState->getId(),
+            initialState->getName()), ClaimGuard::NO_VARIABLE));
+
+    // The ids of the states are shared by all the FSTMs of the process.
+    unordered_set<unsigned int> visited;
+    vector<FstmStatePtr> pending(1, initialState);
+    visited.insert(initialState->getId());
+    while (!pending.empty()) {
+        const FstmStatePtr state = pending.back();
+        pending.pop_back();
+        const unsigned int end = model.endIndexOf(*state);
+        for (unsigned int i = model.firstIndexOf(*state); i < end; i++) {
+            const FstmTransitionPtr & t = model.getTransition(i);
+            const FstmStatePtr target = t->getTarget();
+            const FstmEventPtr event = t->getEvent();
+            letters.insert(Letter(lookup(stateVariables, target->getId(),
+                    target->getName()), !event ? ClaimGuard::NO_VARIABLE
+                    : lookup(eventVariables, event->getId(),
+                            event->getName())));
+            if (visited.insert(target->getId()).second) {
+                pending.push_back(target);
+            }
+        }
+    }
+    return vector<Letter>(letters.begin(), letters.end());
+}
 
-    ClaimTransitionGeneratorPtr g = neverClaim->executables(state);
-    while (g->hasNext()) {
-        ClaimPropertyTransitionPtr t(new ClaimPropertyTransition(g->next()));
-        transitions->push_back(t);
+void ClaimPropertyAutomaton::reduce(const TransitionTable & model) {
+    assertTrue(snapshots.empty());
+
+    const unsigned int nbOfStates = claimStates.size();
+    const unsigned int nbOfTransitions = transitions.size();
+    const vector<Letter> letters = lettersOf(model);
+    const LetterSet none(letters.size(), false);
+
+    // The letters for which the guard of each transition holds
+    vector<LetterSet> enabling(nbOfTransitions, none);
+    for (unsigned int i = 0; i < nbOfTransitions; i++) {
+        for (unsigned int l = 0; l < letters.size(); l++) {
+            enabling[i][l] = guards[i].eval(letters[l].first,
+                    letters[l].second);
+        }
+    }
+    const vector<bool> useful = findUseful(enabling);
+    if (!useful[0]) {
+        // The claim accepts no run of the FSTM.
+        LOG(INFO) << "Never claim reduced from " << nbOfStates << " states and "
+                  << nbOfTransitions << " transitions to 1 state";
+        claimStates.resize(1);
+        transitions.clear();
+        targets.clear();
+        guards.clear();
+        offsets.assign(2, 0);
+        return;
     }
 
-    return transitions;
+    /* The states are first partitioned according to whether they are final
+     * and accepting, each useless state being alone. The partition is then
+     * refined until the states of each block have the same letters to each
+     * block. */
+    typedef map<unsigned int, LetterSet> Signature;
+    vector<unsigned int> blocks(nbOfStates);
+    vector<Signature> signatures(nbOfStates);
+    for (unsigned int q = 0; q < nbOfStates; q++) {
+        blocks[q] = !useful[q] ? 3 + q : (claimStates[q]->isFinal() ? 2
+                : (claimStates[q]->isAccepting() ? 1 : 0));
+    }
+    unsigned int nbOfBlocks = 0;
+    while (true) {
+        map<pair<unsigned int, Signature>, unsigned int> ids;
+        vector<unsigned int> refined(nbOfStates);
+        for (unsigned int q = 0; q < nbOfStates; q++) {
+            Signature & signature = signatures[q];
+            signature.clear();
+            for (unsigned int i = offsets[q]; i < offsets[q + 1]; i++) {
+                if (!useful[targets[i]] || enabling[i] == none) {
+                    continue;
+                }
+                LetterSet & set = signature.insert(make_pair(
+                        blocks[targets[i]], none)).first->second;
+                for (unsigned int l = 0; l < letters.size(); l++) {
+                    set[l] = set[l] || enabling[i][l];
+                }
+            }
+            refined[q] = ids.insert(make_pair(make_pair(blocks[q], signature),
+                    (unsigned int) ids.size())).first->second;
+        }
+        blocks.swap(refined);
+        if (ids.size() == nbOfBlocks) {
+            break;
+        }
+        nbOfBlocks = ids.size();
+    }
+
+    // The first state of each block represents it.
+    vector<int> representatives(nbOfBlocks, -1);
+    for (unsigned int q = 0; q < nbOfStates; q++) {
+        if (representatives[blocks[q]] < 0) {
+            representatives[blocks[q]] = q;
+        }
+    }
+
+    /* The blocks reachable from the initial one are numbered in breadth-first
+     * order. The transitions from a representative to a same block are merged
+     * into one, in the order of their first transition. */
+    const LetterSet all(letters.size(), true);
+    vector<int> ids(nbOfBlocks, -1);
+    vector<unsigned int> order(1, blocks[0]);
+    ids[blocks[0]] = 0;
+    vector<ClaimStatePtr> reducedStates;
+    vector<ClaimPropertyTransitionPtr> reducedTransitions;
+    vector<unsigned int> reducedTargets;
+    vector<ClaimGuard> reducedGuards;
+    vector<unsigned int> reducedOffsets;
+    for (unsigned int b = 0; b < order.size(); b++) {
+        const unsigned int q = representatives[order[b]];
+        reducedStates.push_back(claimStates[q]);
+        reducedOffsets.push_back(reducedTransitions.size());
+
+        vector<unsigned int> targetBlocks;
+        map<unsigned int, vector<unsigned int> > members;
+        for (unsigned int i = offsets[q]; i < offsets[q + 1]; i++) {
+            if (!useful[targets[i]] || enabling[i] == none) {
+                continue;
+            }
+            vector<unsigned int> & merged = members[blocks[targets[i]]];
+            if (merged.empty()) {
+                targetBlocks.push_back(blocks[targets[i]]);
+            }
+            merged.push_back(i);
+        }
+
+        for (unsigned int t = 0; t < targetBlocks.size(); t++) {
+            const unsigned int block = targetBlocks[t];
+            const vector<unsigned int> & merged = members[block];
+            if (ids[block] < 0) {
+                ids[block] = order.size();
+                order.push_back(block);
+            }
+            const unsigned int i = merged[0];
+            const ClaimStatePtr & target = claimStates[representatives[block]];
+            reducedTargets.push_back(ids[block]);
+            if (merged.size() == 1 && (int) targets[i] == representatives[block]
+                    && signatures[q][block] != all) {
+                reducedTransitions.push_back(transitions[i]);
+                reducedGuards.push_back(guards[i]);
+                continue;
+            }
+
+            shared_ptr<BoolExp> exp;
+            if (signatures[q][block] == all) {
+                exp.reset(new BoolValue(true));
+            } else {
+                exp = transitions[i]->getBoolExp();
+                for (unsigned int m = 1; m < merged.size(); m++) {
+                    exp.reset(new OrExp(exp,
+                            transitions[merged[m]]->getBoolExp()));
+                }
+            }
+            reducedTransitions.push_back(ClaimPropertyTransitionPtr(
+                    new ClaimPropertyTransition(ClaimTransitionPtr(
+                            new ClaimTransition(claimStates[q]->getLabel(),
+                                    target->getLabel(), exp)))));
+            reducedGuards.push_back(ClaimGuard(*exp, variables));
+        }
+    }
+    reducedOffsets.push_back(reducedTransitions.size());
+
+    LOG(INFO) << "Never claim reduced from " << nbOfStates << " states and "
+              << nbOfTransitions << " transitions to " << reducedStates.size()
+              << " states and " << reducedTransitions.size() << " transitions";
+
+    claimStates.swap(reducedStates);
+    transitions.swap(reducedTransitions);
+    targets.swap(reducedTargets);
+    guards.swap(reducedGuards);
+    offsets.swap(reducedOffsets);
+}
+
+vector<bool> ClaimPropertyAutomaton::findUseful(
+        const vector<LetterSet> & enabling) const {
+    const unsigned int nbOfStates = claimStates.size();
+    vector<vector<unsigned int> > successors(nbOfStates);
+    vector<vector<unsigned int> > predecessors(nbOfStates);
+    for (unsigned int q = 0; q < nbOfStates; q++) {
+        for (unsigned int i = offsets[q]; i < offsets[q + 1]; i++) {
+            if (std::find(enabling[i].begin(), enabling[i].end(), true)
+                    != enabling[i].end()) {
+                successors[q].push_back(targets[i]);
+                predecessors[targets[i]].push_back(q);
+            }
+        }
+    }
+
+    /* The final states and the accepting states on a cycle are useful, as
+     * well as the states from which they are reachable. */
+    vector<bool> useful(nbOfStates, false);
+    vector<unsigned int> pending;
+    for (unsigned int q = 0; q < nbOfStates; q++) {
+        if (claimStates[q]->isFinal() || (claimStates[q]->isAccepting()
+                && isOnCycle(q, successors))) {
+            useful[q] = true;
+            pending.push_back(q);
+        }
+    }
+    while (!pending.empty()) {
+        const unsigned int q = pending.back();
+        pending.pop_back();
+        for (unsigned int p = 0; p < predecessors[q].size(); p++) {
+            if (!useful[predecessors[q][p]]) {
+                useful[predecessors[q][p]] = true;
+                pending.push_back(predecessors[q][p]);
+            }
+        }
+    }
+    return useful;
+}
+
+bool ClaimPropertyAutomaton::isOnCycle(unsigned int id,
+        const vector<vector<unsigned int> > & successors) const {
+    // Never claims are small, so each cycle is searched for separately.
+    vector<bool> visited(claimStates.size(), false);
+    vector<unsigned int> pending(successors[id]);
+    while (!pending.empty()) {
+        const unsigned int q = pending.back();
+        pending.pop_back();
+        if (q == id) {
+            return true;
+        }
+        if (!visited[q]) {
+            visited[q] = true;
+            pending.insert(pending.end(), successors[q].begin(),
+                    successors[q].end());
+        }
+    }
+    return false;
+}
+
+void ClaimPropertyAutomaton::initComponents() {
+    const unsigned int nbOfStates = claimStates.size();
+    vector<vector<unsigned int> > successors(nbOfStates);
+    for (unsigned int q = 0; q < nbOfStates; q++) {
+        successors[q].assign(targets.begin() + offsets[q],
+                targets.begin() + offsets[q + 1]);
+    }
+
+    // reachable[q][p] iff p is reachable from q through one transition or more
+    vector<vector<bool> > reachable(nbOfStates,
+            vector<bool>(nbOfStates, false));
+    for (unsigned int q = 0; q < nbOfStates; q++) {
+        vector<unsigned int> pending(successors[q]);
+        while (!pending.empty()) {
+            const unsigned int p = pending.back();
+            pending.pop_back();
+            if (!reachable[q][p]) {
+                reachable[q][p] = true;
+                pending.insert(pending.end(), successors[p].begin(),
+                        successors[p].end());
+            }
+        }
+    }
+
+    /* Each component is numbered after its smallest state. Never claims are
+     * small, so the quadratic closure above is cheap. */
+    components.assign(nbOfStates, NO_COMPONENT);
+    safety = true;
+    for (unsigned int q = 0; q < nbOfStates; q++) {
+        if (!reachable[q][q]) {
+            continue;
+        }
+        unsigned int p = 0;
+        while (!reachable[q][p] || !reachable[p][q]) {
+            p++;
+        }
+        components[q] = p;
+        if (claimStates[q]->isAccepting() && !claimStates[q]->isFinal()) {
+            safety = false;
+        }
+    }
+}
+
+unsigned int ClaimPropertyAutomaton::indexOf(const ClaimPropertyTransitionPtr &
+        transition) const {
+    // The applied transition is usually the last one fetched.
+    if (nextIndex > offsets[currentState]
+            && transitions[nextIndex - 1] == transition) {
+        return nextIndex - 1;
+    }
+
+    unsigned int index = offsets[currentState];
+    const unsigned int end = offsets[currentState + 1];
+    while (index < end && transitions[index] != transition) {
+        index++;
+    }
+    assertTrue(index < end);
+    return index;
+}
+
+int ClaimPropertyAutomaton::lookup(vector<int> & ftsVariables, unsigned int id,
+        const string & name) {
+    if (id >= ftsVariables.size()) {
+        ftsVariables.resize(id + 1, UNKNOWN_VARIABLE);
+    }
+    if (ftsVariables[id] == UNKNOWN_VARIABLE) {
+        ftsVariables[id] = ClaimGuard::lookup(variables, name);
+    }
+    return ftsVariables[id];
 }
 
 int ClaimPropertyAutomaton::getNextTransitionIndex() const {
@@ -148,11 +559,9 @@ int ClaimPropertyAutomaton::getNextTransitionIndex() const {
         return fetchedIndex.get();
     }
 
-    FstmEvalVisitor visitor(currentFtsState, currentFtsEvent);
-    for (unsigned int i = nextIndex; i < executables->size(); i++) {
-        visitor.reset();
-        executables->at(i)->getBoolExp()->accept(visitor);
-        if (visitor.isTrue()) {
+    const unsigned int end = offsets[currentState + 1];
+    for (unsigned int i = nextIndex; i < end; i++) {
+        if (guards[i].eval(currentFtsState, currentFtsEvent)) {
             fetchedIndex.set(i);
             return i;
         }
@@ -163,14 +572,19 @@ int ClaimPropertyAutomaton::getNextTransitionIndex() const {
 void ClaimPropertyAutomaton::checkRep() const {
     if (doCheckRep) {
         assertTrue(neverClaim);
-        assertTrue(currentFtsState.length() > 0);
-        assertTrue(currentState);
-        assertTrue(executables);
-        assertTrue(nextIndex <= executables->size());
+        assertTrue(claimStates.size() > 0);
+        assertTrue(claimStates[0] == neverClaim->getInitialState());
+        assertTrue(transitions.size() == targets.size());
+        assertTrue(transitions.size() == guards.size());
+        assertTrue(offsets.size() == claimStates.size() + 1);
+        assertTrue(components.size() == claimStates.size());
+        assertTrue(currentState < claimStates.size());
+        assertTrue(offsets[currentState] <= nextIndex);
+        assertTrue(nextIndex <= offsets[currentState + 1]);
         if (snapshots.count() > 0) {
-            assertTrue(currentState == snapshots.peek()->applied->getTarget());
+            assertTrue(currentState == targets[snapshots.peek().applied]);
         } else {
-            assertTrue(currentState == neverClaim->getInitialState());
+            assertTrue(currentState == 0);
         }
     }
 }
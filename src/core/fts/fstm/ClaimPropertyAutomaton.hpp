@@ -9,10 +9,12 @@
 
 #include "forwards.hpp"
 #include "ChangeListener.hpp"
+#include "ClaimGuard.hpp"
 #include "core/fts/PropertyAutomaton.hpp"
 #include "neverclaim/forwards.hpp"
-#include "util/Stack.hpp"
+#include "util/ArrayStack.hpp"
 
+#include <utility>
 #include <vector>
 
 namespace core {
@@ -23,28 +25,50 @@ namespace fstm {
  * ClaimPropertyAutomaton is an implementation of the PropertyAutomaton
  * interface that wraps a never claim automaton.
  *
+ * When the FSTM of the property is given, the never claim is reduced against
+ * the letters the FSTM can actually produce, i.e., the pairs of a reachable
+ * state and of the event leading to it. The transitions whose guard holds for
+ * none of these letters are removed, as well as the states from which neither
+ * an accepting cycle nor the final state can be reached. The bisimilar states
+ * are then merged, the transitions between two same states being merged into
+ * one whose guard is the disjunction of theirs, or true if it holds for all
+ * the letters. The reduced claim accepts the same runs of the FSTM.
+ *
+ * The claim is a safety claim when no accepting state but the final ones is
+ * on a cycle, in which case the runs it accepts are the ones reaching a final
+ * state. Otherwise, the strongly connected components of the claim tell from
+ * which states an accepting cycle can be closed.
+ *
  * @author mwi
  */
 class ClaimPropertyAutomaton : public PropertyAutomaton, public ChangeListener {
 
 private:
-    typedef std::tr1::shared_ptr<std::vector<ClaimPropertyTransitionPtr> >
-        ClaimPropertyTransitionVectorPtr;
-
     /**
      * Snapshots capture the context of this and allow it to be reverted.
+     * They are plain values stored contiguously in the undo stack, so that
+     * applying and reverting a transition allocates nothing.
      */
     struct Snapshot {
-        ClaimPropertyTransitionPtr applied;
-        ClaimPropertyTransitionVectorPtr executables;
+        /* The index of the applied transition in transitions. */
+        unsigned int applied;
+        /* The value of nextIndex before the transition was applied. */
         unsigned int nextIndex;
 
-        Snapshot(const ClaimPropertyTransitionPtr & applied,
-            const ClaimPropertyTransitionVectorPtr & execs,
-            unsigned int nextIndex)
-            : applied(applied), executables(execs), nextIndex(nextIndex) {}
+        Snapshot(unsigned int applied, unsigned int nextIndex)
+            : applied(applied), nextIndex(nextIndex) {}
     }; // end Snapshot
 
+    /* The number of a variable not computed yet. */
+    enum { UNKNOWN_VARIABLE = ClaimGuard::NO_VARIABLE - 1 };
+
+    /* A letter is the pair of the numbers of the variables named after an
+     * FSTM state and after the event leading to it. */
+    typedef std::pair<int, int> Letter;
+
+    /* A set of letters, as a mask over a sequence of letters. */
+    typedef std::vector<bool> LetterSet;
+
     /**
      * IndexCache is a cache for an index.
      */
@@ -60,21 +84,43 @@ private:
         bool isSet() const { return index != UNSET_INDEX; }
     };
 
-    typedef std::tr1::shared_ptr<Snapshot> SnapshotPtr;
-
     /* The never claim used by this. */
     const neverclaim::NeverClaimPtr neverClaim;
-    /* The current state of the coupled FTS. Updated on stateChanged events. */
-    std::string currentFtsState;
-    /* The event of the last transition fired of the coupled FTS. Updated on
-     * stateChanged events. */
-    std::string currentFtsEvent;
-
-    /* The current state of this. */
-    neverclaim::ClaimStatePtr currentState;
-    /* All the executable transitions leaving currentState. */
-    ClaimPropertyTransitionVectorPtr executables;
-    /* The next index of executables to consider. */
+    /* The states of the never claim reachable from its initial state, indexed
+     * by their ids. The initial state has id 0. */
+    std::vector<neverclaim::ClaimStatePtr> claimStates;
+    /* The transitions of the never claim, grouped by source state. */
+    std::vector<ClaimPropertyTransitionPtr> transitions;
+    /* The id of the target state of each transition of transitions. */
+    std::vector<unsigned int> targets;
+    /* The compiled guard of each transition of transitions. */
+    std::vector<ClaimGuard> guards;
+    /* Numbers the variables of the guards. */
+    ClaimGuard::VariableTable variables;
+    /* The number of the variable named after each FSTM state and event,
+     * indexed by their ids, computed on demand. */
+    std::vector<int> stateVariables;
+    std::vector<int> eventVariables;
+    /* The transitions leaving the state with id i are at the indexes
+     * offsets[i] to offsets[i + 1] - 1 of transitions. */
+    std::vector<unsigned int> offsets;
+    /* The id of the strongly connected component of each claim state, which
+     * is the smallest id of its states, or NO_COMPONENT for the states on no
+     * cycle. */
+    std::vector<int> components;
+    /* True iff no accepting state but the final ones is on a cycle. */
+    bool safety;
+
+    /* The number of the variable named after the current state of the coupled
+     * FTS. Updated on stateChanged events. */
+    int currentFtsState;
+    /* The number of the variable named after the event of the last transition
+     * fired of the coupled FTS. Updated on stateChanged events. */
+    int currentFtsEvent;
+
+    /* The id of the current state of this. */
+    unsigned int currentState;
+    /* The next index of transitions to consider. */
     unsigned int nextIndex;
 
     /* Fetched index, used to avoid repeating computations. It is unset each
@@ -82,40 +128,50 @@ private:
     mutable IndexCache fetchedIndex;
 
     /* Snapshots of the previous internal states (if any). */
-    util::Stack<SnapshotPtr> snapshots;
+    util::ArrayStack<Snapshot> snapshots;
 
     /*
      * Abstraction Function:
      *   AF(c) = property automaton a such that
-     *     a.currentFtsState = c.currentFtsState
-     *     a.currentState = c.currentState
+     *     a.currentFtsState = the state after which c.currentFtsState is
+     *       named
+     *     a.currentState = c.claimStates[c.currentState]
      *     a.initialState = (c.snapshots.size == 0)
-     *     a.transitions = [ti,...,tn] sublist of c.executables such that
+     *     a.transitions = [ti,...,tn] sublist of c.transitions such that
      *       each ti is a PropertyTransition satisfying c.currentFtsState and
      *       i = c.nextIndex and
-     *       n = c.executables.size - 1 and
-     *       i <= n
+     *       n = c.offsets[c.currentState + 1] - 1 and
+     *       i <= n + 1
      *
      * Representation Invariant:
      *   I(c) = c.neverClaim != null
-     *     c.currentFtsState.length > 0
-     *     c.currentState != null
-     *     c.executables != null
-     *     0 <= c.nextIndex <= c.executables.size
-     *     (c.snapshots.size = 0) => c.currentState = c.neverClaim.initialState
+     *     c.claimStates[0] = c.neverClaim.initialState
+     *     c.transitions.size = c.targets.size = c.guards.size
+     *     c.offsets.size = c.claimStates.size + 1
+     *     c.components.size = c.claimStates.size
+     *     for all transitions t at index i in c.transitions .(
+     *       c.claimStates[c.targets[i]] = t.target)
+     *     c.currentState < c.claimStates.size
+     *     c.offsets[c.currentState] <= c.nextIndex <=
+     *       c.offsets[c.currentState + 1]
+     *     (c.snapshots.size = 0) => c.currentState = 0
      *     (c.snapshots.size > 0) =>
-     *       c.currentState = c.snapshots.peek.applied.target
+     *       c.currentState = c.targets[c.snapshots.peek.applied]
      */
 
 public:
     /**
      * @requires ltl is a valid LTL formula using Spin syntax &&
-     *            curFtsState.length > 0
+     *            curFtsState != null && (model = null || curFtsState is the
+     *            initial state of model)
      * @effects Makes this be a new claim property automaton for the LTL
      *           property 'ltl' and with the current FTS state 'curFtsState'.
+     *           If 'model' is not null, the never claim is reduced against the
+     *           letters of the FSTM with the transition table 'model'.
      */
     ClaimPropertyAutomaton(const std::string & ltl,
-            const std::string & curFtsState);
+            const FstmStatePtr & curFtsState,
+            const TransitionTablePtr & model = TransitionTablePtr());
 
     // The default destructor is fine.
 
@@ -123,23 +179,136 @@ public:
     void apply(const PropertyTransitionPtr & transition);
     PropertyTransitionPtr revert();
     PropertyStatePtr getCurrentState() const;
+    bool isSafety() const;
+    int getComponent() const;
     bool isInitialState() const;
     bool hasNextTransition() const;
     PropertyTransitionPtr nextTransition();
     void resetTransitions();
-    void stateChanged(const std::string & newState,
-        const std::string & newEvent);
+    void stateChanged(const FstmStatePtr & newState,
+        const FstmEventPtr & newEvent);
+
+    /**
+     * @return the number of states of the never claim reachable from its
+     *          initial state, which are numbered from 0, the initial state
+     *          being 0.
+     */
+    unsigned int getNbOfClaimStates() const;
+
+    /**
+     * @requires id < getNbOfClaimStates()
+     * @return the state of the never claim with id 'id'.
+     */
+    neverclaim::ClaimStatePtr getClaimState(unsigned int id) const;
+
+    /**
+     * @requires id < getNbOfClaimStates()
+     * @return the index of the first transition leaving the state with id
+     *          'id', the transitions leaving it being at the indexes
+     *          firstIndexOf(id) to endIndexOf(id) - 1.
+     */
+    unsigned int firstIndexOf(unsigned int id) const;
+
+    /**
+     * @requires id < getNbOfClaimStates()
+     * @return the index following the last transition leaving the state with
+     *          id 'id'.
+     */
+    unsigned int endIndexOf(unsigned int id) const;
+
+    /**
+     * @requires index is the index of a transition
+     * @return the id of the target state of the transition at 'index'.
+     */
+    unsigned int getTargetOf(unsigned int index) const;
+
+    /**
+     * @requires id < getNbOfClaimStates()
+     * @return the id of the strongly connected component of the state with id
+     *          'id', or NO_COMPONENT if it is on no cycle.
+     */
+    int getComponentOf(unsigned int id) const;
+
+    /**
+     * @requires index is the index of a transition
+     * @return the compiled guard of the transition at 'index'.
+     */
+    const ClaimGuard & getGuardOf(unsigned int index) const;
+
+    /**
+     * @return the number of the variable of the guards named after the FSTM
+     *          state or event named 'name', or ClaimGuard::NO_VARIABLE if
+     *          there is none.
+     */
+    int getVariable(const std::string & name) const;
 
 private:
     /**
-     * @return the executable transitions of the state 'state'.
+     * @modifies this
+     * @effects Fills the claim states and the transitions of this with the
+     *           states and the transitions of the never claim reachable from
+     *           its initial state, and compiles the guards of the
+     *           transitions.
+     */
+    void initTables();
+
+    /**
+     * @modifies this
+     * @return the letters of the FSTM with the transition table 'model',
+     *          i.e., the pair of its initial state and of no event, and the
+     *          pairs of the target and of the event of its reachable
+     *          transitions.
+     */
+    std::vector<Letter> lettersOf(const TransitionTable & model);
+
+    /**
+     * @requires this is not started
+     * @modifies this
+     * @effects Reduces the never claim of this against the letters of the
+     *           FSTM with the transition table 'model'.
+     */
+    void reduce(const TransitionTable & model);
+
+    /**
+     * @return the claim states from which an accepting cycle or a final state
+     *          is reachable through the transitions whose letters 'enabling'
+     *          are not empty.
+     */
+    std::vector<bool> findUseful(const std::vector<LetterSet> & enabling)
+        const;
+
+    /**
+     * @return true iff the accepting state 'id' is on a cycle of the graph
+     *          'successors' of the claim states.
+     */
+    bool isOnCycle(unsigned int id,
+        const std::vector<std::vector<unsigned int> > & successors) const;
+
+    /**
+     * @modifies this
+     * @effects Computes the strongly connected components of the claim states
+     *           of this, and whether this is a safety claim.
+     */
+    void initComponents();
+
+    /**
+     * @requires transition.source = this.currentState
+     * @return the index of 'transition' in the transitions of this.
+     */
+    unsigned int indexOf(const ClaimPropertyTransitionPtr & transition) const;
+
+    /**
+     * @modifies ftsVariables
+     * @return the number of the variable named after the FSTM state or event
+     *          with id 'id' and named 'name', which is cached at index 'id'
+     *          of 'ftsVariables'.
      */
-    std::vector<ClaimPropertyTransitionPtr> * getExecutables(const
-        neverclaim::ClaimState & state) const;
+    int lookup(std::vector<int> & ftsVariables, unsigned int id,
+        const std::string & name);
 
     /**
-     * @return the index of this.executables.next if this.executables is not
-     *          empty, else returns -1.
+     * @return the index in this.transitions of this.transitions.next if
+     *          this.transitions is not empty, else returns -1.
      */
     int getNextTransitionIndex() const;
 
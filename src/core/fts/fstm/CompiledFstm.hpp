@@ -0,0 +1,63 @@
+/*
+ * CompiledFstm.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef CORE_FTS_FSTM_COMPILEDFSTM_HPP
+#define CORE_FTS_FSTM_COMPILEDFSTM_HPP
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+/**
+ * Layout of the binary format of compiled FSTMs, written by FstmCompiler and
+ * memory-mapped by CompiledFstmParser.
+ *
+ * A compiled FSTM is a sequence of 32-bit fields in native byte order:
+ *   CompiledFstmHeader header
+ *   unsigned int       stateNames[nbOfStates]       // offsets in strings
+ *   unsigned int       eventNames[nbOfEvents]       // offsets in strings
+ *   unsigned int       featureNames[nbOfFeatures]   // offsets in strings
+ *   unsigned int       properties[nbOfProperties]   // offsets in strings
+ *   unsigned int       rowOffsets[nbOfStates + 1]   // CSR rows
+ *   CompiledTransition transitions[nbOfTransitions]
+ *   math::BddNode      nodes[nbOfNodes]             // guard BDDs
+ *   char               strings[stringsSize]         // NUL-terminated
+ *
+ * The transitions leaving the state i are transitions[rowOffsets[i]] to
+ * transitions[rowOffsets[i + 1] - 1], in the order they have in the FSTM. The
+ * state 0 is the initial state. The variable v of a BDD node is the feature
+ * featureNames[v].
+ */
+
+/** The magic number of compiled FSTMs ("PVLM" in little endian). */
+const unsigned int CompiledFstmMagic = 0x4D4C5650;
+
+/** The version of the format of compiled FSTMs. */
+const unsigned int CompiledFstmVersion = 1;
+
+struct CompiledFstmHeader {
+    unsigned int magic;
+    unsigned int version;
+    unsigned int nbOfStates;
+    unsigned int nbOfEvents;
+    unsigned int nbOfFeatures;
+    unsigned int nbOfProperties;
+    unsigned int nbOfTransitions;
+    unsigned int nbOfNodes;
+    unsigned int stringsSize;
+};
+
+struct CompiledTransition {
+    unsigned int target;
+    unsigned int event;
+    int guard;
+};
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
+
+#endif /* CORE_FTS_FSTM_COMPILEDFSTM_HPP */
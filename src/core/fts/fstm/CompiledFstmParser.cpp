@@ -0,0 +1,244 @@
+/*
+ * CompiledFstmParser.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "CompiledFstmParser.hpp"
+
+#include "FstmTransition.hpp"
+
+#include "config/Messages.hpp"
+
+#include "core/features/BoolFeatureExp.hpp"
+
+#include "math/BoolVar.hpp"
+
+#include "util/Assert.hpp"
+#include "util/NotPossibleException.hpp"
+
+#include <fstream>
+#include <sstream>
+
+using config::Messages;
+
+using core::features::BoolFeatureExpFactory;
+using core::features::FeatureExpPtr;
+
+using math::BddDecoder;
+using math::BddNode;
+using math::BoolVar;
+
+using std::ifstream;
+using std::ostringstream;
+using std::size_t;
+using std::string;
+using std::tr1::shared_ptr;
+using std::vector;
+
+using util::Generator;
+using util::NotPossibleException;
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+// constructors
+CompiledFstmParser::CompiledFstmParser(const string & path,
+        const BoolFeatureExpFactory & featureExpFactory)
+    : featureExpFactory(featureExpFactory), file(path), header(NULL),
+      stateNames(NULL), eventNames(NULL), featureNames(NULL),
+      propertyOffsets(NULL), rowOffsets(NULL), compiledTransitions(NULL),
+      nodes(NULL), strings(NULL) {
+    if (!file.isMapped()) {
+        throw NotPossibleException(Messages::errorOpeningFile(path));
+    }
+    if (!mapSections()) {
+        throw NotPossibleException(Messages::invalidCompiledFstm(path));
+    }
+
+    checkRep();
+}
+
+// public methods
+int CompiledFstmParser::getNbOfTransitions() const {
+    return header->nbOfTransitions;
+}
+
+FstmTransitionGeneratorPtr CompiledFstmParser::transitions() const {
+    vector<int> varIds;
+    for (unsigned int i = 0; i < header->nbOfFeatures; ++i) {
+        varIds.push_back(BoolVar::makeBoolVar(
+                string(stringAt(featureNames[i]))).getId());
+    }
+    return FstmTransitionGeneratorPtr(new TransitionGenerator(*this, varIds));
+}
+
+int CompiledFstmParser::getNbOfProperties() const {
+    return header->nbOfProperties;
+}
+
+shared_ptr<Generator<string> > CompiledFstmParser::properties() const {
+    return shared_ptr<Generator<string> >(new StringTableGenerator(*this,
+            propertyOffsets, header->nbOfProperties));
+}
+
+shared_ptr<Generator<string> > CompiledFstmParser::states() const {
+    return shared_ptr<Generator<string> >(new StringTableGenerator(*this,
+            stateNames, header->nbOfStates));
+}
+
+bool CompiledFstmParser::isCompiled(const string & path) {
+    ifstream in(path.c_str(), ifstream::binary);
+    unsigned int magic = 0;
+    in.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+    return in.good() && magic == CompiledFstmMagic;
+}
+
+// private methods
+bool CompiledFstmParser::mapSections() {
+    const char * data = file.getData();
+    if (file.getSize() < sizeof(CompiledFstmHeader)) {
+        return false;
+    }
+
+    header = reinterpret_cast<const CompiledFstmHeader *>(data);
+    if (header->magic != CompiledFstmMagic
+            || header->version != CompiledFstmVersion
+            || header->nbOfStates == 0 || header->nbOfTransitions == 0
+            || header->stringsSize == 0) {
+        return false;
+    }
+
+    const size_t nbOfOffsets = size_t(header->nbOfStates)
+            + header->nbOfEvents + header->nbOfFeatures
+            + header->nbOfProperties + header->nbOfStates + 1;
+    const size_t expectedSize = sizeof(CompiledFstmHeader)
+            + nbOfOffsets * sizeof(unsigned int)
+            + size_t(header->nbOfTransitions) * sizeof(CompiledTransition)
+            + size_t(header->nbOfNodes) * sizeof(BddNode)
+            + header->stringsSize;
+    if (file.getSize() != expectedSize) {
+        return false;
+    }
+
+    const unsigned int * offsets = reinterpret_cast<const unsigned int *>(
+            data + sizeof(CompiledFstmHeader));
+    stateNames = offsets;
+    eventNames = stateNames + header->nbOfStates;
+    featureNames = eventNames + header->nbOfEvents;
+    propertyOffsets = featureNames + header->nbOfFeatures;
+    rowOffsets = propertyOffsets + header->nbOfProperties;
+    compiledTransitions = reinterpret_cast<const CompiledTransition *>(
+            rowOffsets + header->nbOfStates + 1);
+    nodes = reinterpret_cast<const BddNode *>(
+            compiledTransitions + header->nbOfTransitions);
+    strings = reinterpret_cast<const char *>(nodes + header->nbOfNodes);
+
+    // Strings
+    if (strings[header->stringsSize - 1] != '\0') {
+        return false;
+    }
+    for (size_t i = 0; i + header->nbOfStates + 1 < nbOfOffsets; ++i) {
+        if (offsets[i] >= header->stringsSize) {
+            return false;
+        }
+    }
+
+    // Transitions
+    if (rowOffsets[0] != 0
+            || rowOffsets[header->nbOfStates] != header->nbOfTransitions) {
+        return false;
+    }
+    for (unsigned int i = 0; i < header->nbOfStates; ++i) {
+        if (rowOffsets[i] > rowOffsets[i + 1]) {
+            return false;
+        }
+    }
+    for (unsigned int i = 0; i < header->nbOfTransitions; ++i) {
+        const CompiledTransition & t = compiledTransitions[i];
+        if (t.target >= header->nbOfStates || t.event >= header->nbOfEvents
+                || t.guard < 0
+                || static_cast<unsigned int>(t.guard >> 1)
+                    > header->nbOfNodes) {
+            return false;
+        }
+    }
+
+    // The initial state must be the source of the first transition.
+    if (rowOffsets[1] == 0) {
+        return false;
+    }
+
+    return BddDecoder::isValid(nodes, header->nbOfNodes,
+            header->nbOfFeatures);
+}
+
+const char * CompiledFstmParser::stringAt(unsigned int offset) const {
+    assertTrue(offset < header->stringsSize);
+
+    return strings + offset;
+}
+
+void CompiledFstmParser::checkRep() const {
+    if (doCheckRep) {
+        assertTrue(file.isMapped());
+        assertTrue(header);
+        assertTrue(header->magic == CompiledFstmMagic);
+    }
+}
+
+// transition generator
+CompiledFstmParser::TransitionGenerator::TransitionGenerator(
+        const CompiledFstmParser & parser, const vector<int> & varIds)
+    : parser(parser), decoder(parser.nodes, parser.header->nbOfNodes, varIds),
+      source(0), index(0), guards() {}
+
+bool CompiledFstmParser::TransitionGenerator::hasNext() const {
+    return index < parser.header->nbOfTransitions;
+}
+
+FstmTransitionPtr CompiledFstmParser::TransitionGenerator::next() {
+    assertTrue(hasNext());
+
+    while (index >= parser.rowOffsets[source + 1]) {
+        ++source;
+    }
+    const CompiledTransition & t = parser.compiledTransitions[index];
+    index++;
+
+    // Equal feature expressions are encoded by the same reference.
+    ostringstream key;
+    key << t.guard;
+    int guardId = guards.find(key.str());
+    if (guardId < 0) {
+        guardId = guards.add(key.str(), FeatureExpPtr(
+                parser.featureExpFactory.create(decoder.decode(t.guard))));
+    }
+
+    return FstmTransitionPtr(new FstmTransition(
+            parser.stringAt(parser.stateNames[source]),
+            parser.stringAt(parser.stateNames[t.target]),
+            parser.stringAt(parser.eventNames[t.event]),
+            guards.getGuard(guardId), guardId));
+}
+
+// string table generator
+CompiledFstmParser::StringTableGenerator::StringTableGenerator(
+        const CompiledFstmParser & parser, const unsigned int * offsets,
+        unsigned int size)
+    : parser(parser), offsets(offsets), size(size), index(0) {}
+
+bool CompiledFstmParser::StringTableGenerator::hasNext() const {
+    return index < size;
+}
+
+string CompiledFstmParser::StringTableGenerator::next() {
+    assertTrue(hasNext());
+
+    return parser.stringAt(offsets[index++]);
+}
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
@@ -0,0 +1,164 @@
+/*
+ * CompiledFstmParser.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef CORE_FTS_FSTM_COMPILEDFSTMPARSER_HPP
+#define CORE_FTS_FSTM_COMPILEDFSTMPARSER_HPP
+
+#include "forwards.hpp"
+#include "CompiledFstm.hpp"
+#include "FstmParser.hpp"
+#include "GuardTable.hpp"
+
+#include "core/features/BoolFeatureExpFactory.hpp"
+
+#include "math/BddCodec.hpp"
+
+#include "util/Generator.hpp"
+#include "util/MappedFile.hpp"
+#include "util/Uncopyable.hpp"
+
+#include <string>
+#include <vector>
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+/**
+ * CompiledFstmParser is a parser for an FSTM compiled by FstmCompiler. The
+ * compiled FSTM is memory-mapped, so that no text has to be parsed and the
+ * BDDs of the feature expressions are rebuilt node by node.
+ *
+ * @author mwi
+ */
+class CompiledFstmParser : public FstmParser, private util::Uncopyable {
+
+private:
+    const core::features::BoolFeatureExpFactory & featureExpFactory;
+    util::MappedFile file;
+
+    /* Pointers to the sections of the mapped file. */
+    const CompiledFstmHeader * header;
+    const unsigned int * stateNames;
+    const unsigned int * eventNames;
+    const unsigned int * featureNames;
+    const unsigned int * propertyOffsets;
+    const unsigned int * rowOffsets;
+    const CompiledTransition * compiledTransitions;
+    const math::BddNode * nodes;
+    const char * strings;
+
+    /*
+     * Representation Invariant:
+     *   I(c) = c.file is mapped && c.file contains a valid compiled FSTM &&
+     *     the section pointers of c point to the sections of c.file
+     */
+
+public:
+    /**
+     * @effects Makes this be a new parser for the compiled FSTM at 'path'
+     *           with the boolean feature expression factory
+     *           'featureExpFactory'.
+     * @throws NotPossibleException iff the file at 'path' cannot be opened
+     *          or does not contain a valid compiled FSTM.
+     */
+    CompiledFstmParser(const std::string & path,
+        const core::features::BoolFeatureExpFactory & featureExpFactory);
+
+    // The default destructor is fine.
+
+    // overridden methods
+    int getNbOfTransitions() const;
+    FstmTransitionGeneratorPtr transitions() const;
+    int getNbOfProperties() const;
+    std::tr1::shared_ptr<util::Generator<std::string> > properties() const;
+    std::tr1::shared_ptr<util::Generator<std::string> > states() const;
+
+    /**
+     * @return true iff the file at 'path' starts with the magic number of
+     *          compiled FSTMs.
+     */
+    static bool isCompiled(const std::string & path);
+
+private:
+    /**
+     * @return true iff the mapped file contains a valid compiled FSTM, in
+     *          which case the section pointers of this are set.
+     */
+    bool mapSections();
+
+    /**
+     * @return the string at offset 'offset' in the strings of this.
+     */
+    const char * stringAt(unsigned int offset) const;
+
+    /**
+     * @effects Asserts the rep invariant holds for this.
+     */
+    void checkRep() const;
+
+    /**
+     * Generator for transitions of the compiled FSTM.
+     */
+    class TransitionGenerator : public util::Generator<FstmTransitionPtr> {
+
+    private:
+        const CompiledFstmParser & parser;
+        math::BddDecoder decoder;
+        /* The source state of the next transition. */
+        unsigned int source;
+        /* The index of the next transition. */
+        unsigned int index;
+        /* The feature expressions, keyed by their reference. */
+        GuardTable guards;
+
+    public:
+        /**
+         * @effects Makes this be a new transition generator for the
+         *           compiled FSTM of 'parser'.
+         */
+        TransitionGenerator(const CompiledFstmParser & parser,
+            const std::vector<int> & varIds);
+
+        // The default destructor is fine.
+
+        // overridden methods
+        bool hasNext() const;
+        FstmTransitionPtr next();
+    }; // end TransitionGenerator
+
+    /**
+     * Generator for a table of strings of the compiled FSTM.
+     */
+    class StringTableGenerator : public util::Generator<std::string> {
+
+    private:
+        const CompiledFstmParser & parser;
+        const unsigned int * offsets;
+        const unsigned int size;
+        unsigned int index;
+
+    public:
+        /**
+         * @effects Makes this be a new generator for the 'size' strings at
+         *           the offsets 'offsets' of the compiled FSTM of 'parser'.
+         */
+        StringTableGenerator(const CompiledFstmParser & parser,
+            const unsigned int * offsets, unsigned int size);
+
+        // The default destructor is fine.
+
+        // overridden methods
+        bool hasNext() const;
+        std::string next();
+    }; // end StringTableGenerator
+};
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
+
+#endif /* CORE_FTS_FSTM_COMPILEDFSTMPARSER_HPP */
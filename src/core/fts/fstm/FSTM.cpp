@@ -11,7 +11,7 @@
 #include "FstmEvent.hpp"
 #include "FstmState.hpp"
 #include "FstmTransition.hpp"
-#include "JsonParser.hpp"
+#include "StreamingJsonParser.hpp"
 #include "TransitionTable.hpp"
 #include "core/fts/PropertyAutomaton.hpp"
 #include "core/fts/State.hpp"
@@ -28,6 +28,7 @@ using std::string;
 using std::auto_ptr;
 using std::tr1::dynamic_pointer_cast;
 using std::tr1::shared_ptr;
+using util::ArrayStack;
 using util::Generator;
 
 namespace core {
@@ -36,26 +37,19 @@ namespace fstm {
 
 // constructors
 FSTM::FSTM(istream & jsonFstm, const BoolFeatureExpFactory & featureExpFactory)
-        : featureExpFactory(featureExpFactory), transitionTable(),
-          propertyAutomaton(), changeListener(), currentState(), executables(),
-          snapshots() {
+        : transitionTable(), propertyAutomaton(), changeListener(),
+          currentState(), nextIndex(0), endIndex(0), snapshots() {
 
-    JsonParser parser(jsonFstm, featureExpFactory);
+    init(StreamingJsonParser(jsonFstm, featureExpFactory));
 
-    transitionTable = TransitionTablePtr(new TransitionTable(
-            parser.transitions(), parser.getNbOfTransitions()));
+    checkRep();
+}
 
-    currentState = transitionTable->getInitialState();
-    executables = transitionTable->executables(*currentState);
+FSTM::FSTM(const FstmParser & parser)
+        : transitionTable(), propertyAutomaton(), changeListener(),
+          currentState(), nextIndex(0), endIndex(0), snapshots() {
 
-    if (parser.getNbOfProperties() > 0) {
-        // for now only the first property is verified
-        shared_ptr<Generator<string> > propGen = parser.properties();
-        propertyAutomaton = PropertyAutomatonPtr(new ClaimPropertyAutomaton(
-                propGen->next(), currentState->getName()));
-        changeListener =
-                dynamic_pointer_cast<ChangeListener>(propertyAutomaton);
-    }
+    init(parser);
 
     checkRep();
 }
@@ -68,12 +62,12 @@ FSTM::FSTM(istream & jsonFstm, const BoolFeatureExpFactory & featureExpFactory)
     assertTrue(t);
     assertTrue(currentState == t->getSource());
 
-    snapshots.push(SnapshotPtr(new Snapshot(t, executables)));
+    snapshots.push(Snapshot(indexOf(t), nextIndex));
 
     currentState = t->getTarget();
     resetTransitions();
 
-    fireStateChangedEvent(t->getEvent()->getName());
+    fireStateChangedEvent(t->getEvent());
 
     DVLOG(1) << "Apply ("
              << t->getSource()->getName() << ", "
@@ -87,19 +81,23 @@ FSTM::FSTM(istream & jsonFstm, const BoolFeatureExpFactory & featureExpFactory)
 TransitionPtr FSTM::revert() {
     assertTrue(!isInitialState());
 
-    SnapshotPtr snapshot = snapshots.pop();
+    const Snapshot snapshot = snapshots.pop();
+    const FstmTransitionPtr & applied =
+            transitionTable->getTransition(snapshot.applied);
 
-    currentState = snapshot->applied->getSource();
-    executables = snapshot->executables;
+    currentState = applied->getSource();
+    nextIndex = snapshot.nextIndex;
+    endIndex = transitionTable->endIndexOf(*currentState);
 
     if (snapshots.empty()) {
-        fireStateChangedEvent(string(""));
+        fireStateChangedEvent(FstmEventPtr());
     } else {
-        fireStateChangedEvent(snapshots.peek()->applied->getEvent()->getName());
+        fireStateChangedEvent(transitionTable->getTransition(
+                snapshots.peek().applied)->getEvent());
     }
 
     checkRep();
-    return snapshot->applied;
+    return applied;
 }
 
 StatePtr FSTM::getCurrentState() const {
@@ -111,18 +109,19 @@ bool FSTM::isInitialState() const {
 }
 
 bool FSTM::hasNextTransition() const {
-    return executables->hasNext();
+    return nextIndex < endIndex;
 }
 
 TransitionPtr FSTM::nextTransition() {
     assertTrue(hasNextTransition());
 
     // no checkRep but that's fine
-    return executables->next();
+    return transitionTable->getTransition(nextIndex++);
 }
 
 void FSTM::resetTransitions() {
-    executables = transitionTable->executables(*currentState);
+    nextIndex = transitionTable->firstIndexOf(*currentState);
+    endIndex = transitionTable->endIndexOf(*currentState);
 
     checkRep();
 }
@@ -138,13 +137,52 @@ PropertyAutomatonPtr FSTM::getPropertyAutomaton() const {
 
 auto_ptr<Generator<StatePtr> > FSTM::getPath() const {
     return auto_ptr<Generator<StatePtr> >(
-            new PathGenerator(snapshots.elements(), currentState));
+            new PathGenerator(snapshots, *transitionTable, currentState));
+}
+
+TransitionTablePtr FSTM::getTransitionTable() const {
+    return transitionTable;
 }
 
 // private methods
-void FSTM::fireStateChangedEvent(const string & eventName) {
+void FSTM::init(const FstmParser & parser) {
+    transitionTable = TransitionTablePtr(new TransitionTable(
+            parser.transitions(), parser.getNbOfTransitions()));
+
+    currentState = transitionTable->getInitialState();
+    nextIndex = transitionTable->firstIndexOf(*currentState);
+    endIndex = transitionTable->endIndexOf(*currentState);
+
+    if (parser.getNbOfProperties() > 0) {
+        // for now only the first property is verified
+        shared_ptr<Generator<string> > propGen = parser.properties();
+        propertyAutomaton = PropertyAutomatonPtr(new ClaimPropertyAutomaton(
+                propGen->next(), currentState, transitionTable));
+        changeListener =
+                dynamic_pointer_cast<ChangeListener>(propertyAutomaton);
+    }
+}
+
+unsigned int FSTM::indexOf(const FstmTransitionPtr & transition) const {
+    // The applied transition is usually the last one fetched.
+    if (nextIndex > 0 && transitionTable->getTransition(nextIndex - 1)
+            == transition) {
+        return nextIndex - 1;
+    }
+
+    unsigned int index = transitionTable->firstIndexOf(*currentState);
+    const unsigned int end = transitionTable->endIndexOf(*currentState);
+    while (index < end && transitionTable->getTransition(index)
+            != transition) {
+        index++;
+    }
+    assertTrue(index < end);
+    return index;
+}
+
+void FSTM::fireStateChangedEvent(const FstmEventPtr & event) {
     if (changeListener) {
-        changeListener->stateChanged(currentState->getName(), eventName);
+        changeListener->stateChanged(currentState, event);
     }
 }
 
@@ -152,9 +190,11 @@ void FSTM::checkRep() const {
     if (doCheckRep) {
         assertTrue(transitionTable);
         assertTrue(currentState);
-        assertTrue(executables);
+        assertTrue(nextIndex <= endIndex);
+        assertTrue(endIndex <= transitionTable->endIndexOf(*currentState));
         if (snapshots.count() > 0) {
-            assertTrue(currentState == snapshots.peek()->applied->getTarget());
+            assertTrue(currentState == transitionTable->getTransition(
+                    snapshots.peek().applied)->getTarget());
         } else {
             assertTrue(currentState == transitionTable->getInitialState());
         }
@@ -164,9 +204,10 @@ void FSTM::checkRep() const {
 }
 
 // PathGenerator
-FSTM::PathGenerator::PathGenerator(auto_ptr<Generator<SnapshotPtr> > stackGen,
-        StatePtr lastState)
-        : stackGen(stackGen), lastState(lastState), hasNextState(true) {}
+FSTM::PathGenerator::PathGenerator(const ArrayStack<Snapshot> & snapshots,
+        const TransitionTable & transitionTable, StatePtr lastState)
+        : snapshots(snapshots), transitionTable(transitionTable), index(0),
+          lastState(lastState), hasNextState(true) {}
 
 bool FSTM::PathGenerator::hasNext() const {
     return hasNextState;
@@ -175,8 +216,9 @@ bool FSTM::PathGenerator::hasNext() const {
 StatePtr FSTM::PathGenerator::next() {
     assertTrue(hasNext());
 
-    if (stackGen->hasNext()) {
-        return stackGen->next()->applied->getSource();
+    if (index < snapshots.count()) {
+        return transitionTable.getTransition(
+                snapshots.at(index++).applied)->getSource();
     }
     else {
         hasNextState = false;
@@ -10,7 +10,7 @@
 #include "forwards.hpp"
 #include "core/features/BoolFeatureExpFactory.hpp"
 #include "core/fts/FTS.hpp"
-#include "util/Stack.hpp"
+#include "util/ArrayStack.hpp"
 #include "util/Generator.hpp"
 
 #include <memory>
@@ -32,38 +32,51 @@ namespace fstm {
 class FSTM : public FTS {
 
 private:
-    class Snapshot;
-    typedef std::tr1::shared_ptr<Snapshot> SnapshotPtr;
+    /**
+     * Snapshots capture the context of this and allow it to be reverted.
+     * They are plain values stored contiguously in the undo stack, so that
+     * applying and reverting a transition allocates nothing.
+     */
+    struct Snapshot {
+        /* The index of the applied transition in the transition table. */
+        unsigned int applied;
+        /* The value of nextIndex before the transition was applied. */
+        unsigned int nextIndex;
 
-    /* Boolean feature expression factory. */
-    const core::features::BoolFeatureExpFactory & featureExpFactory;
+        Snapshot(unsigned int applied, unsigned int nextIndex)
+            : applied(applied), nextIndex(nextIndex) {}
+    }; // end Snapshot
 
     TransitionTablePtr transitionTable;
     PropertyAutomatonPtr propertyAutomaton;
     ChangeListenerPtr changeListener;
 
     FstmStatePtr currentState;
-    TransitionGeneratorPtr executables;
+    /* The executable transitions of the current state not yet fetched are
+     * the transitions of the table from nextIndex to endIndex - 1. */
+    unsigned int nextIndex;
+    unsigned int endIndex;
 
     /* Snapshots of the previous internal states (if any). */
-    util::Stack<SnapshotPtr> snapshots;
+    util::ArrayStack<Snapshot> snapshots;
 
     /*
      * Abstraction Function:
      *   AF(c) = FTS fts such that
      *     fts.currentState = c.currentState
      *     fts.initialState = (c.snapshots.size == 0)
-     *     fts.executables = c.executables
+     *     fts.executables = c.transitionTable[c.nextIndex .. c.endIndex - 1]
      *     fts.propertyAutomaton = c.propertyAutomaton
      *
      * Representation Invariant:
      *   I(c) = c.transitionTable != null
      *     c.currentState != null
-     *     c.executables != null
+     *     c.nextIndex <= c.endIndex <= c.transitionTable.endIndexOf(
+     *       c.currentState)
      *     (c.snapshots.size = 0) =>
      *       c.currentState = c.transitionTable.initialState
-     *     (c.snapshots.size > 0) =>
-     *       c.currentState = c.snapshots.peek.applied.target
+     *     (c.snapshots.size > 0) => c.currentState =
+     *       c.transitionTable.getTransition(c.snapshots.peek.applied).target
      *     (propertyAutomaton != null) <=> (changeListener != null)
      */
 
@@ -73,12 +86,19 @@ public:
      *            transition.
      * @effects Makes this be a new FSTM from the JSON FSTM 'jsonFSTM' and
      *           with the boolean feature expression factory
-     *           'featureExpFactory'.
+     *           'featureExpFactory'. The transitions are added to this as
+     *           they are parsed (see StreamingJsonParser).
      * @throws JsonException iff 'jsonFstm' contains some JSON syntax error.
      */
     FSTM(std::istream & jsonFstm, const core::features::BoolFeatureExpFactory &
         featureExpFactory);
 
+    /**
+     * @requires parser parses an FSTM that contains at least one transition.
+     * @effects Makes this be a new FSTM from the FSTM parsed by 'parser'.
+     */
+    explicit FSTM(const FstmParser & parser);
+
     // The default destructor is fine.
 
     // overridden methods
@@ -93,30 +113,36 @@ public:
     PropertyAutomatonPtr getPropertyAutomaton() const;
     std::auto_ptr<util::Generator<StatePtr> > getPath() const;
 
+    /**
+     * @return the transition table of this.
+     */
+    TransitionTablePtr getTransitionTable() const;
+
 private:
     /**
+     * @requires parser parses an FSTM that contains at least one transition.
      * @modifies this
-     * @effects Fires a state changed event to the registered listener
-     *           (if any) with the event named 'eventName'.
+     * @effects Initializes this from the FSTM parsed by 'parser'.
      */
-    void fireStateChangedEvent(const std::string & eventName);
+    void init(const FstmParser & parser);
 
     /**
-     * @effects Asserts the rep invariant holds for this.
+     * @requires transition.source = this.currentState
+     * @return the index of 'transition' in the transition table of this.
      */
-    void checkRep() const;
+    unsigned int indexOf(const FstmTransitionPtr & transition) const;
 
     /**
-     * Snapshots capture the context of this and allow it to be reverted.
+     * @modifies this
+     * @effects Fires a state changed event to the registered listener
+     *           (if any) with the event 'event', null for no event.
      */
-    struct Snapshot {
-        FstmTransitionPtr applied;
-        TransitionGeneratorPtr executables;
+    void fireStateChangedEvent(const FstmEventPtr & event);
 
-        Snapshot(const FstmTransitionPtr & applied,
-            const TransitionGeneratorPtr & execs)
-            : applied(applied), executables(execs) {}
-    }; // end Snapshot
+    /**
+     * @effects Asserts the rep invariant holds for this.
+     */
+    void checkRep() const;
 
     /**
      * A PathGenerator is a generator that generates the path (i.e. the sequence
@@ -125,19 +151,23 @@ private:
     class PathGenerator : public util::Generator<StatePtr> {
 
     private:
-        std::auto_ptr<util::Generator<SnapshotPtr> > stackGen;
+        const util::ArrayStack<Snapshot> & snapshots;
+        const TransitionTable & transitionTable;
+        int index;
         StatePtr lastState;
         bool hasNextState;
 
     public:
         /**
          * @effects Makes this be the the path generator following all the
-         *          transition in 'snapshotGen' until reaching the last state
-         *          'lastState'. If stackGen is empty, only generate
-         *          'lastState'.
+         *          transitions of 'transitionTable' applied in 'snapshots',
+         *          from the bottom to the top, until reaching the last state
+         *          'lastState'. If snapshots is empty, only generate
+         *          'lastState'. 'snapshots' must not be modified while this is
+         *          in use.
          */
-        PathGenerator(std::auto_ptr<util::Generator<SnapshotPtr> > snapshotGen,
-                StatePtr lastState);
+        PathGenerator(const util::ArrayStack<Snapshot> & snapshots,
+                const TransitionTable & transitionTable, StatePtr lastState);
 
         // The default destructor is fine.
 
@@ -0,0 +1,209 @@
+/*
+ * FstmCompiler.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "FstmCompiler.hpp"
+
+#include "CompiledFstm.hpp"
+#include "FstmEvent.hpp"
+#include "FstmParser.hpp"
+#include "FstmState.hpp"
+#include "FstmTransition.hpp"
+
+#include "core/features/BoolFeatureExp.hpp"
+
+#include "math/BddCodec.hpp"
+#include "math/BoolVar.hpp"
+
+#include "util/Assert.hpp"
+
+#include <string>
+#include <tr1/unordered_map>
+#include <vector>
+
+using core::features::BoolFeatureExp;
+using core::features::FeatureExpPtr;
+
+using math::BddEncoder;
+using math::BddNode;
+using math::BoolVar;
+
+using std::ostream;
+using std::string;
+using std::tr1::shared_ptr;
+using std::tr1::unordered_map;
+using std::vector;
+
+using util::Generator;
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+namespace {
+
+/**
+ * A string table interns strings into consecutive indexes.
+ */
+class StringTable {
+
+private:
+    vector<string> strings;
+    unordered_map<string, unsigned int> indexes;
+
+public:
+    /**
+     * @modifies this
+     * @return the index of 'str', interned if needed.
+     */
+    unsigned int intern(const string & str) {
+        unordered_map<string, unsigned int>::const_iterator it =
+                indexes.find(str);
+        if (it != indexes.end()) {
+            return it->second;
+        }
+        const unsigned int index = strings.size();
+        strings.push_back(str);
+        indexes[str] = index;
+        return index;
+    }
+
+    /**
+     * @return the interned strings, ordered by index.
+     */
+    const vector<string> & getStrings() const {
+        return strings;
+    }
+};
+
+} // namespace
+
+/**
+ * @modifies offsets, blob
+ * @effects Appends each string of 'strings' (with a terminating NUL) to
+ *           'blob' and its offset in 'blob' to 'offsets'.
+ */
+static void appendStrings(const vector<string> & strings,
+        vector<unsigned int> & offsets, string & blob) {
+    for (vector<string>::const_iterator it = strings.begin();
+            it != strings.end(); ++it) {
+        offsets.push_back(blob.size());
+        blob.append(*it);
+        blob.push_back('\0');
+    }
+}
+
+/**
+ * @modifies out
+ * @effects Writes the elements of 'v' on 'out'.
+ */
+template <typename T>
+static void writeVector(ostream & out, const vector<T> & v) {
+    if (!v.empty()) {
+        out.write(reinterpret_cast<const char *>(&v[0]), v.size() * sizeof(T));
+    }
+}
+
+// constructors
+FstmCompiler::FstmCompiler(const FstmParser & parser) : parser(parser) {}
+
+// public methods
+void FstmCompiler::compile(ostream & out) const {
+    StringTable states;
+    StringTable events;
+    StringTable features;
+    vector<FstmTransitionPtr> transitions;
+    vector<unsigned int> sources;
+    // The guards must remain alive while their BDDs are encoded.
+    vector<FeatureExpPtr> guards;
+    vector<int> guardRefs;
+    BddEncoder encoder;
+
+    // The source of the first transition must be the state 0.
+    FstmTransitionGeneratorPtr gen = parser.transitions();
+    assertTrue(gen->hasNext());
+    while (gen->hasNext()) {
+        FstmTransitionPtr transition = gen->next();
+        transitions.push_back(transition);
+        sources.push_back(states.intern(transition->getSource()->getName()));
+        states.intern(transition->getTarget()->getName());
+        events.intern(transition->getEvent()->getName());
+        guards.push_back(transition->getFeatureExp());
+        guardRefs.push_back(encoder.encode(
+                static_cast<const BoolFeatureExp &>(*guards.back())
+                    .getBoolFct()));
+    }
+    shared_ptr<Generator<string> > stateGen = parser.states();
+    while (stateGen->hasNext()) {
+        states.intern(stateGen->next());
+    }
+    const unsigned int nbOfStates = states.getStrings().size();
+
+    // Map the BoolVar ids of the nodes to feature indexes.
+    vector<BddNode> nodes(encoder.getNodes());
+    for (vector<BddNode>::iterator it = nodes.begin(); it != nodes.end();
+            ++it) {
+        it->var = features.intern(BoolVar::makeBoolVar(it->var).getName());
+    }
+
+    // Group the transitions by source, keeping their relative order.
+    vector<unsigned int> rowOffsets(nbOfStates + 1, 0);
+    for (unsigned int i = 0; i < sources.size(); ++i) {
+        ++rowOffsets[sources[i] + 1];
+    }
+    for (unsigned int i = 0; i < nbOfStates; ++i) {
+        rowOffsets[i + 1] += rowOffsets[i];
+    }
+    vector<unsigned int> next(rowOffsets.begin(), rowOffsets.end() - 1);
+    vector<CompiledTransition> compiled(transitions.size());
+    for (unsigned int i = 0; i < transitions.size(); ++i) {
+        CompiledTransition & c = compiled[next[sources[i]]++];
+        c.target = states.intern(transitions[i]->getTarget()->getName());
+        c.event = events.intern(transitions[i]->getEvent()->getName());
+        c.guard = guardRefs[i];
+    }
+
+    vector<string> properties;
+    shared_ptr<Generator<string> > propGen = parser.properties();
+    while (propGen->hasNext()) {
+        properties.push_back(propGen->next());
+    }
+
+    string blob;
+    vector<unsigned int> stateNames;
+    vector<unsigned int> eventNames;
+    vector<unsigned int> featureNames;
+    vector<unsigned int> propertyOffsets;
+    appendStrings(states.getStrings(), stateNames, blob);
+    appendStrings(events.getStrings(), eventNames, blob);
+    appendStrings(features.getStrings(), featureNames, blob);
+    appendStrings(properties, propertyOffsets, blob);
+    blob.resize((blob.size() + 3) & ~3u, '\0');
+
+    CompiledFstmHeader header;
+    header.magic = CompiledFstmMagic;
+    header.version = CompiledFstmVersion;
+    header.nbOfStates = nbOfStates;
+    header.nbOfEvents = eventNames.size();
+    header.nbOfFeatures = featureNames.size();
+    header.nbOfProperties = propertyOffsets.size();
+    header.nbOfTransitions = compiled.size();
+    header.nbOfNodes = nodes.size();
+    header.stringsSize = blob.size();
+
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    writeVector(out, stateNames);
+    writeVector(out, eventNames);
+    writeVector(out, featureNames);
+    writeVector(out, propertyOffsets);
+    writeVector(out, rowOffsets);
+    writeVector(out, compiled);
+    writeVector(out, nodes);
+    out.write(blob.data(), blob.size());
+}
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
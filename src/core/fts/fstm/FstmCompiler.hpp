@@ -0,0 +1,53 @@
+/*
+ * FstmCompiler.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef CORE_FTS_FSTM_FSTMCOMPILER_HPP
+#define CORE_FTS_FSTM_FSTMCOMPILER_HPP
+
+#include "forwards.hpp"
+
+#include "util/Uncopyable.hpp"
+
+#include <ostream>
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+/**
+ * A FstmCompiler compiles an FSTM into the binary format described in
+ * CompiledFstm.hpp, with interned state, event and feature names, a CSR
+ * transition array and the BDDs of the feature expressions.
+ *
+ * @author mwi
+ */
+class FstmCompiler : private util::Uncopyable {
+
+private:
+    const FstmParser & parser;
+
+public:
+    /**
+     * @requires parser parses an FSTM that contains at least one transition
+     *            and the feature expressions of which are BoolFeatureExps.
+     * @effects Makes this be a new compiler for the FSTM parsed by 'parser'.
+     */
+    explicit FstmCompiler(const FstmParser & parser);
+
+    // The default destructor is fine.
+
+    /**
+     * @modifies out
+     * @effects Writes on 'out' the compiled FSTM.
+     */
+    void compile(std::ostream & out) const;
+};
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
+
+#endif /* CORE_FTS_FSTM_FSTMCOMPILER_HPP */
@@ -19,8 +19,8 @@ namespace fstm {
 
     unordered_map<string, shared_ptr<FstmEvent> > FstmEvent::nameTable;
 
-    FstmEvent::FstmEvent(const string & name)
-        : name(name) {
+    FstmEvent::FstmEvent(const string & name, unsigned int id)
+        : name(name), id(id) {
         checkRep();
     }
 
@@ -28,22 +28,32 @@ namespace fstm {
         return name;
     }
 
+    unsigned int FstmEvent::getId() const {
+        return id;
+    }
+
     shared_ptr<FstmEvent> FstmEvent::makeEvent(const string & name) {
         assertTrue(name.length() > 0);
 
         if (nameTable.count(name) <= 0) {
-            shared_ptr<FstmEvent> state(new FstmEvent(name));
+            shared_ptr<FstmEvent> state(new FstmEvent(name,
+                    nameTable.size()));
             nameTable.insert(pair<string, shared_ptr<FstmEvent> >(name, state));
         }
         return nameTable[name];
     }
 
+    unsigned int FstmEvent::getNbOfEvents() {
+        return nameTable.size();
+    }
+
     void FstmEvent::checkRep() const {
         if (doCheckRep) {
             assertTrue(name.length() > 0);
             unordered_map<string, shared_ptr<FstmEvent> >::const_iterator it;
             for (it = nameTable.begin(); it != nameTable.end(); ++it) {
                 assertTrue(it->first == it->second->getName());
+                assertTrue(it->second->getId() < nameTable.size());
             }
         }
     }
@@ -20,6 +20,8 @@ namespace fstm {
     /**
      * FstmEvents are immutable events of a featured state machine (FSTM). An
      * FSTM event has a name, and for each unique name there is at most one
+     * event. Each event also has a unique id, the events being numbered from
+     * 0 in the order of their creation, so that tables can be indexed by
      * event.
      *
      * @author mwi
@@ -31,18 +33,20 @@ namespace fstm {
             std::tr1::shared_ptr<FstmEvent> > nameTable;
 
         std::string name;
+        const unsigned int id;
 
         /*
          * Representation Invariant:
          *   I(c) = c.name.length > 0
-         *     for all <name, event> in c.nameTable .(name = state.event)
+         *     for all <name, event> in c.nameTable .(name = event.name &&
+         *       event.id < c.nameTable.size)
          */
 
         /**
          * @requires name not empty
-         * @effects Makes this be a new FSTM event named 'name'.
+         * @effects Makes this be a new FSTM event named 'name' with id 'id'.
          */
-        explicit FstmEvent(const std::string & name);
+        FstmEvent(const std::string & name, unsigned int id);
 
     public:
         /**
@@ -50,6 +54,11 @@ namespace fstm {
          */
         std::string getName() const;
 
+        /**
+         * @return the id of this.
+         */
+        unsigned int getId() const;
+
         /**
          * @requires name not empty
          * @return the event named 'name'.
@@ -57,6 +66,12 @@ namespace fstm {
         static std::tr1::shared_ptr<FstmEvent> makeEvent(const std::string &
             name);
 
+        /**
+         * @return the number of events created so far, i.e., an upper bound
+         *          of their ids.
+         */
+        static unsigned int getNbOfEvents();
+
     private:
         /**
          * @effects Asserts the rep invariant holds for this.
@@ -0,0 +1,71 @@
+/*
+ * FstmParser.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef CORE_FTS_FSTM_FSTMPARSER_HPP
+#define CORE_FTS_FSTM_FSTMPARSER_HPP
+
+#include "forwards.hpp"
+#include "util/Generator.hpp"
+
+#include <string>
+#include <tr1/memory>
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+/**
+ * FstmParser is the interface of the parsers of FSTMs. A parser returns the
+ * transitions of an FSTM as well as available information about the FSTM,
+ * whatever the format in which the FSTM is stored.
+ *
+ * @author mwi
+ */
+class FstmParser {
+
+public:
+    /**
+     * @return the number of transitions of the FSTM.
+     */
+    virtual int getNbOfTransitions() const = 0;
+
+    /**
+     * @return a generator that will produce all the transitions of the
+     *          FSTM (as FstmTransitions), each exactly once, in the
+     *          order they have in the parsed FSTM.
+     */
+    virtual FstmTransitionGeneratorPtr transitions() const = 0;
+
+    /**
+     * @return the number of LTL properties of the FSTM.
+     */
+    virtual int getNbOfProperties() const = 0;
+
+    /**
+     * @return a generator that will produce all the LTL properties of the
+     *          FSTM (as strings), each exactly once, in the order they have in
+     *          the parsed FSTM.
+     */
+    virtual std::tr1::shared_ptr<util::Generator<std::string> > properties()
+        const = 0;
+
+    /**
+     * @return a generator that will produce all the states of the FSTM
+     *          (as strings), each exactly once, in the order they have in the
+     *          parsed FSTM.
+     */
+    virtual std::tr1::shared_ptr<util::Generator<std::string> > states()
+        const = 0;
+
+    // mandatory virtual destructor
+    virtual ~FstmParser() {}
+};
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
+
+#endif /* CORE_FTS_FSTM_FSTMPARSER_HPP */
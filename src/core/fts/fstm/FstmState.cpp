@@ -24,8 +24,8 @@ namespace fstm {
 unordered_map<string, FstmStatePtr> FstmState::nameTable;
 
 // constructors
-FstmState::FstmState(const string & name)
-    : name(name) {
+FstmState::FstmState(const string & name, unsigned int id)
+    : name(name), id(id) {
     checkRep();
 }
 
@@ -45,17 +45,25 @@ unsigned int FstmState::hashCode() const {
     return hashValue;
 }
 
+unsigned int FstmState::getId() const {
+    return id;
+}
+
 // static factory methods
 FstmStatePtr FstmState::makeState(const string & name) {
     assertTrue(name.length() > 0);
 
     if (nameTable.count(name) <= 0) {
-        shared_ptr<FstmState> state(new FstmState(name));
+        shared_ptr<FstmState> state(new FstmState(name, nameTable.size()));
         nameTable.insert(make_pair(name, state));
     }
     return nameTable[name];
 }
 
+unsigned int FstmState::getNbOfStates() {
+    return nameTable.size();
+}
+
 // private methods
 void FstmState::checkRep() const {
     if (doCheckRep) {
@@ -63,6 +71,7 @@ void FstmState::checkRep() const {
         unordered_map<string, shared_ptr<FstmState> >::const_iterator it;
         for (it = nameTable.begin(); it != nameTable.end(); ++it) {
             assertTrue(it->first == it->second->getName());
+            assertTrue(it->second->getId() < nameTable.size());
         }
     }
 }
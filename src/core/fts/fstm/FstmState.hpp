@@ -23,8 +23,10 @@ namespace fstm {
 /**
  * FstmStates are immutable states of a featured state machine (FSTM). An
  * FSTM state has a name, aka a label, and for each unique name there is at most
- * one state. Because FstmStates implement the State interface, FSTM states can
- * also be considered as FTS states.
+ * one state. Each state also has a unique id, the states being numbered from 0
+ * in the order of their creation, so that tables can be indexed by state.
+ * Because FstmStates implement the State interface, FSTM states can also be
+ * considered as FTS states.
  *
  * @author mwi
  */
@@ -34,18 +36,20 @@ private:
     static std::tr1::unordered_map<std::string, FstmStatePtr> nameTable;
 
     const std::string name;
+    const unsigned int id;
 
     /*
      * Representation Invariant:
      *   I(c) = c.name.length > 0
-     *     for all <name, state> in c.nameTable .(name = state.name)
+     *     for all <name, state> in c.nameTable .(name = state.name &&
+     *       state.id < c.nameTable.size)
      */
 
     /**
      * @requires name not empty
-     * @effects Makes this be a new FSTM state named 'name'.
+     * @effects Makes this be a new FSTM state named 'name' with id 'id'.
      */
-    explicit FstmState(const std::string & name);
+    FstmState(const std::string & name, unsigned int id);
 
 public:
     // overridden methods
@@ -53,12 +57,23 @@ public:
     bool equals(const State & state) const;
     unsigned int hashCode() const;
 
+    /**
+     * @return the id of this.
+     */
+    unsigned int getId() const;
+
     /**
      * @requires name not empty
      * @return the state named 'name'.
      */
     static FstmStatePtr makeState(const std::string & name);
 
+    /**
+     * @return the number of states created so far, i.e., an upper bound of
+     *          their ids.
+     */
+    static unsigned int getNbOfStates();
+
 private:
     /**
      * @effects Asserts the rep invariant holds for this.
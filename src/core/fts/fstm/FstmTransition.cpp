@@ -24,8 +24,9 @@ namespace fts {
 namespace fstm {
 
 FstmTransition::FstmTransition(const string & source, const string &
-        target, const string & event, const FeatureExpPtr & featureExp)
-    : source(), target(), event(), featureExp(featureExp) {
+        target, const string & event, const FeatureExpPtr & featureExp,
+        int guardId)
+    : source(), target(), event(), featureExp(featureExp), guardId(guardId) {
     assertTrue(source.length() > 0);
     assertTrue(target.length() > 0);
     assertTrue(event.length() > 0);
@@ -53,12 +54,21 @@ FeatureExpPtr FstmTransition::getFeatureExp() const {
     return FeatureExpPtr(featureExp->clone());
 }
 
+int FstmTransition::getGuardId() const {
+    return guardId;
+}
+
+int FstmTransition::getEventId() const {
+    return event->getId();
+}
+
 void FstmTransition::checkRep() const {
     if (doCheckRep) {
         assertTrue(source);
         assertTrue(target);
         assertTrue(event);
         assertTrue(featureExp);
+        assertTrue(guardId >= -1);
     }
 }
 
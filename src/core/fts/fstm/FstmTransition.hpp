@@ -25,6 +25,7 @@ namespace fstm {
  *   - target : FstmState      // The target state of the transition.
  *   - event  : FstmEvent      // The event of the transition.
  *   - featureExp : FeatureExp // The feature expression of the transition.
+ *   - guardId : int           // The id of the feature expression.
  *
  * @author mwi
  */
@@ -35,6 +36,7 @@ private:
     FstmStatePtr target;
     FstmEventPtr event;
     const core::features::FeatureExpPtr featureExp;
+    const int guardId;
 
     /*
      * Abstraction Function:
@@ -43,25 +45,28 @@ private:
      *     t.target = c.target
      *     t.event = c.event
      *     t.featureExp = c.featureExp
+     *     t.guardId = c.guardId
      *
      * Representation Invariant:
      *   I(c) = c.source != null
      *     c.target != null
      *     c.event != null
      *     c.featureExp != null
+     *     c.guardId >= -1
      */
 
 public:
     /**
      * @requires source, target, and event are not empty && featureExp
-     *            is not null
+     *            is not null && guardId >= -1
      * @effects Makes this be a new FstmTransition t with t.source =
      *           FstmState(source), t.target = FstmState(target), t.event =
-     *           FstmState(event) and t.featureExp = featureExp.
+     *           FstmState(event), t.featureExp = featureExp and t.guardId =
+     *           guardId.
      */
     FstmTransition(const std::string & source, const std::string & target,
         const std::string & event,
-        const core::features::FeatureExpPtr & featureExp);
+        const core::features::FeatureExpPtr & featureExp, int guardId = -1);
 
     // The default destructor is fine.
 
@@ -85,6 +90,16 @@ public:
      */
     core::features::FeatureExpPtr getFeatureExp() const;
 
+    /**
+     * @return this.guardId
+     */
+    int getGuardId() const;
+
+    /**
+     * @return the id of this.event
+     */
+    int getEventId() const;
+
 private:
     /**
      * @effects Asserts the rep invariant holds for this.
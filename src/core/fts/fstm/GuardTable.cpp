@@ -0,0 +1,92 @@
+/*
+ * GuardTable.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "GuardTable.hpp"
+
+#include "core/features/FeatureExp.hpp"
+#include "util/Assert.hpp"
+
+#include <cctype>
+
+using core::features::FeatureExpPtr;
+using std::string;
+using std::tr1::unordered_map;
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+// constructors
+GuardTable::GuardTable() : ids(), guards() {
+    checkRep();
+}
+
+// public methods
+int GuardTable::find(const string & key) const {
+    unordered_map<string, int>::const_iterator it = ids.find(key);
+    return it != ids.end() ? it->second : -1;
+}
+
+int GuardTable::add(const string & key, const FeatureExpPtr & guard) {
+    assertTrue(find(key) < 0);
+    assertTrue(guard);
+
+    int id = guards.size();
+    ids.insert(std::make_pair(key, id));
+    guards.push_back(guard);
+
+    checkRep();
+    return id;
+}
+
+const FeatureExpPtr & GuardTable::getGuard(int id) const {
+    assertTrue(0 <= id && id < size());
+
+    return guards[id];
+}
+
+int GuardTable::size() const {
+    return guards.size();
+}
+
+// static public methods
+string GuardTable::normalize(const string & featureExp) {
+    string normalized;
+    normalized.reserve(featureExp.length());
+
+    // A run of whitespaces is dropped, unless it separates two identifiers.
+    bool pendingSpace = false;
+    string::const_iterator it;
+    for (it = featureExp.begin(); it != featureExp.end(); ++it) {
+        if (isspace(static_cast<unsigned char>(*it))) {
+            pendingSpace = true;
+            continue;
+        }
+        if (pendingSpace && !normalized.empty()
+                && isIdentifierChar(normalized[normalized.length() - 1])
+                && isIdentifierChar(*it)) {
+            normalized += ' ';
+        }
+        pendingSpace = false;
+        normalized += *it;
+    }
+    return normalized;
+}
+
+// private methods
+bool GuardTable::isIdentifierChar(char c) {
+    return isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+void GuardTable::checkRep() const {
+    if (doCheckRep) {
+        assertTrue(ids.size() == guards.size());
+    }
+}
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
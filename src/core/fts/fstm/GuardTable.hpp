@@ -0,0 +1,107 @@
+/*
+ * GuardTable.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef CORE_FTS_FSTM_GUARDTABLE_HPP
+#define CORE_FTS_FSTM_GUARDTABLE_HPP
+
+#include "core/features/forwards.hpp"
+#include "util/Uncopyable.hpp"
+
+#include <string>
+#include <tr1/unordered_map>
+#include <vector>
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+/**
+ * GuardTable is a table of the distinct guards, i.e., feature expressions, of
+ * the transitions of an FSTM. Each guard is identified by a key, e.g., its
+ * normalized text, and is given an id, so that the transitions with the same
+ * guard share the same feature expression.
+ *
+ * Specification Fields:
+ *   - guards : sequence of <key, FeatureExp>  // The guards, indexed by id.
+ *
+ * @author mwi
+ */
+class GuardTable : private util::Uncopyable {
+
+private:
+    std::tr1::unordered_map<std::string, int> ids;
+    std::vector<core::features::FeatureExpPtr> guards;
+
+    /*
+     * Abstraction Function:
+     *   AF(c) = GuardTable t such that
+     *     t.guards[i] = <k, c.guards[i]> for all <k, i> in c.ids
+     *
+     * Representation Invariant:
+     *   I(c) = c.ids.size = c.guards.size &&
+     *     the values of c.ids are 0 .. c.guards.size - 1 &&
+     *     all the pointers in c.guards are not null
+     */
+
+public:
+    /**
+     * @effects Makes this be a new empty guard table.
+     */
+    GuardTable();
+
+    // The default destructor is fine.
+
+    /**
+     * @return the id of the guard with key 'key' in this, or -1 if there is
+     *          no such guard.
+     */
+    int find(const std::string & key) const;
+
+    /**
+     * @requires find(key) = -1 && guard != null
+     * @modifies this
+     * @effects Adds to this the guard 'guard' with key 'key'.
+     * @return the id of the added guard.
+     */
+    int add(const std::string & key,
+        const core::features::FeatureExpPtr & guard);
+
+    /**
+     * @requires 0 <= id < size()
+     * @return the guard with id 'id'.
+     */
+    const core::features::FeatureExpPtr & getGuard(int id) const;
+
+    /**
+     * @return the number of guards of this.
+     */
+    int size() const;
+
+    /**
+     * @return the feature expression 'featureExp' without the whitespaces
+     *          that do not separate two identifiers, so that two feature
+     *          expressions differing only by such whitespaces have the same
+     *          key.
+     */
+    static std::string normalize(const std::string & featureExp);
+
+private:
+    /**
+     * @return true iff 'c' may be part of a feature name.
+     */
+    static bool isIdentifierChar(char c);
+
+    /**
+     * @effects Asserts the rep invariant holds for this.
+     */
+    void checkRep() const;
+};
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
+
+#endif /* CORE_FTS_FSTM_GUARDTABLE_HPP */
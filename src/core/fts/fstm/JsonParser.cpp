@@ -72,7 +72,7 @@ shared_ptr<Generator<string> > JsonParser::states() const {
 JsonParser::TransitionGenerator::TransitionGenerator(const Json::Value &
         transitions, const BoolFeatureExpFactory & featureExpFactory)
     : transitions(transitions), index(0),
-        featureExpFactory(featureExpFactory) {}
+        featureExpFactory(featureExpFactory), guards() {}
 
 bool JsonParser::TransitionGenerator::hasNext() const {
     return index < transitions.size();
@@ -84,12 +84,18 @@ FstmTransitionPtr JsonParser::TransitionGenerator::next() {
     Json::Value transition = transitions[index];
     index++;
 
-    BoolExpParser boolExpParser(transition["featureExp"].asString());
+    string featureExp = transition["featureExp"].asString();
+    string key = GuardTable::normalize(featureExp);
+    int guardId = guards.find(key);
+    if (guardId < 0) {
+        BoolExpParser boolExpParser(featureExp);
+        guardId = guards.add(key, toFeatureExp(boolExpParser.parse()));
+    }
 
     return FstmTransitionPtr(new FstmTransition(
             transition["source"].asString(),
             transition["target"].asString(), transition["event"].asString(),
-            toFeatureExp(boolExpParser.parse())));
+            guards.getGuard(guardId), guardId));
 }
 
 FeatureExpPtr JsonParser::TransitionGenerator::toFeatureExp(const BoolExpPtr &
@@ -8,6 +8,8 @@
 #define CORE_FTS_FSTM_JSONADAPTER_HPP
 
 #include "forwards.hpp"
+#include "FstmParser.hpp"
+#include "GuardTable.hpp"
 #include "core/features/BoolFeatureExpFactory.hpp"
 #include "util/Generator.hpp"
 #include "util/parser/forwards.hpp"
@@ -30,7 +32,7 @@ class FstmTransition;
  *
  * @author mwi
  */
-class JsonParser {
+class JsonParser : public FstmParser {
 
 private:
     const core::features::BoolFeatureExpFactory & featureExpFactory;
@@ -47,35 +49,11 @@ public:
     JsonParser(std::istream & jsonFstm, const
         core::features::BoolFeatureExpFactory & featureExpFactory);
 
-    /**
-     * @return the number of transitions of the JSON FSTM.
-     */
+    // overridden methods
     int getNbOfTransitions() const;
-
-    /**
-     * @return a generator that will produce all the transitions of the
-     *          JSON FSTM (as FstmTransitions), each exactly once, in the
-     *          order they have in the parsed FSTM.
-     */
     FstmTransitionGeneratorPtr transitions() const;
-
-    /**
-     * @return the number of LTL properties of the JSON FSTM.
-     */
     int getNbOfProperties() const;
-
-    /**
-     * @return a generator that will produce all the LTL properties of the JSON
-     *          FSTM (as strings), each exactly once, in the order they have in
-     *          the parsed FSTM.
-     */
     std::tr1::shared_ptr<util::Generator<std::string> > properties() const;
-
-    /**
-     * @return a generator that will produce all the states of the JSON FSTM
-     *          (as strings), each exactly once, in the order they have in the
-     *          parsed FSTM.
-     */
     std::tr1::shared_ptr<util::Generator<std::string> > states() const;
 
 private:
@@ -88,6 +66,8 @@ private:
         const Json::Value & transitions;
         unsigned int index;
         const core::features::BoolFeatureExpFactory & featureExpFactory;
+        /* The distinct feature expressions generated so far. */
+        GuardTable guards;
 
     public:
         /**
@@ -0,0 +1,355 @@
+/*
+ * ProductGraph.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "ProductGraph.hpp"
+
+#include "ClaimGuard.hpp"
+#include "ClaimPropertyAutomaton.hpp"
+#include "FstmEvent.hpp"
+#include "FstmState.hpp"
+#include "FstmTransition.hpp"
+#include "TransitionTable.hpp"
+
+#include "core/features/FeatureExp.hpp"
+
+#include "neverclaim/ClaimState.hpp"
+
+#include "util/Assert.hpp"
+
+#include <glog/logging.h>
+
+#include <tr1/unordered_map>
+#include <utility>
+
+using core::features::FeatureExpPtr;
+
+using neverclaim::ClaimStatePtr;
+
+using std::make_pair;
+using std::pair;
+using std::string;
+using std::vector;
+using std::tr1::unordered_map;
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+const unsigned int ProductGraph::FINAL;
+
+// constructors
+ProductGraph::ProductGraph(const TransitionTablePtr & transitionTable,
+        const ClaimPropertyAutomatonPtr & claim)
+        : transitionTable(transitionTable), claim(claim), nodes(), offsets(),
+          edges(), guards(), fstmStates() {
+    assertTrue(transitionTable);
+    assertTrue(claim);
+
+    vector<bool> useful;
+    vector<bool> blocked;
+    build(useful, blocked);
+    const unsigned int nbOfBuiltNodes = nodes.size();
+    prune(useful, blocked);
+
+    LOG(INFO) << "Product graph: " << nodes.size() << " nodes ("
+              << nbOfBuiltNodes - nodes.size() << " pruned), "
+              << edges.size() << " edges, " << guards.size() << " guards.";
+
+    checkRep();
+}
+
+// public methods
+bool ProductGraph::isEmpty() const {
+    return nodes.empty();
+}
+
+unsigned int ProductGraph::getNbOfNodes() const {
+    return nodes.size();
+}
+
+unsigned int ProductGraph::firstEdgeOf(unsigned int node) const {
+    assertTrue(node < nodes.size());
+
+    return offsets[node];
+}
+
+unsigned int ProductGraph::endEdgeOf(unsigned int node) const {
+    assertTrue(node < nodes.size());
+
+    return offsets[node + 1];
+}
+
+const ProductGraph::Edge & ProductGraph::getEdge(unsigned int index) const {
+    assertTrue(index < edges.size());
+
+    return edges[index];
+}
+
+const FeatureExpPtr & ProductGraph::getGuard(unsigned int handle) const {
+    assertTrue(handle < guards.size());
+
+    return guards[handle];
+}
+
+const FstmStatePtr & ProductGraph::getFstmState(unsigned int node) const {
+    assertTrue(node < nodes.size());
+
+    return fstmStates[nodes[node].fstmState];
+}
+
+ClaimStatePtr ProductGraph::getClaimState(unsigned int node) const {
+    assertTrue(node < nodes.size());
+
+    return claim->getClaimState(nodes[node].claimState);
+}
+
+FstmStatePtr ProductGraph::getFstmTarget(unsigned int index) const {
+    assertTrue(index < edges.size());
+
+    return transitionTable->getTransition(edges[index].transition)
+            ->getTarget();
+}
+
+bool ProductGraph::isAccepting(unsigned int node) const {
+    return getClaimState(node)->isAccepting();
+}
+
+unsigned long ProductGraph::bytes() const {
+    return sizeof(*this)
+            + nodes.capacity() * sizeof(Node)
+            + offsets.capacity() * sizeof(unsigned int)
+            + edges.capacity() * sizeof(Edge)
+            + guards.capacity() * sizeof(FeatureExpPtr)
+            + fstmStates.capacity() * sizeof(FstmStatePtr);
+}
+
+// private methods
+void ProductGraph::build(vector<bool> & useful, vector<bool> & blocked) {
+    typedef unordered_map<unsigned long long, unsigned int> NodeTable;
+    NodeTable ids;
+    /* Each guard id, or each transition index for the transitions without
+     * guard id (stored as -1 - index), is given a single handle. */
+    typedef unordered_map<long, unsigned int> HandleTable;
+    HandleTable handles;
+    /* Each FSTM state id is given an index in fstmStates, so that the graph
+     * does not depend on the number of states of the process. */
+    typedef unordered_map<unsigned int, unsigned int> IndexTable;
+    IndexTable fstmIndexes;
+    vector<int> stateVariables;
+    vector<int> eventVariables;
+    vector<unsigned int> enabled;
+    const unsigned long long nbOfClaimStates = claim->getNbOfClaimStates();
+
+    const FstmStatePtr initialState = transitionTable->getInitialState();
+    fstmStates.push_back(initialState);
+    fstmIndexes.insert(make_pair(initialState->getId(), 0u));
+    nodes.push_back(Node(0, 0, ClaimGuard::NO_VARIABLE));
+    ids.insert(make_pair(0ULL, 0u));
+
+    // The nodes are numbered in breadth-first order.
+    for (unsigned int id = 0; id < nodes.size(); id++) {
+        offsets.push_back(edges.size());
+
+        const Node node = nodes[id];
+        const FstmState & state = *fstmStates[node.fstmState];
+        const int stateVariable = lookup(stateVariables, state.getId(),
+                state.getName());
+
+        enabled.clear();
+        const unsigned int endClaim = claim->endIndexOf(node.claimState);
+        for (unsigned int c = claim->firstIndexOf(node.claimState);
+                c < endClaim; c++) {
+            if (claim->getGuardOf(c).eval(stateVariable,
+                    node.eventVariable)) {
+                enabled.push_back(c);
+            }
+        }
+        useful.push_back(claim->getClaimState(node.claimState)
+                ->isAccepting());
+        blocked.push_back(enabled.empty());
+        if (enabled.empty()) {
+            continue;
+        }
+
+        const unsigned int end = transitionTable->endIndexOf(state);
+        for (unsigned int i = transitionTable->firstIndexOf(state); i < end;
+                i++) {
+            const FstmTransitionPtr & t = transitionTable->getTransition(i);
+            const FstmStatePtr target = t->getTarget();
+            const FstmEventPtr event = t->getEvent();
+            const int eventVariable = lookup(eventVariables, event->getId(),
+                    event->getName());
+            pair<IndexTable::iterator, bool> targetIndex = fstmIndexes.insert(
+                    make_pair(target->getId(),
+                        (unsigned int) fstmStates.size()));
+            if (targetIndex.second) {
+                fstmStates.push_back(target);
+            }
+            const unsigned long long targetFstmState =
+                    targetIndex.first->second;
+
+            const long guardKey = t->getGuardId() >= 0 ? t->getGuardId()
+                    : -1L - (long) i;
+            pair<HandleTable::iterator, bool> handle = handles.insert(
+                    make_pair(guardKey, (unsigned int) guards.size()));
+            if (handle.second) {
+                guards.push_back(t->getFeatureExp());
+            }
+
+            const unsigned int firstEdge = edges.size();
+            vector<unsigned int>::const_iterator c;
+            for (c = enabled.begin(); c != enabled.end(); ++c) {
+                const unsigned int claimTarget = claim->getTargetOf(*c);
+                if (claim->getClaimState(claimTarget)->isFinal()) {
+                    /* Reaching the final state reveals an error, after which
+                     * the other claim transitions are not taken. */
+                    edges.push_back(Edge(FINAL, i, handle.first->second));
+                    useful.back() = true;
+                    break;
+                }
+
+                const unsigned long long key = ((targetFstmState
+                        * nbOfClaimStates + claimTarget) << 32)
+                        | (unsigned int) (eventVariable + 1);
+                pair<NodeTable::iterator, bool> next = ids.insert(
+                        make_pair(key, (unsigned int) nodes.size()));
+                if (next.second) {
+                    nodes.push_back(Node(targetFstmState, claimTarget,
+                            eventVariable));
+                }
+
+                bool duplicate = false;
+                for (unsigned int e = firstEdge; e < edges.size(); e++) {
+                    duplicate = duplicate
+                            || edges[e].target == next.first->second;
+                }
+                if (!duplicate) {
+                    edges.push_back(Edge(next.first->second, i,
+                            handle.first->second));
+                }
+            }
+        }
+    }
+    offsets.push_back(edges.size());
+}
+
+void ProductGraph::prune(const vector<bool> & useful,
+        const vector<bool> & blocked) {
+    const unsigned int nbOfNodes = nodes.size();
+
+    // The predecessors of each node, in a compressed sparse row layout.
+    vector<unsigned int> predOffsets(nbOfNodes + 1, 0);
+    for (unsigned int n = 0; n < nbOfNodes; n++) {
+        for (unsigned int e = offsets[n]; e < offsets[n + 1]; e++) {
+            if (edges[e].target != FINAL) {
+                predOffsets[edges[e].target + 1]++;
+            }
+        }
+    }
+    for (unsigned int n = 0; n < nbOfNodes; n++) {
+        predOffsets[n + 1] += predOffsets[n];
+    }
+    vector<unsigned int> preds(predOffsets[nbOfNodes]);
+    vector<unsigned int> cursors(predOffsets.begin(), predOffsets.end() - 1);
+    for (unsigned int n = 0; n < nbOfNodes; n++) {
+        for (unsigned int e = offsets[n]; e < offsets[n + 1]; e++) {
+            if (edges[e].target != FINAL) {
+                preds[cursors[edges[e].target]++] = n;
+            }
+        }
+    }
+
+    // Keeps the nodes not blocked from which a useful node is reachable.
+    vector<bool> kept(nbOfNodes, false);
+    vector<unsigned int> pending;
+    for (unsigned int n = 0; n < nbOfNodes; n++) {
+        if (useful[n] && !blocked[n]) {
+            kept[n] = true;
+            pending.push_back(n);
+        }
+    }
+    while (!pending.empty()) {
+        const unsigned int n = pending.back();
+        pending.pop_back();
+        for (unsigned int p = predOffsets[n]; p < predOffsets[n + 1]; p++) {
+            if (!kept[preds[p]] && !blocked[preds[p]]) {
+                kept[preds[p]] = true;
+                pending.push_back(preds[p]);
+            }
+        }
+    }
+
+    if (!kept[0]) {
+        nodes.clear();
+        edges.clear();
+        offsets.assign(1, 0);
+        return;
+    }
+
+    // Renumbers the kept nodes in order, so that the initial node stays 0.
+    vector<unsigned int> newIds(nbOfNodes);
+    unsigned int nbOfKeptNodes = 0;
+    for (unsigned int n = 0; n < nbOfNodes; n++) {
+        newIds[n] = nbOfKeptNodes;
+        if (kept[n]) {
+            nodes[nbOfKeptNodes++] = nodes[n];
+        }
+    }
+
+    vector<unsigned int> keptOffsets;
+    vector<Edge> keptEdges;
+    keptOffsets.reserve(nbOfKeptNodes + 1);
+    for (unsigned int n = 0; n < nbOfNodes; n++) {
+        if (!kept[n]) {
+            continue;
+        }
+        keptOffsets.push_back(keptEdges.size());
+        for (unsigned int e = offsets[n]; e < offsets[n + 1]; e++) {
+            const Edge & edge = edges[e];
+            if (edge.target == FINAL) {
+                keptEdges.push_back(edge);
+            } else if (kept[edge.target]) {
+                keptEdges.push_back(Edge(newIds[edge.target],
+                        edge.transition, edge.guard));
+            }
+        }
+    }
+    keptOffsets.push_back(keptEdges.size());
+
+    nodes.resize(nbOfKeptNodes, nodes[0]);
+    offsets.swap(keptOffsets);
+    edges.swap(keptEdges);
+}
+
+int ProductGraph::lookup(vector<int> & fstmVariables, unsigned int id,
+        const string & name) const {
+    if (id >= fstmVariables.size()) {
+        fstmVariables.resize(id + 1, ClaimGuard::NO_VARIABLE - 1);
+    }
+    if (fstmVariables[id] < ClaimGuard::NO_VARIABLE) {
+        fstmVariables[id] = claim->getVariable(name);
+    }
+    return fstmVariables[id];
+}
+
+void ProductGraph::checkRep() const {
+    if (doCheckRep) {
+        assertTrue(transitionTable);
+        assertTrue(claim);
+        assertTrue(offsets.size() == nodes.size() + 1);
+        assertTrue(offsets[0] == 0);
+        assertTrue(offsets[nodes.size()] == edges.size());
+        vector<Edge>::const_iterator it;
+        for (it = edges.begin(); it != edges.end(); ++it) {
+            assertTrue(it->target == FINAL || it->target < nodes.size());
+            assertTrue(it->guard < guards.size());
+        }
+    }
+}
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
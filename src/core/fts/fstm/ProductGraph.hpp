@@ -0,0 +1,229 @@
+/*
+ * ProductGraph.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef CORE_FTS_FSTM_PRODUCTGRAPH_HPP
+#define CORE_FTS_FSTM_PRODUCTGRAPH_HPP
+
+#include "forwards.hpp"
+#include "core/features/forwards.hpp"
+#include "neverclaim/forwards.hpp"
+#include "util/Uncopyable.hpp"
+
+#include <vector>
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+/**
+ * ProductGraph is the immutable synchronous product of an FSTM and of the
+ * never claim of its property, computed once without features.
+ *
+ * The transitions of the never claim enabled in a state of the FSTM only
+ * depend on this state and on the event of the transition that led to it.
+ * A node of the product is thus a triple <s, e, q> where s is a state of the
+ * FSTM, e is the claim variable named after the last event (if any) and q is
+ * a state of the never claim. There is an edge from <s, e, q> to <s', e', q'>
+ * for each FSTM transition t from s to s' with event e' and each claim
+ * transition from q to q' enabled in <s, e>, the edge being guarded by the
+ * feature expression of t. The edges reaching a final state of the never claim
+ * are kept apart (see FINAL) since they reveal an error as soon as they are
+ * taken.
+ *
+ * Only the nodes reachable from the initial node are built, and the nodes
+ * from which no accepting node and no final edge is reachable are pruned,
+ * along with the nodes where the never claim is blocked, since no error can
+ * be found from them. The nodes and their edges are stored in a compressed
+ * sparse row layout, the edges leaving a node being in the order in which
+ * NestedSearch takes them.
+ *
+ * @author mwi
+ */
+class ProductGraph : private util::Uncopyable {
+
+public:
+    /* The target of the edges reaching a final state of the never claim. */
+    static const unsigned int FINAL = ~0u;
+
+    /**
+     * An edge of the product.
+     */
+    struct Edge {
+        /* The id of the target node, or FINAL. */
+        unsigned int target;
+        /* The index of the FSTM transition in the transition table. */
+        unsigned int transition;
+        /* The handle of the feature expression guarding the edge. */
+        unsigned int guard;
+
+        Edge(unsigned int target, unsigned int transition, unsigned int guard)
+            : target(target), transition(transition), guard(guard) {}
+    };
+
+private:
+    /**
+     * A node of the product.
+     */
+    struct Node {
+        /* The index of the FSTM state in fstmStates. */
+        unsigned int fstmState;
+        /* The id of the never claim state. */
+        unsigned int claimState;
+        /* The claim variable named after the last event, or NO_VARIABLE. */
+        int eventVariable;
+
+        Node(unsigned int fstmState, unsigned int claimState,
+            int eventVariable)
+            : fstmState(fstmState), claimState(claimState),
+              eventVariable(eventVariable) {}
+    };
+
+    TransitionTablePtr transitionTable;
+    ClaimPropertyAutomatonPtr claim;
+    std::vector<Node> nodes;
+    /* The edges leaving the node with id i are at the indexes offsets[i] to
+     * offsets[i + 1] - 1 of edges. */
+    std::vector<unsigned int> offsets;
+    std::vector<Edge> edges;
+    /* The distinct feature expressions of the edges, indexed by handle. */
+    std::vector<core::features::FeatureExpPtr> guards;
+    /* The FSTM states of the nodes, in the order they are reached. */
+    std::vector<FstmStatePtr> fstmStates;
+
+    /*
+     * Abstraction Function:
+     *   AF(c) = product graph g such that
+     *     g.nodes = c.nodes, the initial node being c.nodes[0] if any
+     *     g.edges(n) = c.edges[c.offsets[n] .. c.offsets[n + 1] - 1]
+     *
+     * Representation Invariant:
+     *   I(c) = c.transitionTable != null && c.claim != null
+     *     c.offsets.size = c.nodes.size + 1 && c.offsets[0] = 0 &&
+     *       c.offsets[c.nodes.size] = c.edges.size
+     *     for all edges e in c.edges .((e.target = FINAL ||
+     *       e.target < c.nodes.size) && e.guard < c.guards.size)
+     */
+
+public:
+    /**
+     * @requires transitionTable != null && claim != null && claim is the
+     *            never claim of the FSTM with transition table
+     *            'transitionTable'
+     * @effects Makes this be the product of the FSTM with transition table
+     *           'transitionTable' and of the never claim 'claim', in its
+     *           initial state.
+     */
+    ProductGraph(const TransitionTablePtr & transitionTable,
+        const ClaimPropertyAutomatonPtr & claim);
+
+    // The default destructor is fine.
+
+    /**
+     * @return true iff this has no node, i.e., iff no error can be found.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @return the number of nodes of this, numbered from 0, the initial node
+     *          being 0.
+     */
+    unsigned int getNbOfNodes() const;
+
+    /**
+     * @requires node < getNbOfNodes()
+     * @return the index of the first edge leaving 'node', the edges leaving
+     *          it being at the indexes firstEdgeOf(node) to
+     *          endEdgeOf(node) - 1.
+     */
+    unsigned int firstEdgeOf(unsigned int node) const;
+
+    /**
+     * @requires node < getNbOfNodes()
+     * @return the index following the last edge leaving 'node'.
+     */
+    unsigned int endEdgeOf(unsigned int node) const;
+
+    /**
+     * @requires index is the index of an edge
+     * @return the edge at 'index'.
+     */
+    const Edge & getEdge(unsigned int index) const;
+
+    /**
+     * @requires handle is the guard handle of an edge
+     * @return the feature expression with handle 'handle'.
+     */
+    const core::features::FeatureExpPtr & getGuard(unsigned int handle) const;
+
+    /**
+     * @requires node < getNbOfNodes()
+     * @return the state of the FSTM of 'node'.
+     */
+    const FstmStatePtr & getFstmState(unsigned int node) const;
+
+    /**
+     * @requires node < getNbOfNodes()
+     * @return the state of the never claim of 'node'.
+     */
+    neverclaim::ClaimStatePtr getClaimState(unsigned int node) const;
+
+    /**
+     * @requires index is the index of an edge
+     * @return the target state of the FSTM transition of the edge at 'index'.
+     */
+    FstmStatePtr getFstmTarget(unsigned int index) const;
+
+    /**
+     * @requires node < getNbOfNodes()
+     * @return true iff the state of the never claim of 'node' is accepting.
+     */
+    bool isAccepting(unsigned int node) const;
+
+    /**
+     * @return an estimation of the number of bytes allocated by this,
+     *          excluding the memory owned by the FSTM, the never claim and
+     *          the feature expressions.
+     */
+    unsigned long bytes() const;
+
+private:
+    /**
+     * @modifies this
+     * @effects Builds the nodes reachable from the initial node and their
+     *           edges, and marks in 'useful' the nodes that are accepting or
+     *           have a final edge and in 'blocked' those where the never
+     *           claim has no enabled transition.
+     */
+    void build(std::vector<bool> & useful, std::vector<bool> & blocked);
+
+    /**
+     * @modifies this
+     * @effects Removes the nodes blocked or from which no useful node is
+     *           reachable, and the edges reaching them.
+     */
+    void prune(const std::vector<bool> & useful,
+        const std::vector<bool> & blocked);
+
+    /**
+     * @modifies fstmVariables
+     * @return the claim variable named after the FSTM state or event with id
+     *          'id' and named 'name', which is cached at index 'id' of
+     *          'fstmVariables'.
+     */
+    int lookup(std::vector<int> & fstmVariables, unsigned int id,
+        const std::string & name) const;
+
+    /**
+     * @effects Asserts the rep invariant holds for this.
+     */
+    void checkRep() const;
+};
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
+
+#endif /* CORE_FTS_FSTM_PRODUCTGRAPH_HPP */
@@ -0,0 +1,278 @@
+/*
+ * StreamingJsonParser.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "StreamingJsonParser.hpp"
+
+#include "FstmTransition.hpp"
+#include "core/features/FeatureExpGenVisitor.hpp"
+#include "util/Assert.hpp"
+#include "util/parser/BoolExp.hpp"
+#include "util/parser/BoolExpParser.hpp"
+
+#include <glog/logging.h>
+
+#include <stdexcept>
+#include <tr1/unordered_set>
+
+using core::features::BoolFeatureExpFactory;
+using core::features::FeatureExpGenVisitor;
+using core::features::FeatureExpGenVisitorPtr;
+using core::features::FeatureExpPtr;
+using std::istream;
+using std::logic_error;
+using std::string;
+using std::tr1::shared_ptr;
+using std::tr1::unordered_set;
+using std::vector;
+using util::Generator;
+using util::ThreadPool;
+using util::parser::BoolExpParser;
+using util::parser::BoolExpPtr;
+using util::parser::JsonReader;
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+// constructors
+StreamingJsonParser::StreamingJsonParser(istream & jsonFstm, const
+        BoolFeatureExpFactory & featureExpFactory)
+    : featureExpFactory(featureExpFactory),
+      document(new Document(jsonFstm)) {
+    document->reader.beginObject();
+    readMembers(*document);
+}
+
+StreamingJsonParser::Document::Document(istream & jsonFstm)
+    : reader(jsonFstm), nbOfTransitions(0), nbOfReadTransitions(0),
+      nbOfProperties(0), states(),
+      properties(), hasHeader(false), moreTransitions(false),
+      transitionsGenerated(false) {}
+
+// public methods
+int StreamingJsonParser::getNbOfTransitions() const {
+    return document->hasHeader ? document->nbOfTransitions
+            : document->nbOfReadTransitions;
+}
+
+FstmTransitionGeneratorPtr StreamingJsonParser::transitions() const {
+    assertTrue(!document->transitionsGenerated);
+
+    document->transitionsGenerated = true;
+    return FstmTransitionGeneratorPtr(new TransitionGenerator(document,
+            featureExpFactory, ThreadPool::getNbOfCores()));
+}
+
+int StreamingJsonParser::getNbOfProperties() const {
+    return document->nbOfProperties;
+}
+
+shared_ptr<Generator<string> > StreamingJsonParser::properties() const {
+    return shared_ptr<Generator<string> >(
+            new StringVectorGenerator(document, document->properties));
+}
+
+shared_ptr<Generator<string> > StreamingJsonParser::states() const {
+    return shared_ptr<Generator<string> >(
+            new StringVectorGenerator(document, document->states));
+}
+
+// private methods
+void StreamingJsonParser::readMembers(Document & document) {
+    JsonReader & reader = document.reader;
+
+    while (reader.hasNext()) {
+        string name = reader.nextName();
+        if (name == "FSTM") {
+            readHeader(document);
+        } else if (name == "states") {
+            readStrings(document, document.states);
+        } else if (name == "ltlProperties") {
+            readStrings(document, document.properties);
+        } else if (name == "transitions") {
+            reader.beginArray();
+            if (reader.hasNext()) {
+                document.moreTransitions = true;
+                return;
+            }
+            reader.endArray();
+        } else {
+            reader.skipValue();
+        }
+    }
+    reader.endObject();
+}
+
+void StreamingJsonParser::readHeader(Document & document) {
+    JsonReader & reader = document.reader;
+
+    reader.beginObject();
+    while (reader.hasNext()) {
+        string name = reader.nextName();
+        if (name == "nbOfTransitions") {
+            document.nbOfTransitions = reader.nextInt();
+        } else if (name == "nbOfLtlProperties") {
+            document.nbOfProperties = reader.nextInt();
+        } else {
+            reader.skipValue();
+        }
+    }
+    reader.endObject();
+    document.hasHeader = true;
+}
+
+void StreamingJsonParser::readStrings(Document & document,
+        vector<string> & strings) {
+    JsonReader & reader = document.reader;
+
+    strings.clear();
+    reader.beginArray();
+    while (reader.hasNext()) {
+        strings.push_back(reader.nextString());
+    }
+    reader.endArray();
+}
+
+// guard parsing task
+StreamingJsonParser::GuardParsingTask::GuardParsingTask(
+        vector<PendingTransition> & batch, const vector<unsigned int> &
+        toParse) : batch(batch), toParse(toParse) {}
+
+void StreamingJsonParser::GuardParsingTask::run(unsigned int index) {
+    PendingTransition & transition = batch[toParse[index]];
+    try {
+        BoolExpParser boolExpParser(transition.featureExp);
+        transition.guard = boolExpParser.parse();
+    } catch (const logic_error & e) {
+        transition.error = e.what();
+    }
+}
+
+// transition generator
+StreamingJsonParser::TransitionGenerator::TransitionGenerator(const
+        shared_ptr<Document> & document, const BoolFeatureExpFactory &
+        featureExpFactory, unsigned int nbOfThreads)
+    : document(document), featureExpFactory(featureExpFactory),
+      pool(nbOfThreads), batch(), index(0), guards() {}
+
+bool StreamingJsonParser::TransitionGenerator::hasNext() const {
+    return index < batch.size() || document->moreTransitions;
+}
+
+FstmTransitionPtr StreamingJsonParser::TransitionGenerator::next() {
+    assertTrue(hasNext());
+
+    if (index >= batch.size()) {
+        readBatch();
+    }
+
+    const PendingTransition & transition = batch[index];
+    index++;
+
+    int guardId = guards.find(transition.key);
+    if (guardId < 0) {
+        // First occurrence of the feature expression, parsed by readBatch.
+        if (!transition.guard) {
+            // Same error as if the feature expression were parsed here.
+            throw logic_error(transition.error);
+        }
+        guardId = guards.add(transition.key, toFeatureExp(transition.guard));
+    }
+
+    if (!hasNext()) {
+        DVLOG(1) << guards.size() << " distinct feature expressions";
+    }
+
+    return FstmTransitionPtr(new FstmTransition(transition.source,
+            transition.target, transition.event, guards.getGuard(guardId),
+            guardId));
+}
+
+void StreamingJsonParser::TransitionGenerator::readBatch() {
+    assertTrue(document->moreTransitions);
+
+    JsonReader & reader = document->reader;
+    batch.clear();
+    index = 0;
+
+    while (document->moreTransitions && batch.size() < BATCH_SIZE) {
+        batch.push_back(PendingTransition());
+        readTransition(batch.back());
+        document->nbOfReadTransitions++;
+
+        if (!reader.hasNext()) {
+            // The last transition has been read: reads the rest of the FSTM.
+            document->moreTransitions = false;
+            reader.endArray();
+            readMembers(*document);
+        }
+    }
+
+    // Parses only the first occurrence of the new feature expressions.
+    vector<unsigned int> toParse;
+    unordered_set<string> newKeys;
+    for (unsigned int i = 0; i < batch.size(); i++) {
+        PendingTransition & transition = batch[i];
+        transition.key = GuardTable::normalize(transition.featureExp);
+        if (guards.find(transition.key) < 0
+                && newKeys.insert(transition.key).second) {
+            toParse.push_back(i);
+        }
+    }
+
+    GuardParsingTask task(batch, toParse);
+    pool.run(task, toParse.size());
+}
+
+void StreamingJsonParser::TransitionGenerator::readTransition(
+        PendingTransition & transition) {
+    JsonReader & reader = document->reader;
+
+    reader.beginObject();
+    while (reader.hasNext()) {
+        string name = reader.nextName();
+        if (name == "source") {
+            transition.source = reader.nextString();
+        } else if (name == "target") {
+            transition.target = reader.nextString();
+        } else if (name == "event") {
+            transition.event = reader.nextString();
+        } else if (name == "featureExp"
+                && reader.peek() != JsonReader::NullValue) {
+            transition.featureExp = reader.nextString();
+        } else {
+            reader.skipValue();
+        }
+    }
+    reader.endObject();
+}
+
+FeatureExpPtr StreamingJsonParser::TransitionGenerator::toFeatureExp(const
+        BoolExpPtr & boolExp) {
+    FeatureExpGenVisitorPtr visitor(
+            new FeatureExpGenVisitor(featureExpFactory));
+    boolExp->accept(*visitor);
+    return visitor->getFeatureExp();
+}
+
+// string vector generator
+StreamingJsonParser::StringVectorGenerator::StringVectorGenerator(const
+        shared_ptr<Document> & document, const vector<string> & strings)
+    : document(document), strings(strings), index(0) {}
+
+bool StreamingJsonParser::StringVectorGenerator::hasNext() const {
+    return index < strings.size();
+}
+
+string StreamingJsonParser::StringVectorGenerator::next() {
+    assertTrue(hasNext());
+
+    return strings[index++];
+}
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
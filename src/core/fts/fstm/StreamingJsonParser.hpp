@@ -0,0 +1,261 @@
+/*
+ * StreamingJsonParser.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef CORE_FTS_FSTM_STREAMINGJSONPARSER_HPP
+#define CORE_FTS_FSTM_STREAMINGJSONPARSER_HPP
+
+#include "forwards.hpp"
+#include "FstmParser.hpp"
+#include "GuardTable.hpp"
+#include "core/features/BoolFeatureExpFactory.hpp"
+#include "util/Generator.hpp"
+#include "util/ThreadPool.hpp"
+#include "util/Uncopyable.hpp"
+#include "util/parser/JsonReader.hpp"
+#include "util/parser/forwards.hpp"
+
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+/**
+ * StreamingJsonParser is a parser for an FSTM in JSON format that reads the
+ * FSTM in a single pass. Unlike JsonParser, it does not build the JSON
+ * document in memory: the transitions are parsed one by one as they are
+ * generated, so that only the states and the LTL properties are kept.
+ *
+ * The feature expressions are parsed on as many threads as there are
+ * processors.
+ *
+ * The parser yields the same FSTM as JsonParser, whatever the order of the
+ * members of the JSON FSTM. The transitions can be generated only once. The
+ * members that follow the transitions in the JSON FSTM are available once all
+ * the transitions have been generated. Until the "FSTM" member is read, the
+ * number of transitions is the number of transitions read so far.
+ *
+ * @author mwi
+ */
+class StreamingJsonParser : public FstmParser, private util::Uncopyable {
+
+private:
+    /**
+     * The state of the streamed JSON FSTM, shared with the generators.
+     */
+    struct Document {
+        util::parser::JsonReader reader;
+        int nbOfTransitions;
+        /* The number of transitions read so far. */
+        int nbOfReadTransitions;
+        int nbOfProperties;
+        std::vector<std::string> states;
+        std::vector<std::string> properties;
+        /* True iff the header of the FSTM has been read. */
+        bool hasHeader;
+        /* True iff the reader is at a transition. */
+        bool moreTransitions;
+        /* True iff the transitions have already been generated. */
+        bool transitionsGenerated;
+
+        explicit Document(std::istream & jsonFstm);
+    };
+
+    const core::features::BoolFeatureExpFactory & featureExpFactory;
+    std::tr1::shared_ptr<Document> document;
+
+public:
+    /**
+     * @modifies jsonFstm
+     * @effects Makes this be a new streaming parser for the JSON FSTM
+     *           'jsonFstm' with the boolean feature expression factory
+     *           'featureExpFactory', and reads 'jsonFstm' up to its
+     *           first transition. 'jsonFstm' must remain alive until all the
+     *           transitions have been generated.
+     * @throws JsonException iff the read part of 'jsonFstm' contains some
+     *          JSON syntax error.
+     */
+    StreamingJsonParser(std::istream & jsonFstm, const
+        core::features::BoolFeatureExpFactory & featureExpFactory);
+
+    // The default destructor is fine.
+
+    // overridden methods
+    int getNbOfTransitions() const;
+    FstmTransitionGeneratorPtr transitions() const;
+    int getNbOfProperties() const;
+    std::tr1::shared_ptr<util::Generator<std::string> > properties() const;
+    std::tr1::shared_ptr<util::Generator<std::string> > states() const;
+
+private:
+    /**
+     * @modifies document
+     * @effects Reads the members of the root object of 'document' up to the
+     *           first transition, or up to the end of the root object if
+     *           there are no more transitions.
+     * @throws JsonException iff some JSON syntax error is met.
+     */
+    static void readMembers(Document & document);
+
+    /**
+     * @modifies document
+     * @effects Reads the header of the FSTM, i.e., the value of the "FSTM"
+     *           member.
+     */
+    static void readHeader(Document & document);
+
+    /**
+     * @modifies document, strings
+     * @effects Reads a JSON array of strings into 'strings'.
+     */
+    static void readStrings(Document & document,
+        std::vector<std::string> & strings);
+
+    /**
+     * A transition read from the JSON FSTM, whose feature expression is yet
+     * to be built.
+     */
+    struct PendingTransition {
+        std::string source;
+        std::string target;
+        std::string event;
+        std::string featureExp;
+        /* The normalized feature expression (see GuardTable). */
+        std::string key;
+        /* The parsed feature expression, if it has to be parsed, null upon a
+         * parsing error. */
+        util::parser::BoolExpPtr guard;
+        /* The parsing error, if any. */
+        std::string error;
+    };
+
+    /**
+     * Task that parses the feature expressions of some pending transitions of
+     * a batch, one item per transition.
+     */
+    class GuardParsingTask : public util::ParallelTask {
+
+    private:
+        std::vector<PendingTransition> & batch;
+        const std::vector<unsigned int> & toParse;
+
+    public:
+        /**
+         * @effects Makes this be a new task parsing the feature expressions
+         *           of the transitions of 'batch' at the indexes 'toParse'.
+         */
+        GuardParsingTask(std::vector<PendingTransition> & batch,
+            const std::vector<unsigned int> & toParse);
+
+        // The default destructor is fine.
+
+        // overridden methods
+        void run(unsigned int index);
+    }; // end GuardParsingTask
+
+    /**
+     * Generator for transitions of the streamed JSON FSTM.
+     *
+     * The transitions are read by batches of BATCH_SIZE. The feature
+     * expressions of a batch are parsed concurrently, then their BDDs are
+     * built one by one in the order of the transitions by the calling thread,
+     * since the BDD manager is shared and not thread-safe.
+     *
+     * The feature expressions are interned: each distinct feature expression
+     * is parsed and built once, and is shared by all the transitions it
+     * guards.
+     */
+    class TransitionGenerator : public util::Generator<FstmTransitionPtr> {
+
+    private:
+        /* The number of transitions read at once. */
+        static const unsigned int BATCH_SIZE = 4096;
+
+        std::tr1::shared_ptr<Document> document;
+        const core::features::BoolFeatureExpFactory & featureExpFactory;
+        util::ThreadPool pool;
+        std::vector<PendingTransition> batch;
+        /* The index of the next transition in batch. */
+        unsigned int index;
+        GuardTable guards;
+
+    public:
+        /**
+         * @effects Makes this be a new transition generator for the
+         *           transitions of 'document' and with the boolean feature
+         *           expression factory 'featureExpFactory', which parses the
+         *           feature expressions with 'nbOfThreads' threads.
+         */
+        TransitionGenerator(const std::tr1::shared_ptr<Document> & document,
+            const core::features::BoolFeatureExpFactory & featureExpFactory,
+            unsigned int nbOfThreads);
+
+        // The default destructor is fine.
+
+        // overridden methods
+        bool hasNext() const;
+        FstmTransitionPtr next();
+
+    private:
+        /**
+         * @requires document has more transitions
+         * @modifies this
+         * @effects Reads the next batch of transitions and parses the
+         *           first occurrence of each of their feature expressions that
+         *           is not in the guards of this.
+         */
+        void readBatch();
+
+        /**
+         * @modifies transition
+         * @effects Reads the next transition of the document into
+         *           'transition'.
+         */
+        void readTransition(PendingTransition & transition);
+
+        /**
+         * @requires boolExp != null
+         * @return the Boolean expression 'boolExp' converted to a feature
+         *          expression.
+         */
+        core::features::FeatureExpPtr toFeatureExp(const
+            util::parser::BoolExpPtr & boolExp);
+    }; // end TransitionGenerator
+
+    /**
+     * Generator for a vector of strings of the streamed JSON FSTM.
+     */
+    class StringVectorGenerator : public util::Generator<std::string> {
+
+    private:
+        /* Keeps 'strings' alive. */
+        std::tr1::shared_ptr<Document> document;
+        const std::vector<std::string> & strings;
+        unsigned int index;
+
+    public:
+        /**
+         * @effects Makes this be a new generator for the strings 'strings'
+         *           of 'document'.
+         */
+        StringVectorGenerator(const std::tr1::shared_ptr<Document> &
+            document, const std::vector<std::string> & strings);
+
+        // The default destructor is fine.
+
+        // overridden methods
+        bool hasNext() const;
+        std::string next();
+    }; // end StringVectorGenerator
+};
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
+
+#endif /* CORE_FTS_FSTM_STREAMINGJSONPARSER_HPP */
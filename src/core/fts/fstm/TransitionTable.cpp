@@ -9,15 +9,11 @@
 #include "FstmState.hpp"
 #include "FstmTransition.hpp"
 #include "util/Assert.hpp"
-#include "util/HashTable.hpp"
 
-#include <memory>
-#include <stdexcept>
+#include <algorithm>
 
-using util::Generator;
-using std::auto_ptr;
-using std::make_pair;
 using std::vector;
+using util::ThreadPool;
 
 namespace core {
 namespace fts {
@@ -25,10 +21,10 @@ namespace fstm {
 
 // constructors
 TransitionTable::TransitionTable(FstmTransitionGeneratorPtr gen,
-        unsigned int size) : transitionTable(), indexTable() {
+        unsigned int size)
+        : transitionTable(), firstId(0), offsets(), initialState() {
     assertTrue(gen);
     assertTrue(gen->hasNext());
-    assertTrue(size > 0);
 
     // reserve is the right method to call, but not resize !!!
     // here lays a fucking bug that pissed me off
@@ -41,124 +37,160 @@ TransitionTable::TransitionTable(FstmTransitionGeneratorPtr gen,
 
 // public methods
 FstmStatePtr TransitionTable::getInitialState() const {
-    return transitionTable.at(0)->getSource();
+    return initialState;
 }
 
-TransitionGeneratorPtr TransitionTable::executables(const FstmState & state)
+unsigned int TransitionTable::firstIndexOf(const FstmState & state) const {
+    // Wraps around below firstId, thus out of the offsets.
+    const unsigned int index = state.getId() - firstId;
+    return index < offsets.size() - 1 ? offsets[index] : 0;
+}
+
+unsigned int TransitionTable::endIndexOf(const FstmState & state) const {
+    const unsigned int index = state.getId() - firstId;
+    return index < offsets.size() - 1 ? offsets[index + 1] : 0;
+}
+
+const FstmTransitionPtr & TransitionTable::getTransition(unsigned int index)
         const {
-    int firstIndex = firstIndexOf(state);
-    int lastIndex = lastIndexOf(state);
+    assertTrue(index < transitionTable.size());
 
-    if (firstIndex < 0) {
-        assertTrue(lastIndex < 0);
-        return TransitionGeneratorPtr(new EmptyTransitionGenerator());
-    }
+    return transitionTable[index];
+}
 
+TransitionGeneratorPtr TransitionTable::executables(const FstmState & state)
+        const {
     return TransitionGeneratorPtr(new TransitionGenerator(transitionTable,
-            firstIndex, lastIndex));
+            firstIndexOf(state), endIndexOf(state)));
 }
 
 // private methods
 void TransitionTable::initTables(FstmTransitionGeneratorPtr & gen) {
-    unsigned int firstIndex = 0;
-    FstmTransitionPtr transition = gen->next();
-    FstmStatePtr curSource = transition->getSource();
-
-    transitionTable.push_back(transition);
-
+    vector<FstmTransitionPtr> transitions;
+    vector<unsigned int> sourceIds;
+    transitions.reserve(transitionTable.capacity());
+    sourceIds.reserve(transitionTable.capacity());
     while (gen->hasNext()) {
-        transition = gen->next();
-        if (!curSource->equals(*transition->getSource())) {
-            const unsigned int lastIndex = transitionTable.size() - 1;
-            indexTable.insert(*curSource, make_pair(firstIndex, lastIndex));
-            firstIndex = lastIndex + 1;
-            curSource = transition->getSource();
+        transitions.push_back(gen->next());
+        sourceIds.push_back(transitions.back()->getSource()->getId());
+    }
+    initialState = transitions.front()->getSource();
+
+    // The offsets only cover the source states of this table, which are not
+    // the only states of the process.
+    firstId = *std::min_element(sourceIds.begin(), sourceIds.end());
+    const unsigned int nbOfStates =
+            *std::max_element(sourceIds.begin(), sourceIds.end()) - firstId + 1;
+    for (vector<unsigned int>::iterator it = sourceIds.begin();
+            it != sourceIds.end(); ++it) {
+        *it -= firstId;
+    }
+    const unsigned int nbOfTransitions = transitions.size();
+    const unsigned int nbOfThreads = std::max(1u, std::min(
+            ThreadPool::getNbOfCores(),
+            nbOfTransitions / MIN_TRANSITIONS_PER_THREAD));
+    const unsigned int chunkSize =
+            (nbOfTransitions + nbOfThreads - 1) / nbOfThreads;
+    ThreadPool pool(nbOfThreads);
+
+    // Counts the transitions leaving each state in each chunk.
+    vector<vector<unsigned int> > counts(nbOfThreads,
+            vector<unsigned int>(nbOfStates, 0));
+    SortingTask counting(transitions, sourceIds, chunkSize, counts, NULL);
+    pool.run(counting, nbOfThreads);
+
+    // Turns the counts into the index of the first transition of each state
+    // in each chunk, the chunks of a state following each other.
+    offsets.assign(nbOfStates + 1, 0);
+    unsigned int index = 0;
+    for (unsigned int id = 0; id < nbOfStates; ++id) {
+        offsets[id] = index;
+        for (unsigned int c = 0; c < nbOfThreads; ++c) {
+            const unsigned int count = counts[c][id];
+            counts[c][id] = index;
+            index += count;
         }
-        transitionTable.push_back(transition);
     }
+    offsets[nbOfStates] = index;
 
-    const unsigned int lastIndex = transitionTable.size() - 1;
-    indexTable.insert(*curSource, make_pair(firstIndex, lastIndex));
-}
-
-int TransitionTable::firstIndexOf(const FstmState & state) const {
-    auto_ptr<Generator<IndexPair> > g = indexTable.search(state);
-    return g->hasNext() ? g->next().first : -1;
-}
-
-int TransitionTable::lastIndexOf(const FstmState & state) const {
-    auto_ptr<Generator<IndexPair> > g = indexTable.search(state);
-    return g->hasNext() ? g->next().second : -1;
+    // Scatters the transitions at their index, in their order in the FSTM.
+    transitionTable.resize(nbOfTransitions);
+    SortingTask scattering(transitions, sourceIds, chunkSize, counts,
+            &transitionTable);
+    pool.run(scattering, nbOfThreads);
 }
 
 void TransitionTable::checkRep() const {
     if (doCheckRep) {
         assertTrue(transitionTable.size() > 0);
+        assertTrue(offsets.size() > 0);
+        assertTrue(offsets.front() == 0);
+        assertTrue(offsets.back() == transitionTable.size());
+        for (unsigned int i = 1; i < offsets.size(); ++i) {
+            assertTrue(offsets[i - 1] <= offsets[i]);
+        }
         for (unsigned int i = 0; i < transitionTable.size(); ++i) {
-            assertTrue(transitionTable.at(i));
+            assertTrue(transitionTable[i]);
+            const unsigned int id = transitionTable[i]->getSource()->getId();
+            assertTrue(firstId <= id);
+            assertTrue(offsets.at(id - firstId) <= i
+                    && i < offsets.at(id - firstId + 1));
+        }
+    }
+}
+
+// sorting task
+TransitionTable::SortingTask::SortingTask(
+        const vector<FstmTransitionPtr> & transitions,
+        const vector<unsigned int> & sourceIds, unsigned int chunkSize,
+        vector<vector<unsigned int> > & counts,
+        vector<FstmTransitionPtr> * table)
+        : transitions(transitions), sourceIds(sourceIds),
+          chunkSize(chunkSize), counts(counts), table(table) {}
+
+void TransitionTable::SortingTask::run(unsigned int chunk) {
+    const unsigned int first = chunk * chunkSize;
+    const unsigned int last = std::min<unsigned int>(first + chunkSize,
+            transitions.size());
+    vector<unsigned int> & chunkCounts = counts[chunk];
+
+    if (table == NULL) {
+        for (unsigned int i = first; i < last; ++i) {
+            ++chunkCounts[sourceIds[i]];
         }
-        assertTrue(indexTable.count() > 0);
-        vector<FstmTransitionPtr>::const_iterator it;
-        FstmStatePtr lastSource;
-        int nbOfDistinctSources = 0;
-        for (it = transitionTable.begin(); it != transitionTable.end(); ++it) {
-            if (!lastSource || !lastSource->equals(*(*it)->getSource())) {
-                ++nbOfDistinctSources;
-                lastSource = (*it)->getSource();
-                auto_ptr<Generator<IndexPair> > g =
-                        indexTable.search(*lastSource);
-                assertTrue(g->hasNext());
-                IndexPair pair = g->next();
-                assertTrue(pair.first <= pair.second);
-                assertTrue(!g->hasNext());
-            }
+    } else {
+        for (unsigned int i = first; i < last; ++i) {
+            (*table)[chunkCounts[sourceIds[i]]++] = transitions[i];
         }
-        assertTrue(nbOfDistinctSources == indexTable.count());
     }
 }
 
 // transition generator
 TransitionTable::TransitionGenerator::TransitionGenerator(
         const vector<FstmTransitionPtr> & transitionTable,
-        unsigned int firstIndex, unsigned int lastIndex)
-        : transitionTable(transitionTable), firstIndex(firstIndex),
-          lastIndex(lastIndex), curIndex(firstIndex) {
+        unsigned int firstIndex, unsigned int endIndex)
+        : transitionTable(transitionTable), curIndex(firstIndex),
+          endIndex(endIndex) {
     checkRep();
 }
 
 bool TransitionTable::TransitionGenerator::hasNext() const {
-    return curIndex <= lastIndex;
+    return curIndex < endIndex;
 }
 
 TransitionPtr TransitionTable::TransitionGenerator::next() {
     assertTrue(hasNext());
 
-    FstmTransitionPtr t = transitionTable.at(curIndex);
-    ++curIndex;
-
-    checkRep();
-    return t;
+    return transitionTable[curIndex++];
 }
 
 void TransitionTable::TransitionGenerator::checkRep() const {
     if (doCheckRep) {
-        assertTrue(firstIndex <= lastIndex);
-        assertTrue(firstIndex <= curIndex);
-        assertTrue(curIndex <= lastIndex + 1);
-        assertTrue(lastIndex < transitionTable.size());
+        assertTrue(curIndex <= endIndex);
+        assertTrue(endIndex <= transitionTable.size());
     }
 }
 
-// empty transition generator
-bool TransitionTable::EmptyTransitionGenerator::hasNext() const {
-    return false;
-}
-
-TransitionPtr TransitionTable::EmptyTransitionGenerator::next() {
-    // should never get here
-    throw std::logic_error("TransitionTable::EmptyTransitionGenerator::next");
-}
-
 } // namespace fstm
 } // namespace fts
 } // namespace core
@@ -10,7 +10,7 @@
 #include "forwards.hpp"
 #include "core/fts/State.hpp"
 #include "util/Generator.hpp"
-#include "util/StdHashTable.hpp"
+#include "util/ThreadPool.hpp"
 #include "util/Uncopyable.hpp"
 
 #include <vector>
@@ -22,34 +22,53 @@ namespace fstm {
 /**
  * TransitionTable is an immutable table of FSTM transitions.
  *
+ * The transitions are stored in a compressed sparse row layout: a contiguous
+ * array where the transitions leaving a given state form a range of indexes,
+ * and an array of offsets indexed by the ids of the source states, so that
+ * finding the transitions leaving a state takes two array reads. The offsets
+ * only cover the range of the ids of the source states of the table, since
+ * the ids of the states are shared by all the FSTMs of the process.
+ *
+ * The transitions may be given in any order. They are grouped by source state
+ * with a stable counting sort, run in parallel on large tables, so that the
+ * transitions leaving a state keep their order in the FSTM.
+ *
  * @author mwi
  */
 class TransitionTable : private util::Uncopyable {
 
 private:
-    /* A pair of indices <i1, i2> such that i1 <= i2 */
-    typedef std::pair<unsigned int, unsigned int> IndexPair;
+    /* The minimal number of transitions sorted by each thread. */
+    static const unsigned int MIN_TRANSITIONS_PER_THREAD = 1 << 15;
 
     std::vector<FstmTransitionPtr> transitionTable;
-    /* Maps the source states from transitionTable with the indexes of the first
-     * and last transitions leaving these source states.*/
-    util::StdHashTable<State, IndexPair> indexTable;
+    /* The smallest id of the source states. */
+    unsigned int firstId;
+    /* The transitions leaving the state with id firstId + i are at the
+     * indexes offsets[i] to offsets[i + 1] - 1 of transitionTable. */
+    std::vector<unsigned int> offsets;
+    FstmStatePtr initialState;
 
     /*
      * Representation Invariant:
      *   I(c) = c.transitionTable.size > 0
      *     all the pointers in c.transitionTable are not null
-     *     all distinct source states in c.transitionTable are in c.indexTable
-     *       and no other state is in c.indexTable
-     *     for all index pairs <i1, i2> in c.indexTable .(i1 <= i2)
+     *     c.initialState is the source of the first transition of the FSTM
+     *     c.offsets.size > 0 && c.offsets[0] = 0 &&
+     *       c.offsets[c.offsets.size - 1] = c.transitionTable.size
+     *     for all 0 < i < c.offsets.size .(c.offsets[i - 1] <= c.offsets[i])
+     *     c.firstId <= the id of each source state of c.transitionTable
+     *     for all states s with id c.firstId + i .(
+     *       c.transitionTable[j].source = s iff
+     *       c.offsets[i] <= j < c.offsets[i + 1])
      */
 
 public:
     /**
-     * @requires gen != null && gen generates at least one transition &&
-     *            size > 0
+     * @requires gen != null && gen generates at least one transition
      * @effects Makes this be a new transition table from the transition
-     *           generator 'gen' with an initial size of 'size'.
+     *           generator 'gen' with an initial size of 'size', which is
+     *           only a hint of the number of transitions of 'gen'.
      */
     TransitionTable(FstmTransitionGeneratorPtr gen, unsigned int size);
 
@@ -60,6 +79,25 @@ public:
      */
     FstmStatePtr getInitialState() const;
 
+    /**
+     * @return the index of the first transition leaving the state 'state'
+     *          in this.
+     */
+    unsigned int firstIndexOf(const FstmState & state) const;
+
+    /**
+     * @return the index following the one of the last transition leaving
+     *          the state 'state' in this, i.e., firstIndexOf(state) if there
+     *          is no such transition.
+     */
+    unsigned int endIndexOf(const FstmState & state) const;
+
+    /**
+     * @requires index < the number of transitions of this
+     * @return the transition at index 'index' in this.
+     */
+    const FstmTransitionPtr & getTransition(unsigned int index) const;
+
     /**
      * @return a generator that will produce all the transitions (as
      *          FstmTransitions) leaving the state 'state' in this, each
@@ -76,18 +114,43 @@ private:
     void initTables(FstmTransitionGeneratorPtr & gen);
 
     /**
-     * @return the index of the first occurence of a transition leaving the
-     *          given state in this, or -1 if this does not contain any
-     *          transition leaving the given state.
+     * Task that counts the transitions leaving each state in the chunks of
+     * the generated transitions (first phase of the counting sort), or that
+     * scatters them at their index in the table (second phase).
      */
-    int firstIndexOf(const FstmState & state) const;
+    class SortingTask : public util::ParallelTask {
 
-    /**
-     * @return the index of the last occurence of a transition leaving the
-     *          given state in this, or -1 if this does not contain any
-     *          transition leaving the given state.
-     */
-    int lastIndexOf(const FstmState & state) const;
+    private:
+        const std::vector<FstmTransitionPtr> & transitions;
+        const std::vector<unsigned int> & sourceIds;
+        const unsigned int chunkSize;
+        /* counts[c][i] is the number of transitions leaving the state with
+         * id firstId + i in the chunk c, then the index of the next of them
+         * in the table. */
+        std::vector<std::vector<unsigned int> > & counts;
+        /* The table to fill, or null in the counting phase. */
+        std::vector<FstmTransitionPtr> * table;
+
+    public:
+        /**
+         * @effects Makes this be a new task sorting the transitions
+         *           'transitions' leaving the states with ids firstId +
+         *           'sourceIds' by
+         *           chunks of 'chunkSize' transitions, and counting them in
+         *           'counts' if table is null or scattering them in 'table'
+         *           otherwise.
+         */
+        SortingTask(const std::vector<FstmTransitionPtr> & transitions,
+            const std::vector<unsigned int> & sourceIds,
+            unsigned int chunkSize,
+            std::vector<std::vector<unsigned int> > & counts,
+            std::vector<FstmTransitionPtr> * table);
+
+        // The default destructor is fine.
+
+        // overridden methods
+        void run(unsigned int chunk);
+    }; // end SortingTask
 
     /**
      * @effects Asserts the rep invariant holds for this.
@@ -101,30 +164,26 @@ private:
 
     private:
         const std::vector<FstmTransitionPtr> & transitionTable;
-        /* The first index of the transitions to generate. */
-        unsigned int firstIndex;
-        /* The last index of the transitions to generate. */
-        unsigned int lastIndex;
         /* The index of the next transition to generate. */
         unsigned int curIndex;
+        /* The index following the last transition to generate. */
+        unsigned int endIndex;
 
         /*
          * Representation Invariant:
-         *   I(c) = 0 <= c.firstIndex <= c.lastIndex &&
-         *     c.firstIndex <= c.curIndex <= c.lastIndex + 1 &&
-         *     c.lastIndex < c.transitionTable.size
+         *   I(c) = c.curIndex <= c.endIndex <= c.transitionTable.size
          */
 
     public:
         /**
-         * @requires 0 <= firstIndex <= lastIndex
+         * @requires firstIndex <= endIndex <= transitionTable.size
          * @effects Makes this be a new transition generator for the
          *           transition table 'transitionTable' from
          *           transitionTable[firstIndex] to
-         *           transitionTable[lastIndex].
+         *           transitionTable[endIndex - 1].
          */
         TransitionGenerator(const std::vector<FstmTransitionPtr> &
-            transitionTable, unsigned int firstIndex, unsigned int lastIndex);
+            transitionTable, unsigned int firstIndex, unsigned int endIndex);
 
         // The default destructor is fine.
 
@@ -139,15 +198,6 @@ private:
         void checkRep() const;
     }; // end TransitionGenerator
 
-    /**
-     * Empty generator for transitions of the FSTM.
-     */
-    class EmptyTransitionGenerator : public util::Generator<TransitionPtr> {
-    public:
-        bool hasNext() const;
-        TransitionPtr next();
-    }; // end EmtpyTransitionGenerator
-
 };
 
 } // namespace fstm
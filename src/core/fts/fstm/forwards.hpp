@@ -16,15 +16,20 @@ namespace fts {
 namespace fstm {
 
 // Forward declarations
+class ClaimPropertyAutomaton;
 class ClaimPropertyState;
 class ClaimPropertyTransition;
 class ChangeListener;
 class FstmEvent;
+class FstmParser;
 class FstmState;
 class FstmTransition;
+class ProductGraph;
 class TransitionTable;
 
 // Smart pointer typedefs
+typedef std::tr1::shared_ptr<ClaimPropertyAutomaton>
+        ClaimPropertyAutomatonPtr;
 typedef std::tr1::shared_ptr<ClaimPropertyState> ClaimPropertyStatePtr;
 typedef std::tr1::shared_ptr<ClaimPropertyTransition>
         ClaimPropertyTransitionPtr;
@@ -32,6 +37,7 @@ typedef std::tr1::shared_ptr<ChangeListener> ChangeListenerPtr;
 typedef std::tr1::shared_ptr<FstmEvent> FstmEventPtr;
 typedef std::tr1::shared_ptr<FstmState> FstmStatePtr;
 typedef std::tr1::shared_ptr<FstmTransition> FstmTransitionPtr;
+typedef std::tr1::shared_ptr<ProductGraph> ProductGraphPtr;
 typedef std::tr1::shared_ptr<TransitionTable> TransitionTablePtr;
 
 // Generator typedefs
@@ -1,32 +1,47 @@
 #include "core/checker/Checker.hpp"
 #include "core/checker/CounterExample.hpp"
 
+#include "math/minimize/Minimizer.hpp"
+
+#include "config/Context.hpp"
+#include "config/Messages.hpp"
+
 #include "ui/CommandLine.hpp"
 
 #include "util/Assert.hpp"
 #include "util/logging.hpp"
 #include "util/Generator.hpp"
+#include "util/JsonException.hpp"
 #include "util/NotPossibleException.hpp"
 
 #include <Version.hpp>
 #include <glog/logging.h>
 
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <memory>
 
+using config::Context;
+using config::Messages;
+
 using core::checker::Checker;
 using core::checker::CounterExample;
 
+using math::minimize::Minimizer;
+
 using std::cerr;
 using std::cout;
 using std::endl;
+using std::ifstream;
+using std::ofstream;
 using std::string;
 using std::auto_ptr;
 
 using ui::CommandLine;
 
 using util::Generator;
+using util::JsonException;
 using util::NotPossibleException;
 
 /**
@@ -50,6 +65,16 @@ using util::NotPossibleException;
  */
 void printVersion();
 
+/**
+ * @requires commandLine.isCompile()
+ * @modifies stdout, the file at commandLine.outputPath
+ * @effects Compiles the JSON FSTM at commandLine.inputPath into the file at
+ *           commandLine.outputPath.
+ * @throws NotPossibleException iff the input file cannot be read or is not
+ *          valid JSON, or the output file cannot be written.
+ */
+void compile(const CommandLine & commandLine);
+
 /**
  * @requires gen != null
  * @modifies stdout, gen
@@ -57,6 +82,13 @@ void printVersion();
  */
 void printCounterExamples(auto_ptr<Generator<CounterExample> > gen);
 
+/**
+ * @requires checker.state = terminated
+ * @modifies stdout
+ * @effects Prints on stdout the BDD statistics of the model checking.
+ */
+void printBddStats(const Checker & checker);
+
 /**
  * @requires checker.result = satisfied
  * @modifies stdout
@@ -98,7 +130,14 @@ int main(int argc, const char * argv[]) {
         CommandLine commandLine(argc, argv);
         validCommandLine = true;
 
-        Checker checker(commandLine.getInputPath());
+        if (commandLine.isCompile()) {
+            compile(commandLine);
+            util::terminateLogging();
+            return EXIT_SUCCESS;
+        }
+
+        Checker checker(commandLine.getInputPath(),
+                commandLine.isProductGraph(), commandLine.getCuddOptions());
         checker.run();
 
         switch (checker.getResult()) {
@@ -115,6 +154,10 @@ int main(int argc, const char * argv[]) {
                 assertTrue(false);
                 break;
         }
+
+        if (commandLine.isVerbose()) {
+            printBddStats(checker);
+        }
     } catch (NotPossibleException & ex) {
         LOG(ERROR) << ex.getMessage();
         cerr << ex.getMessage() << endl;
@@ -136,12 +179,48 @@ void printVersion() {
          << " (revision " << PVL_REVISION << ")" << endl;
 }
 
+void compile(const CommandLine & commandLine) {
+    const string inputPath = commandLine.getInputPath();
+    const string outputPath = commandLine.getOutputPath();
+
+    ifstream input(inputPath.c_str());
+    if (!input.is_open()) {
+        throw NotPossibleException(Messages::errorOpeningFile(inputPath));
+    }
+    ofstream output(outputPath.c_str(), ofstream::binary);
+    if (!output.is_open()) {
+        throw NotPossibleException(Messages::errorWritingFile(outputPath));
+    }
+
+    Context ctx;
+    try {
+        ctx.compileFSTM(input, output);
+    } catch (JsonException & jsonEx) {
+        throw NotPossibleException(Messages::invalidJson(inputPath));
+    }
+
+    output.close();
+    if (output.fail()) {
+        throw NotPossibleException(Messages::errorWritingFile(outputPath));
+    }
+    cout << "Compiled FSTM written to " << outputPath << endl;
+}
+
 void printCounterExamples(auto_ptr<Generator<CounterExample> > gen) {
+    // A single minimizer minimizes each distinct feature expression once.
+    Minimizer minimizer;
     while(gen->hasNext()) {
-        cout << endl << gen->next().toString();
+        const CounterExample counterExample(gen->next());
+        counterExample.minimize(minimizer);
+        cout << endl << counterExample.toString();
     }
 }
 
+void printBddStats(const Checker & checker) {
+    cout << endl << "BDD statistics: " << checker.getBddStats().toString()
+         << endl;
+}
+
 void onSatisfied(const Checker & checker) {
     assertTrue(checker.getResult() == Checker::Satisfied);
 
@@ -0,0 +1,107 @@
+/*
+ * BddCodec.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "BddCodec.hpp"
+
+#include "BoolFctCUDD.hpp"
+
+#include "util/Assert.hpp"
+
+using std::vector;
+
+namespace math {
+
+// BddEncoder
+BddEncoder::BddEncoder() : nodes(), indexes() {}
+
+int BddEncoder::encode(const BoolFct & fct) {
+    const BoolFctCUDD & cuddFct = static_cast<const BoolFctCUDD &>(fct);
+    assertTrue(cuddFct.isValid());
+
+    return encode(cuddFct.bdd.getNode());
+}
+
+const vector<BddNode> & BddEncoder::getNodes() const {
+    return nodes;
+}
+
+int BddEncoder::encode(DdNode * node) {
+    DdNode * regular = Cudd_Regular(node);
+    const int complement = Cudd_IsComplement(node) ? 1 : 0;
+
+    if (Cudd_IsConstant(regular)) {
+        // The only regular constant of a BDD is true.
+        return complement;
+    }
+
+    std::tr1::unordered_map<const void *, int>::const_iterator it =
+            indexes.find(regular);
+    if (it != indexes.end()) {
+        return (it->second << 1) | complement;
+    }
+
+    BddNode encoded;
+    encoded.var = Cudd_NodeReadIndex(regular);
+    encoded.thenRef = encode(Cudd_T(regular));
+    encoded.elseRef = encode(Cudd_E(regular));
+    nodes.push_back(encoded);
+
+    const int index = nodes.size();
+    indexes[regular] = index;
+    return (index << 1) | complement;
+}
+
+// BddDecoder
+BddDecoder::BddDecoder(const BddNode * nodes, unsigned int nbOfNodes,
+        const vector<int> & varIds)
+    : nodes(nodes), nbOfNodes(nbOfNodes), varIds(varIds),
+      decoded(nbOfNodes), isDecoded(nbOfNodes, false) {
+    if (doCheckRep) {
+        assertTrue(isValid(nodes, nbOfNodes, varIds.size()));
+    }
+}
+
+BoolFct * BddDecoder::decode(int ref) {
+    return new BoolFctCUDD(decodeBdd(ref));
+}
+
+bool BddDecoder::isValid(const BddNode * nodes, unsigned int nbOfNodes,
+        unsigned int nbOfVars) {
+    for (unsigned int i = 0; i < nbOfNodes; ++i) {
+        const BddNode & node = nodes[i];
+        // Node i is referenced with index i + 1.
+        if (node.var < 0 || static_cast<unsigned int>(node.var) >= nbOfVars
+                || node.thenRef < 0 || (node.thenRef >> 1) > static_cast<int>(i)
+                || node.elseRef < 0 || (node.elseRef >> 1) > static_cast<int>(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// private methods
+BDD BddDecoder::decodeBdd(int ref) {
+    const unsigned int index = ref >> 1;
+    assertTrue(index <= nbOfNodes);
+
+    BDD bdd;
+    if (index == 0) {
+        bdd = BoolFctCUDD::getCudd().bddOne();
+    }
+    else {
+        if (!isDecoded[index - 1]) {
+            const BddNode & node = nodes[index - 1];
+            BDD var = BoolFctCUDD::getCudd().bddVar(varIds[node.var]);
+            decoded[index - 1] = var.Ite(decodeBdd(node.thenRef),
+                    decodeBdd(node.elseRef));
+            isDecoded[index - 1] = true;
+        }
+        bdd = decoded[index - 1];
+    }
+    return (ref & 1) ? !bdd : bdd;
+}
+
+} // namespace math
@@ -0,0 +1,136 @@
+/*
+ * BddCodec.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef MATH_BDDCODEC_HPP
+#define MATH_BDDCODEC_HPP
+
+#include "forwards.hpp"
+
+#include "util/Uncopyable.hpp"
+
+#include <cuddObj.hh>
+
+#include <tr1/unordered_map>
+#include <vector>
+
+namespace math {
+
+/**
+ * A BddNode is a node of an encoded BDD: the function of the node is
+ * 'var' ? f('thenRef') : f('elseRef').
+ *
+ * A reference r designates the node r >> 1, complemented iff r & 1. The
+ * node 0 is the constant true, thus 0 references true and 1 references false.
+ * The node i > 0 is stored at index i - 1 of a node array, and its children
+ * are always stored before it.
+ */
+struct BddNode {
+    int var;
+    int thenRef;
+    int elseRef;
+};
+
+/**
+ * A BddEncoder encodes boolean functions (as BoolFctCUDDs) into a shared
+ * array of BddNodes, the variables of which are the ids of the BoolVars.
+ *
+ * @author mwi
+ */
+class BddEncoder : private util::Uncopyable {
+
+private:
+    std::vector<BddNode> nodes;
+    /* Maps the CUDD nodes already encoded with their index in nodes + 1. */
+    std::tr1::unordered_map<const void *, int> indexes;
+
+public:
+    /**
+     * @effects Makes this be a new encoder with no node.
+     */
+    BddEncoder();
+
+    // The default destructor is fine.
+
+    /**
+     * @requires fct is a valid BoolFctCUDD that remains alive as long as
+     *            this is used.
+     * @modifies this
+     * @effects Adds to this the nodes of 'fct' not already in this.
+     * @return the reference of 'fct' in the nodes of this.
+     */
+    int encode(const BoolFct & fct);
+
+    /**
+     * @return the nodes of this.
+     */
+    const std::vector<BddNode> & getNodes() const;
+
+private:
+    /**
+     * @modifies this
+     * @return the reference of the CUDD node 'node'.
+     */
+    int encode(DdNode * node);
+};
+
+/**
+ * A BddDecoder decodes boolean functions (as BoolFctCUDDs) from an array of
+ * BddNodes, each node being decoded at most once.
+ *
+ * @author mwi
+ */
+class BddDecoder : private util::Uncopyable {
+
+private:
+    const BddNode * nodes;
+    const unsigned int nbOfNodes;
+    const std::vector<int> varIds;
+    std::vector<BDD> decoded;
+    std::vector<bool> isDecoded;
+
+    /*
+     * Representation Invariant:
+     *   I(c) = isValid(c.nodes, c.nbOfNodes, c.varIds.size) &&
+     *     c.decoded.size = c.isDecoded.size = c.nbOfNodes
+     */
+
+public:
+    /**
+     * @requires isValid(nodes, nbOfNodes, varIds.size) && the array 'nodes'
+     *            remains alive as long as this is used.
+     * @effects Makes this be a new decoder for the array 'nodes', where the
+     *           variable v of a node is the BoolVar with id varIds[v].
+     */
+    BddDecoder(const BddNode * nodes, unsigned int nbOfNodes,
+        const std::vector<int> & varIds);
+
+    // The default destructor is fine.
+
+    /**
+     * @requires ref is a reference to a node of this
+     * @modifies this
+     * @return a new boolean function for the node referenced by 'ref'.
+     */
+    BoolFct * decode(int ref);
+
+    /**
+     * @return true iff the children of each node of 'nodes' are stored before
+     *          it and its variable is in [0, nbOfVars).
+     */
+    static bool isValid(const BddNode * nodes, unsigned int nbOfNodes,
+        unsigned int nbOfVars);
+
+private:
+    /**
+     * @modifies this
+     * @return the BDD of the node referenced by 'ref'.
+     */
+    BDD decodeBdd(int ref);
+};
+
+} // namespace math
+
+#endif /* MATH_BDDCODEC_HPP */
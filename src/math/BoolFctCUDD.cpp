@@ -9,6 +9,8 @@
 #include "util/Assert.hpp"
 
 #include <glog/logging.h>
+
+#include <ios>
 #include <sstream>
 
 using std::tr1::shared_ptr;
@@ -19,12 +21,56 @@ using util::MemoryManager;
 
 namespace math {
 
+namespace {
+
+/**
+ * @return the CUDD reordering type of the reordering method 'reordering'.
+ */
+Cudd_ReorderingType toCuddReordering(CuddOptions::Reordering reordering) {
+    switch (reordering) {
+        case CuddOptions::Sift:
+            return CUDD_REORDER_SIFT;
+        case CuddOptions::SiftConverge:
+            return CUDD_REORDER_SIFT_CONVERGE;
+        case CuddOptions::SymmetricSift:
+            return CUDD_REORDER_SYMM_SIFT;
+        case CuddOptions::SymmetricSiftConverge:
+            return CUDD_REORDER_SYMM_SIFT_CONV;
+        case CuddOptions::Window2:
+            return CUDD_REORDER_WINDOW2;
+        case CuddOptions::Window3:
+            return CUDD_REORDER_WINDOW3;
+        case CuddOptions::Window4:
+            return CUDD_REORDER_WINDOW4;
+        case CuddOptions::GroupSift:
+            return CUDD_REORDER_GROUP_SIFT;
+        case CuddOptions::LazySift:
+            return CUDD_REORDER_LAZY_SIFT;
+        case CuddOptions::Linear:
+            return CUDD_REORDER_LINEAR;
+        case CuddOptions::Annealing:
+            return CUDD_REORDER_ANNEALING;
+        case CuddOptions::Genetic:
+            return CUDD_REORDER_GENETIC;
+        case CuddOptions::Exact:
+            return CUDD_REORDER_EXACT;
+        default:
+            return CUDD_REORDER_NONE;
+    }
+}
+
+} // namespace
+
 MemoryManager<BoolFctCUDD> BoolFctCUDD::memoryManager;
 
-Cudd BoolFctCUDD::manager;
+CuddOptions BoolFctCUDD::options;
+
+bool BoolFctCUDD::created = false;
 
 BDD BoolFctCUDD::voidBdd;
 
+const unsigned long BoolFctCUDD::MAX_STRING_LENGTH;
+
 // constructors
 BoolFctCUDD::BoolFctCUDD(BDD bdd)
     : valid(true), bdd(bdd) {
@@ -32,17 +78,71 @@ BoolFctCUDD::BoolFctCUDD(BDD bdd)
 }
 
 BoolFctCUDD::BoolFctCUDD(const BoolVar & var)
-    : valid(true), bdd(manager.bddVar(var.getId())) {
+    : valid(true), bdd(getCudd().bddVar(var.getId())) {
     checkRep();
 }
 
 // public methods
+Cudd & BoolFctCUDD::getCudd() {
+    // Created on first use, so that it can be configured beforehand.
+    static Cudd cudd = createCudd();
+    return cudd;
+}
+
+Cudd BoolFctCUDD::createCudd() {
+    created = true;
+    return Cudd(0, 0, options.uniqueSlots, options.cacheSlots,
+            options.maxMemory);
+}
+
+void BoolFctCUDD::configure(const CuddOptions & cuddOptions) {
+    if (created && !cuddOptions.hasSameSizes(options)) {
+        LOG(WARNING) << "The sizes of the CUDD tables are ignored once the"
+                << " manager has been created";
+    }
+    options = cuddOptions;
+
+    DdManager * dd = getCudd().getManager();
+    if (options.maxMemory > 0) {
+        Cudd_SetMaxMemory(dd, options.maxMemory);
+    }
+    Cudd_SetNextReordering(dd, options.firstReordering);
+    Cudd_SetMaxGrowth(dd, options.maxGrowth);
+    if (options.reordering == CuddOptions::None) {
+        Cudd_AutodynDisable(dd);
+    } else {
+        Cudd_AutodynEnable(dd, toCuddReordering(options.reordering));
+    }
+
+    DVLOG(1) << "CUDD manager configured with reordering "
+            << CuddOptions::getReorderingName(options.reordering);
+}
+
 BoolFctCUDD * BoolFctCUDD::getTrue() {
-    return new BoolFctCUDD(manager.bddOne());
+    return new BoolFctCUDD(getCudd().bddOne());
 }
 
 BoolFctCUDD * BoolFctCUDD::getFalse() {
-    return new BoolFctCUDD(manager.bddZero());
+    return new BoolFctCUDD(getCudd().bddZero());
+}
+
+BoolFctStats BoolFctCUDD::readStats() {
+    DdManager * dd = getCudd().getManager();
+    BoolFctStats stats;
+    stats.liveNodes = Cudd_ReadNodeCount(dd);
+    stats.peakNodes = Cudd_ReadPeakNodeCount(dd);
+    stats.garbageCollections = Cudd_ReadGarbageCollections(dd);
+    stats.gcTime = Cudd_ReadGarbageCollectionTime(dd);
+    stats.reorderings = Cudd_ReadReorderings(dd);
+    stats.reorderingTime = Cudd_ReadReorderingTime(dd);
+    stats.cacheHits = Cudd_ReadCacheHits(dd);
+    stats.cacheLookUps = Cudd_ReadCacheLookUps(dd);
+    stats.memoryInUse = Cudd_ReadMemoryInUse(dd);
+    return stats;
+}
+
+void BoolFctCUDD::reorder() {
+    getCudd().ReduceHeap(CUDD_REORDER_SIFT, 0);
 }
 
 BoolFct & BoolFctCUDD::conjunction(BoolFct & formula) {
@@ -86,13 +186,13 @@ BoolFct & BoolFctCUDD::negation() {
 bool BoolFctCUDD::isSatisfiable() const {
     assertTrue(valid);
 
-    return bdd != manager.bddZero();
+    return bdd != getCudd().bddZero();
 }
 
 bool BoolFctCUDD::isTautology() const {
     assertTrue(valid);
 
-    return bdd == manager.bddOne();
+    return bdd == getCudd().bddOne();
 }
 
 bool BoolFctCUDD::isEquivalent(const BoolFct & formula) const {
@@ -113,7 +213,7 @@ bool BoolFctCUDD::implies(const BoolFct & formula) const {
         return true;
     } else {
 
-        return (!bdd + rhs.bdd) == manager.bddOne();
+        return (!bdd + rhs.bdd) == getCudd().bddOne();
     }
 }
 
@@ -126,10 +226,10 @@ BoolFct * BoolFctCUDD::clone() const {
 }
 
 string BoolFctCUDD::toString() const {
-    if (bdd == manager.bddOne()) {
+    if (bdd == getCudd().bddOne()) {
         return "true";
     }
-    if (bdd == manager.bddZero()) {
+    if (bdd == getCudd().bddZero()) {
         return "false";
     }
     return buildString();
@@ -147,56 +247,41 @@ void BoolFctCUDD::invalidate(BoolFctCUDD & fct) {
 }
 
 string BoolFctCUDD::buildString() const {
-    FILE * file = tmpfile();
-    manager.SetStdout(file);
-    bdd.PrintMinterm();
-    rewind(file);
+    DdManager * dd = getCudd().getManager();
+    const int size = Cudd_ReadSize(dd);
     stringstream stream;
     stream << "(";
-    bool nextLiteral = false;
     bool nextMinterm = false;
-    int i = 0;
-    int c = !EOF;
-    while (c != EOF) {
-        c = fgetc(file);
-        switch(c) {
-            case '-':
-                ++i;
+    int * cube;
+    CUDD_VALUE_TYPE value;
+    DdGen * gen = Cudd_FirstCube(dd, bdd.getNode(), &cube, &value);
+    while (!Cudd_IsGenEmpty(gen)) {
+        if (nextMinterm) {
+            if (stream.tellp() >= (std::streamoff) MAX_STRING_LENGTH) {
+                stream << ") || (...";
                 break;
-            case '1':
-                if (nextLiteral) {
-                    stream << " && ";
-                }
-                if (nextMinterm) {
-                    stream << ") || (";
-                }
-                stream << BoolVar::makeBoolVar(i).getName();
-                nextLiteral = true;
-                nextMinterm = false;
-                ++i;
-                break;
-            case '0':
+            }
+            stream << ") || (";
+        }
+        bool nextLiteral = false;
+        for (int i = 0; i < size; ++i) {
+            // 0 and 1 are the negative and positive literals, 2 is a don't care
+            if (cube[i] != 2) {
                 if (nextLiteral) {
                     stream << " && ";
                 }
-                if (nextMinterm) {
-                    stream << ") || (";
+                if (cube[i] == 0) {
+                    stream << "!(" << BoolVar::makeBoolVar(i).getName() << ")";
+                } else {
+                    stream << BoolVar::makeBoolVar(i).getName();
                 }
-                stream << "!(" << BoolVar::makeBoolVar(i).getName() << ")";
                 nextLiteral = true;
-                nextMinterm = false;
-                ++i;
-                break;
-            case ' ':
-                char buffer[8];
-                fgets(buffer, 8, file);
-                nextLiteral = false;
-                nextMinterm = true;
-                i = 0;
-                break;
+            }
         }
+        nextMinterm = true;
+        Cudd_NextCube(gen, &cube, &value);
     }
-    fclose(file);
+    Cudd_GenFree(gen);
     stream << ")";
     return stream.str();
 }
@@ -8,7 +8,9 @@
 #define MATH_BOOLFCTCUDD_HPP
 
 #include "BoolFct.hpp"
+#include "BoolFctStats.hpp"
 #include "BoolVar.hpp"
+#include "CuddOptions.hpp"
 
 #include "util/MemoryManager.hpp"
 
@@ -18,6 +20,10 @@
 
 namespace math {
 
+namespace minimize {
+class Minimizer;
+}
+
 /**
  * BoolFctCUDD is an implementation of the BoolFct interface using binary
  * decision diagrams (BDDs) with the CUDD library.
@@ -29,9 +35,17 @@ class BoolFctCUDD : public BoolFct {
 private:
     static util::MemoryManager<BoolFctCUDD> memoryManager;
 
-    static Cudd manager;
+    /* The options of the CUDD manager */
+    static CuddOptions options;
+
+    /* True iff the CUDD manager has been created */
+    static bool created;
+
     static BDD voidBdd;
 
+    /* Length beyond which the string representation is truncated */
+    static const unsigned long MAX_STRING_LENGTH = 1 << 20;
+
     bool valid;
     BDD bdd;
 
@@ -52,6 +66,26 @@ private:
      */
     explicit BoolFctCUDD(BDD bdd);
 
+    /**
+     * @effects Creates the CUDD manager shared by all the BoolFctCUDDs with
+     *           the options of this on first call.
+     * @return the CUDD manager shared by all the BoolFctCUDDs.
+     */
+    static Cudd & getCudd();
+
+    /**
+     * @return a new CUDD manager with the sizes of the options of this.
+     */
+    static Cudd createCudd();
+
+    /**
+     * @modifies the CUDD manager shared by all the BoolFctCUDDs
+     * @effects Applies the options 'cuddOptions' to the CUDD manager. The sizes
+     *           of its tables only apply if it has not been created yet,
+     *           a warning is logged otherwise.
+     */
+    static void configure(const CuddOptions & cuddOptions);
+
     /**
      * @return a tautology
      */
@@ -62,7 +96,22 @@ private:
      */
     static BoolFctCUDD * getFalse();
 
+    /**
+     * @return a snapshot of the statistics of the CUDD manager shared by all
+     *          the BoolFctCUDDs.
+     */
+    static BoolFctStats readStats();
+
+    /**
+     * @effects Reorders the variables of the CUDD manager shared by all the
+     *           BoolFctCUDDs by sifting.
+     */
+    static void reorder();
+
     friend class BoolFctCUDDFactory;
+    friend class BddEncoder;
+    friend class BddDecoder;
+    friend class minimize::Minimizer;
 
 public:
     // The default copy constructor is fine.
@@ -99,7 +148,10 @@ private:
     void invalidate(BoolFctCUDD & f);
 
     /**
-     * @return the built string representation of this.
+     * @return the built string representation of this, i.e. the disjunction
+     *          of the cubes of the paths of the BDD of this. The cubes are
+     *          enumerated in memory, and the representation is truncated
+     *          with "..." once it exceeds MAX_STRING_LENGTH characters.
      */
     std::string buildString() const;
 
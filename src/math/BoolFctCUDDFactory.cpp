@@ -14,6 +14,10 @@ namespace math {
 
 BoolFctCUDDFactory::BoolFctCUDDFactory() {}
 
+BoolFctCUDDFactory::BoolFctCUDDFactory(const CuddOptions & options) {
+    BoolFctCUDD::configure(options);
+}
+
 BoolFct * BoolFctCUDDFactory::create(const BoolVar & var) const {
     return new BoolFctCUDD(var);
 }
@@ -30,4 +34,12 @@ BoolFct * BoolFctCUDDFactory::getFalse() const {
     return BoolFctCUDD::getFalse();
 }
 
+BoolFctStats BoolFctCUDDFactory::getStats() const {
+    return BoolFctCUDD::readStats();
+}
+
+void BoolFctCUDDFactory::reorder() const {
+    BoolFctCUDD::reorder();
+}
+
 } // namespace math
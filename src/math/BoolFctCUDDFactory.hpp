@@ -8,6 +8,7 @@
 #define MATH_BOOLFCTCUDDFACTORY_HPP
 
 #include "BoolFctFactory.hpp"
+#include "CuddOptions.hpp"
 
 #include "util/Uncopyable.hpp"
 
@@ -27,6 +28,13 @@ public:
      */
     BoolFctCUDDFactory();
 
+    /**
+     * @modifies the CUDD manager shared by all the BoolFctCUDDs
+     * @effects Makes this be a new BoolFctCUDDFactory and applies the options
+     *           'options' to the CUDD manager.
+     */
+    explicit BoolFctCUDDFactory(const CuddOptions & options);
+
     // The default destructor is fine.
 
     // overridden methods
@@ -34,6 +42,8 @@ public:
     BoolFct * create(const std::string & varName) const;
     BoolFct * getTrue() const;
     BoolFct * getFalse() const;
+    BoolFctStats getStats() const;
+    void reorder() const;
 };
 
 } // namespace math
@@ -8,6 +8,7 @@
 #define MATH_BOOLFCTFACTORY_HPP
 
 #include "forwards.hpp"
+#include "BoolFctStats.hpp"
 
 namespace math {
 
@@ -42,6 +43,18 @@ public:
      */
     virtual BoolFct * getFalse() const = 0;
 
+    /**
+     * @return a snapshot of the statistics of the engine used by this to
+     *          represent boolean functions.
+     */
+    virtual BoolFctStats getStats() const = 0;
+
+    /**
+     * @effects Reorders the variables of the engine used by this so as to
+     *           reduce the size of the boolean functions it represents.
+     */
+    virtual void reorder() const = 0;
+
     // mandatory virtual constructor
     virtual ~BoolFctFactory() {}
 };
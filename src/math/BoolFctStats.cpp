@@ -0,0 +1,41 @@
+/*
+ * BoolFctStats.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "BoolFctStats.hpp"
+
+#include <sstream>
+
+using std::string;
+using std::stringstream;
+
+namespace math {
+
+// constructors
+BoolFctStats::BoolFctStats()
+    : liveNodes(0), peakNodes(0), garbageCollections(0), gcTime(0),
+      reorderings(0), reorderingTime(0), cacheHits(0), cacheLookUps(0),
+      memoryInUse(0) {
+}
+
+// public methods
+double BoolFctStats::getCacheHitRate() const {
+    if (cacheLookUps <= 0) {
+        return 0;
+    }
+    return cacheHits / cacheLookUps;
+}
+
+string BoolFctStats::toString() const {
+    stringstream ss;
+    ss << "nodes: " << liveNodes << " live, " << peakNodes << " peak; "
+       << "GC: " << garbageCollections << " (" << gcTime << " ms); "
+       << "reorderings: " << reorderings << " (" << reorderingTime << " ms); "
+       << "cache hit rate: " << 100.0 * getCacheHitRate() << "%; "
+       << "memory: " << memoryInUse / 1024 << " KB";
+    return ss.str();
+}
+
+} // namespace math
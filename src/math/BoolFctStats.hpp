@@ -0,0 +1,61 @@
+/*
+ * BoolFctStats.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef MATH_BOOLFCTSTATS_HPP
+#define MATH_BOOLFCTSTATS_HPP
+
+#include <string>
+
+namespace math {
+
+/**
+ * BoolFctStats is a snapshot of the statistics of the engine underlying a
+ * BoolFctFactory, e.g. the CUDD manager shared by all the BoolFctCUDDs.
+ *
+ * Specification fields:
+ * - liveNodes          : long           // nodes currently in the unique table
+ * - peakNodes          : long           // max number of nodes ever allocated
+ * - garbageCollections : int            // number of garbage collections
+ * - gcTime             : long           // time spent in GC (ms)
+ * - reorderings        : unsigned int   // number of dynamic reorderings
+ * - reorderingTime     : long           // time spent reordering (ms)
+ * - cacheHits          : double         // computed table hits
+ * - cacheLookUps       : double         // computed table look-ups
+ * - memoryInUse        : unsigned long  // memory allocated (bytes)
+ *
+ * @author mwi
+ */
+struct BoolFctStats {
+
+    long liveNodes;
+    long peakNodes;
+    int garbageCollections;
+    long gcTime;
+    unsigned int reorderings;
+    long reorderingTime;
+    double cacheHits;
+    double cacheLookUps;
+    unsigned long memoryInUse;
+
+    /**
+     * @effects Makes this be a snapshot with all fields set to 0.
+     */
+    BoolFctStats();
+
+    /**
+     * @return the computed table hit rate, in [0, 1], of this.
+     */
+    double getCacheHitRate() const;
+
+    /**
+     * @return a single-line string representation of this.
+     */
+    std::string toString() const;
+};
+
+} // namespace math
+
+#endif /* MATH_BOOLFCTSTATS_HPP */
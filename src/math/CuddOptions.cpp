@@ -0,0 +1,65 @@
+/*
+ * CuddOptions.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "CuddOptions.hpp"
+
+#include "util/Assert.hpp"
+
+#include <cuddObj.hh>
+
+using std::string;
+
+namespace math {
+
+namespace {
+
+/* The names of the reordering methods, in the order of their values. */
+const char * const ReorderingNames[] = {
+    "none", "sift", "sift-converge", "symm-sift", "symm-sift-converge",
+    "window2", "window3", "window4", "group-sift", "lazy-sift", "linear",
+    "annealing", "genetic", "exact"
+};
+
+const unsigned int NbOfReorderings =
+        sizeof(ReorderingNames) / sizeof(ReorderingNames[0]);
+
+/* The defaults of CUDD for the first reordering and the max growth. */
+const unsigned int DefaultFirstReordering = 4004;
+const double DefaultMaxGrowth = 1.2;
+
+} // namespace
+
+// constructors
+CuddOptions::CuddOptions()
+        : uniqueSlots(CUDD_UNIQUE_SLOTS), cacheSlots(CUDD_CACHE_SLOTS),
+          maxMemory(0), reordering(None),
+          firstReordering(DefaultFirstReordering),
+          maxGrowth(DefaultMaxGrowth) {}
+
+// public methods
+bool CuddOptions::hasSameSizes(const CuddOptions & options) const {
+    return uniqueSlots == options.uniqueSlots
+            && cacheSlots == options.cacheSlots;
+}
+
+bool CuddOptions::parseReordering(const string & name,
+        Reordering & reordering) {
+    for (unsigned int i = 0; i < NbOfReorderings; ++i) {
+        if (name == ReorderingNames[i]) {
+            reordering = static_cast<Reordering>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+string CuddOptions::getReorderingName(Reordering reordering) {
+    assertTrue(static_cast<unsigned int>(reordering) < NbOfReorderings);
+
+    return ReorderingNames[reordering];
+}
+
+} // namespace math
@@ -0,0 +1,92 @@
+/*
+ * CuddOptions.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef MATH_CUDDOPTIONS_HPP
+#define MATH_CUDDOPTIONS_HPP
+
+#include <string>
+
+namespace math {
+
+/**
+ * CuddOptions are the options of the CUDD manager shared by all the
+ * BoolFctCUDDs.
+ *
+ * The sizes of the tables of the manager only apply when it is created, i.e.
+ * when the first BoolFctCUDD is created. The other options apply whenever the
+ * manager is configured.
+ *
+ * Specification fields:
+ * - uniqueSlots     : unsigned int   // initial size of each unique subtable
+ * - cacheSlots      : unsigned int   // initial size of the computed table
+ * - maxMemory       : unsigned long  // max memory in bytes, 0 for no limit
+ * - reordering      : Reordering     // dynamic reordering method
+ * - firstReordering : unsigned int   // number of nodes triggering the first
+ *                                    // dynamic reordering
+ * - maxGrowth       : double         // max growth of the number of nodes
+ *                                    // while sifting a variable
+ *
+ * @author mwi
+ */
+struct CuddOptions {
+
+    /**
+     * The dynamic reordering methods.
+     */
+    enum Reordering {
+        None,
+        Sift,
+        SiftConverge,
+        SymmetricSift,
+        SymmetricSiftConverge,
+        Window2,
+        Window3,
+        Window4,
+        GroupSift,
+        LazySift,
+        Linear,
+        Annealing,
+        Genetic,
+        Exact
+    };
+
+    unsigned int uniqueSlots;
+    unsigned int cacheSlots;
+    unsigned long maxMemory;
+    Reordering reordering;
+    unsigned int firstReordering;
+    double maxGrowth;
+
+    /**
+     * @effects Makes this be the default options of CUDD, without dynamic
+     *           reordering.
+     */
+    CuddOptions();
+
+    /**
+     * @return true iff the sizes of the tables of this and 'options' are
+     *          the same.
+     */
+    bool hasSameSizes(const CuddOptions & options) const;
+
+    /**
+     * @modifies reordering
+     * @effects Makes 'reordering' be the reordering method named 'name', if
+     *           any.
+     * @return true iff 'name' is the name of a reordering method.
+     */
+    static bool parseReordering(const std::string & name,
+            Reordering & reordering);
+
+    /**
+     * @return the name of the reordering method 'reordering'.
+     */
+    static std::string getReorderingName(Reordering reordering);
+};
+
+} // namespace math
+
+#endif /* MATH_CUDDOPTIONS_HPP */
@@ -14,56 +14,168 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
-#include <memory>
+#include <map>
+#include <set>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
-using std::auto_ptr;
 using std::istream;
 using std::logic_error;
+using std::map;
+using std::set;
 using std::string;
+using std::vector;
 
 namespace math {
 
-BoolFct * parseBoolFct(istream & stream, const BoolFctFactoryPtr & factory) {
+namespace {
+
+/* The maximal number of variables in the support of a cluster of clauses. */
+const unsigned int MAX_CLUSTER_SUPPORT = 16;
+
+/* A conjunction of clauses, along with the variables it depends on. */
+struct Cluster {
+    set<int> support;
+    BoolFctPtr fct;
+};
+
+/**
+ * @return true iff the smallest variable of the support of 'lhs' is smaller
+ *         than the one of 'rhs', an empty support being the smallest.
+ */
+bool bySmallestVariable(const Cluster & lhs, const Cluster & rhs) {
+    if (rhs.support.empty()) {
+        return false;
+    }
+    return lhs.support.empty() || *lhs.support.begin() < *rhs.support.begin();
+}
+
+/**
+ * @modifies clusters, clustersOf
+ * @effects Conjoins the clause 'clause' to the cluster of 'clusters' whose
+ *           support shares the most variables with it, as long as the
+ *           support of the cluster stays within MAX_CLUSTER_SUPPORT
+ *           variables. Otherwise, adds a new cluster for 'clause'.
+ *           'clustersOf' maps each variable to the indices of the clusters
+ *           whose support contains it.
+ */
+void addClause(const vector<int> & clause, const BoolFctFactoryPtr & factory,
+        vector<Cluster> & clusters,
+        map<int, vector<unsigned int> > & clustersOf) {
+    BoolFctPtr disjunction(factory->getFalse());
+    set<int> variables;
+    for (vector<int>::const_iterator it = clause.begin(); it != clause.end();
+            ++it) {
+        const int var = std::abs(*it);
+        BoolFctPtr literal(factory->create(BoolVar::makeBoolVar(var)));
+        if (*it < 0) {
+            literal->negation();
+        }
+        disjunction->disjunction(*literal);
+        variables.insert(var);
+    }
+
+    // Counting the variables shared with each cluster
+    map<unsigned int, unsigned int> overlaps;
+    for (set<int>::const_iterator var = variables.begin();
+            var != variables.end(); ++var) {
+        const vector<unsigned int> & indices = clustersOf[*var];
+        for (vector<unsigned int>::const_iterator it = indices.begin();
+                it != indices.end(); ++it) {
+            ++overlaps[*it];
+        }
+    }
+    unsigned int best = clusters.size();
+    unsigned int bestOverlap = 0;
+    for (map<unsigned int, unsigned int>::const_iterator it = overlaps.begin();
+            it != overlaps.end(); ++it) {
+        const unsigned int size = clusters[it->first].support.size()
+                + variables.size() - it->second;
+        if (it->second > bestOverlap && size <= MAX_CLUSTER_SUPPORT) {
+            best = it->first;
+            bestOverlap = it->second;
+        }
+    }
+
+    if (best == clusters.size()) {
+        clusters.push_back(Cluster());
+        clusters.back().fct = disjunction;
+    } else {
+        clusters[best].fct->conjunction(*disjunction);
+    }
+    for (set<int>::const_iterator var = variables.begin();
+            var != variables.end(); ++var) {
+        if (clusters[best].support.insert(*var).second) {
+            clustersOf[*var].push_back(best);
+        }
+    }
+}
+
+} // namespace
+
+BoolFct * parseBoolFct(istream & stream, const BoolFctFactoryPtr & factory,
+        bool reorder) {
     // Eating comments and declaration
     bool found = false;
     while (!stream.eof() && !found) {
         string line;
         std::getline(stream, line);
-        if (line[0] == 'p') {
+        if (!line.empty() && line[0] == 'p') {
             found = true;
         }
     }
     if (!found) {
         throw logic_error("Wrong dimacs file");
     }
-    // Parsing boolean function
+    // Parsing the clauses, clustered by the variables they share
+    vector<Cluster> clusters;
+    map<int, vector<unsigned int> > clustersOf;
+    vector<int> clause;
     int id;
-    auto_ptr<BoolFct> literal;
-    auto_ptr<BoolFct> disjunction;
-    BoolFct * result = factory->getTrue();
-    stream >> id;
-    while (!stream.eof()) {
-        disjunction.reset(factory->getFalse());
-        while (id != 0) {
-            if (id > 0) {
-                literal.reset(factory->create(BoolVar::makeBoolVar(id)));
-                disjunction->disjunction(*literal);
-            } else {
-                id = -id;
-                literal.reset(factory->create(BoolVar::makeBoolVar(id)));
-                literal->negation();
-                disjunction->disjunction(*literal);
-            }
-            stream >> id;
+    while (stream >> id) {
+        if (id != 0) {
+            clause.push_back(id);
+        } else {
+            addClause(clause, factory, clusters, clustersOf);
+            clause.clear();
+        }
+    }
+    if (!clause.empty()) {
+        addClause(clause, factory, clusters, clustersOf);
+    }
+    // Conjoining the clusters in a balanced tree, in variable order
+    std::stable_sort(clusters.begin(), clusters.end(), bySmallestVariable);
+    vector<BoolFctPtr> level;
+    for (vector<Cluster>::const_iterator it = clusters.begin();
+            it != clusters.end(); ++it) {
+        if (!it->fct->isSatisfiable()) {
+            return factory->getFalse();
+        }
+        level.push_back(it->fct);
+    }
+    DVLOG(1) << clusters.size() << " clusters of clauses to conjoin";
+    if (level.empty()) {
+        return factory->getTrue();
+    }
+    while (level.size() > 1) {
+        vector<BoolFctPtr> nextLevel;
+        for (unsigned int i = 0; i + 1 < level.size(); i += 2) {
+            level[i]->conjunction(*level[i + 1]);
+            nextLevel.push_back(level[i]);
+        }
+        if (level.size() % 2 == 1) {
+            nextLevel.push_back(level.back());
+        }
+        level.swap(nextLevel);
+        if (reorder) {
+            factory->reorder();
         }
-        result->conjunction(*disjunction);
-        stream >> id;
     }
-    return result;
+    return level.front()->clone();
 }
 
 } // namespace math
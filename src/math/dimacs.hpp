@@ -15,12 +15,19 @@ namespace math {
 
 /**
  * @requires 'stream' is a valid dimacs stream
- * @modifies this
- * @effects Reads the input stream 'stream'.
+ * @modifies stream, factory
+ * @effects Reads the input stream 'stream'. Each clause is conjoined to
+ *           the cluster of clauses sharing the most variables with it, within
+ *           a bound on the number of variables of a cluster. The clusters are
+ *           conjoined in a balanced tree, in the order of their smallest
+ *           variables, so that the intermediate boolean functions remain
+ *           small. If 'reorder' is
+ *           true, the variables of 'factory' are reordered after each level
+ *           of the tree.
  * @return the boolean function represented in 'stream'.
  */
 BoolFct * parseBoolFct(std::istream & stream,
-    const math::BoolFctFactoryPtr & factory);
+    const math::BoolFctFactoryPtr & factory, bool reorder = false);
 
 } // namespace math
 
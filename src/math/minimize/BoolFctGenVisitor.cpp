@@ -0,0 +1,96 @@
+/*
+ * BoolFctGenVisitor.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "BoolFctGenVisitor.hpp"
+
+#include "math/BoolFct.hpp"
+#include "util/Assert.hpp"
+#include "util/Stack.hpp"
+#include "util/parser/AndExp.hpp"
+#include "util/parser/BoolValue.hpp"
+#include "util/parser/NotExp.hpp"
+#include "util/parser/OrExp.hpp"
+#include "util/parser/Var.hpp"
+
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+using util::parser::AndExp;
+using util::parser::BoolValue;
+using util::parser::NotExp;
+using util::parser::OrExp;
+using util::parser::Var;
+
+namespace math {
+namespace minimize {
+
+// constructors
+BoolFctGenVisitor::BoolFctGenVisitor(const BoolFctFactory & boolFctFactory)
+        : boolFctFactory(boolFctFactory), boolFcts() {
+    checkRep();
+}
+
+// public methods
+BoolFctPtr BoolFctGenVisitor::getBoolFct() const {
+    assertTrue(!boolFcts.empty());
+
+    return boolFcts.peek();
+}
+
+void BoolFctGenVisitor::orExp(const OrExp & exp) {
+    assertTrue(boolFcts.count() >= 2);
+
+    BoolFctPtr rhs = boolFcts.pop();
+    BoolFctPtr lhs = boolFcts.pop();
+    lhs->disjunction(*rhs);
+    boolFcts.push(lhs);
+
+    checkRep();
+}
+
+void BoolFctGenVisitor::andExp(const AndExp & exp) {
+    assertTrue(boolFcts.count() >= 2);
+
+    BoolFctPtr rhs = boolFcts.pop();
+    BoolFctPtr lhs = boolFcts.pop();
+    lhs->conjunction(*rhs);
+    boolFcts.push(lhs);
+
+    checkRep();
+}
+
+void BoolFctGenVisitor::notExp(const NotExp & exp) {
+    assertTrue(boolFcts.count() >= 1);
+
+    BoolFctPtr boolFct = boolFcts.pop();
+    boolFct->negation();
+    boolFcts.push(boolFct);
+
+    checkRep();
+}
+
+void BoolFctGenVisitor::boolValue(const BoolValue & val) {
+    if (val.getValue()) {
+        boolFcts.push(BoolFctPtr(boolFctFactory.getTrue()));
+    } else {
+        boolFcts.push(BoolFctPtr(boolFctFactory.getFalse()));
+    }
+
+    checkRep();
+}
+
+void BoolFctGenVisitor::var(const Var & v) {
+    boolFcts.push(BoolFctPtr(boolFctFactory.create(v.getName())));
+}
+
+// private methods
+void BoolFctGenVisitor::checkRep() const {
+    if (doCheckRep) {
+        // Nothing to do
+    }
+}
+
+} // namespace minimize
+} // namespace math
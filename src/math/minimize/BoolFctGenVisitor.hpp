@@ -0,0 +1,72 @@
+/*
+ * BoolFctGenVisitor.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef MATH_MINIMIZE_BOOLFCTGENVISITOR_HPP
+#define	MATH_MINIMIZE_BOOLFCTGENVISITOR_HPP
+
+#include "math/forwards.hpp"
+#include "math/BoolFctFactory.hpp"
+
+#include "util/Stack.hpp"
+#include "util/Uncopyable.hpp"
+#include "util/parser/Visitor.hpp"
+
+namespace math {
+namespace minimize {
+
+/**
+ * BoolFctGenVisitor is an implementation of the Visitor interface. It visits
+ * a Boolean expression to generate a Boolean function out of it.
+ *
+ * @author mwi
+ */
+class BoolFctGenVisitor : public util::parser::Visitor,
+        private util::Uncopyable {
+
+private:
+    /* The Boolean function factory used to produce the result. */
+    const BoolFctFactory & boolFctFactory;
+    /* Stores the generated Boolean functions. */
+    util::Stack<BoolFctPtr> boolFcts;
+
+    /*
+     * Representation Invariant:
+     *   I(c) = true
+     */
+
+public:
+    /**
+     * @effects Makes this be a new BoolFctGenVisitor with the Boolean function
+     *           factory 'boolFctFactory'.
+     */
+    explicit BoolFctGenVisitor(const BoolFctFactory & boolFctFactory);
+
+    // The default destructor is fine.
+
+    /**
+     * @requires a Boolean expression has been visited
+     * @return the generated Boolean function.
+     */
+    BoolFctPtr getBoolFct() const;
+
+    // overridden methods
+    void orExp(const util::parser::OrExp & exp);
+    void andExp(const util::parser::AndExp & exp);
+    void notExp(const util::parser::NotExp & exp);
+    void boolValue(const util::parser::BoolValue & val);
+    void var(const util::parser::Var & v);
+
+private:
+    /**
+     * @effects Asserts the rep invariant holds for this.
+     */
+    void checkRep() const;
+};
+
+} // namespace minimize
+} // namespace math
+
+#endif	/* MATH_MINIMIZE_BOOLFCTGENVISITOR_HPP */
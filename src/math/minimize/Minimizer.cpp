@@ -6,27 +6,24 @@
 
 #include "Minimizer.hpp"
 
-#include "MinimizeGenVisitor.hpp"
-#include "MinimizeParser.hpp"
-#include "VarTable.hpp"
+#include "BoolFctGenVisitor.hpp"
 
-#include "config/Environment.hpp"
+#include "math/BoolFct.hpp"
+#include "math/BoolFctCUDD.hpp"
+#include "math/BoolFctCUDDFactory.hpp"
+#include "math/BoolVar.hpp"
 
-#include "core/checker/Checker.hpp"
-
-#include "util/strings.hpp"
+#include "util/Assert.hpp"
 #include "util/parser/BoolExp.hpp"
 #include "util/parser/BoolExpParser.hpp"
 
 #include <glog/logging.h>
 
-#include <cstdlib>
-#include <fstream>
-
-using config::Environment;
+#include <sstream>
 
-using std::ifstream;
+using std::make_pair;
 using std::string;
+using std::stringstream;
 
 using util::parser::BoolExpParser;
 using util::parser::BoolExpPtr;
@@ -34,11 +31,8 @@ using util::parser::BoolExpPtr;
 namespace math {
 namespace minimize {
 
-// static variables
-const string Minimizer::MinimizeFilePath = "/tmp/pvl_minimize.tmp";
-
 // constructors
-Minimizer::Minimizer() {
+Minimizer::Minimizer() : isops(), minimized() {
     checkRep();
 }
 
@@ -47,44 +41,159 @@ string Minimizer::minimize(const string & expression) const {
     BoolExpParser boolExpParser(expression);
     BoolExpPtr boolExp = boolExpParser.parse();
 
-    MinimizeGenVisitor visitor;
+    BoolFctCUDDFactory factory;
+    BoolFctGenVisitor visitor(factory);
     boolExp->accept(visitor);
 
-    // Workaround due to a bug of the Minimizer program.
-    if (expression == "true" || expression == "false") {
-        return expression;
+    return minimize(*visitor.getBoolFct());
+}
+
+string Minimizer::minimize(const BoolFct & fct) const {
+    const BoolFctCUDD & cuddFct = static_cast<const BoolFctCUDD &>(fct);
+    assertTrue(cuddFct.isValid());
+
+    const BDD & f = cuddFct.bdd;
+    std::map<DdNode *, Minimized>::const_iterator it =
+            minimized.find(f.getNode());
+    if (it != minimized.end()) {
+        return it->second.expression;
     }
 
-    if (visitor.isAborted()) {
-        return expression;
+    Cover cover(isop(f, f).cover);
+    cleanup(cover, f);
+    Minimized result;
+    result.function = f;
+    result.expression = toString(cover);
+    minimized.insert(make_pair(f.getNode(), result));
+
+    DVLOG(1) << "Minimized into " << result.expression;
+    return result.expression;
+}
+
+// private methods
+const Minimizer::Isop & Minimizer::isop(const BDD & lower, const BDD & upper) const {
+    const std::pair<DdNode *, DdNode *> key(lower.getNode(), upper.getNode());
+    std::map<std::pair<DdNode *, DdNode *>, Isop>::const_iterator it =
+            isops.find(key);
+    if (it != isops.end()) {
+        return it->second;
     }
 
-    string command("java -jar ");
-    command += Environment::getMinimizeHome();
-    command += "/Minimize.jar ";
-    command += "\"";
-    command += visitor.getMinimizeExp();
-    command += "\" > ";
-    command += MinimizeFilePath;
+    Isop result;
+    result.lower = lower;
+    result.upper = upper;
+    if (lower.IsZero()) {
+        result.function = BoolFctCUDD::getCudd().bddZero();
+    } else if (upper.IsOne()) {
+        result.function = BoolFctCUDD::getCudd().bddOne();
+        result.cover.push_back(Cube());
+    } else {
+        /* Neither bound is constant here, so that the splitting variable is
+         * the top variable of either bound. */
+        const int lowerIndex = lower.NodeReadIndex();
+        const int upperIndex = upper.NodeReadIndex();
+        const int index = BoolFctCUDD::getCudd().ReadPerm(lowerIndex)
+                <= BoolFctCUDD::getCudd().ReadPerm(upperIndex)
+                ? lowerIndex : upperIndex;
+        const BDD x = BoolFctCUDD::getCudd().bddVar(index);
+        const BDD lower0 = lower.Cofactor(!x);
+        const BDD lower1 = lower.Cofactor(x);
+        const BDD upper0 = upper.Cofactor(!x);
+        const BDD upper1 = upper.Cofactor(x);
+
+        const Isop & isop0 = isop(lower0 * !upper1, upper0);
+        const Isop & isop1 = isop(lower1 * !upper0, upper1);
+        const Isop & isopStar = isop(lower0 * !isop0.function
+                + lower1 * !isop1.function, upper0 * upper1);
+
+        result.function = !x * isop0.function + x * isop1.function
+                + isopStar.function;
+        for (Cover::const_iterator c = isop0.cover.begin();
+                c != isop0.cover.end(); ++c) {
+            Cube cube(1, -(index + 1));
+            cube.insert(cube.end(), c->begin(), c->end());
+            result.cover.push_back(cube);
+        }
+        result.cover.insert(result.cover.end(), isopStar.cover.begin(),
+                isopStar.cover.end());
+        for (Cover::const_iterator c = isop1.cover.begin();
+                c != isop1.cover.end(); ++c) {
+            Cube cube(1, index + 1);
+            cube.insert(cube.end(), c->begin(), c->end());
+            result.cover.push_back(cube);
+        }
+    }
+    return isops.insert(make_pair(key, result)).first->second;
+}
 
-    int result = system(command.c_str());
-    assertTrue(result == 0);
+void Minimizer::cleanup(Cover & cover, const BDD & f) const {
+    for (Cover::iterator c = cover.begin(); c != cover.end(); ++c) {
+        unsigned int i = 0;
+        while (i < c->size()) {
+            Cube expanded(*c);
+            expanded.erase(expanded.begin() + i);
+            if (toBdd(expanded) <= f) {
+                *c = expanded;
+            } else {
+                ++i;
+            }
+        }
+    }
 
-    ifstream inputFileStream(MinimizeFilePath.c_str());
-    assertTrue(inputFileStream.is_open());
-    string minimizeExp = util::toString(inputFileStream);
+    for (int i = (int) cover.size() - 1; i >= 0; --i) {
+        BDD others = BoolFctCUDD::getCudd().bddZero();
+        for (unsigned int j = 0; j < cover.size(); ++j) {
+            if ((int) j != i) {
+                others += toBdd(cover[j]);
+            }
+        }
+        if (toBdd(cover[i]) <= others) {
+            cover.erase(cover.begin() + i);
+        }
+    }
+}
 
-    MinimizeParser minimizeParser(minimizeExp, visitor.getVarTable());
-    const string endExpression(minimizeParser.parse());
+BDD Minimizer::toBdd(const Cube & cube) const {
+    BDD result = BoolFctCUDD::getCudd().bddOne();
+    for (Cube::const_iterator l = cube.begin(); l != cube.end(); ++l) {
+        if (*l > 0) {
+            result *= BoolFctCUDD::getCudd().bddVar(*l - 1);
+        } else {
+            result *= !BoolFctCUDD::getCudd().bddVar(-*l - 1);
+        }
+    }
+    return result;
+}
 
-    LOG(INFO) << expression << " minimized into " << endExpression;
-    return endExpression;
+string Minimizer::toString(const Cover & cover) const {
+    if (cover.empty()) {
+        return "false";
+    }
+    stringstream stream;
+    for (Cover::const_iterator c = cover.begin(); c != cover.end(); ++c) {
+        if (c->empty()) {
+            return "true";
+        }
+        if (c != cover.begin()) {
+            stream << " || ";
+        }
+        for (Cube::const_iterator l = c->begin(); l != c->end(); ++l) {
+            if (l != c->begin()) {
+                stream << " && ";
+            }
+            if (*l > 0) {
+                stream << BoolVar::makeBoolVar(*l - 1).getName();
+            } else {
+                stream << "!" << BoolVar::makeBoolVar(-*l - 1).getName();
+            }
+        }
+    }
+    return stream.str();
 }
 
-// private methods
 void Minimizer::checkRep() const {
     if (doCheckRep) {
-        assertTrue(Minimizer::MinimizeFilePath.length() > 0);
+        // Nothing to do
     }
 }
 
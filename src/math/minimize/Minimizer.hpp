@@ -7,9 +7,16 @@
 #ifndef MATH_MINIMIZE_MINIMIZER_HPP
 #define	MATH_MINIMIZE_MINIMIZER_HPP
 
+#include "math/forwards.hpp"
+
 #include "util/Uncopyable.hpp"
 
+#include <cuddObj.hh>
+
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace math {
 namespace minimize {
@@ -17,17 +24,50 @@ namespace minimize {
 /**
  * Minimizer is a minimizer of Boolean expressions.
  *
+ * The minimization runs in process on the BDD of the expression: an
+ * irredundant sum of products is extracted from the BDD with the algorithm of
+ * Minato and Morreale, then each of its cubes is expanded into a prime
+ * implicant and the cubes covered by the others are removed.
+ *
+ * A minimizer remembers the expressions it has minimized, so that a batch of
+ * Boolean functions sharing the same BDDs is best minimized by a single
+ * minimizer: each distinct BDD is then minimized only once.
+ *
  * @author mwi
  */
 class Minimizer : private util::Uncopyable {
 
 private:
-    /* Temp file path to use with Minimize.jar */
-    static const std::string MinimizeFilePath;
+    /* A cube, i.e. a conjunction of literals. A literal is the index of its
+     * variable plus one, negated iff the literal is negative. */
+    typedef std::vector<int> Cube;
+
+    /* A cover, i.e. a disjunction of cubes. */
+    typedef std::vector<Cube> Cover;
+
+    /* An irredundant cover, along with the function it represents. */
+    struct Isop {
+        BDD lower;
+        BDD upper;
+        BDD function;
+        Cover cover;
+    };
+
+    /* A minimized Boolean expression, along with its function. */
+    struct Minimized {
+        BDD function;
+        std::string expression;
+    };
+
+    /* The irredundant covers computed so far, by lower and upper bounds. */
+    mutable std::map<std::pair<DdNode *, DdNode *>, Isop> isops;
+
+    /* The Boolean expressions minimized so far, by BDD node. */
+    mutable std::map<DdNode *, Minimized> minimized;
 
     /**
      * Representation Invariant:
-     *   I(c) = c.MinimizeFilePath.length > 0
+     *   I(c) = true
      */
 
 public:
@@ -43,7 +83,42 @@ public:
      */
     std::string minimize(const std::string & expression) const;
 
+    /**
+     * @requires fct is a valid BoolFctCUDD
+     * @modifies this
+     * @effects Remembers the minimized Boolean expression of 'fct'.
+     * @return the minimized Boolean expression of 'fct'.
+     */
+    std::string minimize(const BoolFct & fct) const;
+
 private:
+    /**
+     * @requires lower <= upper
+     * @modifies this
+     * @effects Computes an irredundant sum of products of a function f such
+     *           that lower <= f <= upper, and caches it in this.
+     * @return the computed irredundant sum of products.
+     */
+    const Isop & isop(const BDD & lower, const BDD & upper) const;
+
+    /**
+     * @modifies cover
+     * @effects Expands each cube of 'cover' into a prime implicant of 'f',
+     *           then removes the cubes of 'cover' covered by the others. The
+     *           order of the remaining cubes is kept.
+     */
+    void cleanup(Cover & cover, const BDD & f) const;
+
+    /**
+     * @return the BDD of the cube 'cube'.
+     */
+    BDD toBdd(const Cube & cube) const;
+
+    /**
+     * @return the Boolean expression of the cover 'cover'.
+     */
+    std::string toString(const Cover & cover) const;
+
     /**
      * @effects Asserts the rep invariant holds for this.
      */
@@ -0,0 +1,123 @@
+/*
+ * LtlFormula.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "LtlFormula.hpp"
+
+#include "util/Assert.hpp"
+
+using std::string;
+
+namespace neverclaim {
+
+// constructors
+LtlFormula::LtlFormula(Operator op, const string & name,
+        const LtlFormulaPtr & left, const LtlFormulaPtr & right)
+        : op(op), name(name), left(left), right(right) {
+    checkRep();
+}
+
+// public methods
+LtlFormula::Operator LtlFormula::getOperator() const {
+    return op;
+}
+
+const string & LtlFormula::getName() const {
+    assertTrue(op == Proposition);
+
+    return name;
+}
+
+const LtlFormulaPtr & LtlFormula::getLeft() const {
+    assertTrue(left);
+
+    return left;
+}
+
+const LtlFormulaPtr & LtlFormula::getRight() const {
+    assertTrue(right);
+
+    return right;
+}
+
+string LtlFormula::toString() const {
+    switch (op) {
+        case True:
+            return "true";
+        case False:
+            return "false";
+        case Proposition:
+            return name;
+        case Not:
+            return "!(" + left->toString() + ")";
+        case And:
+            return "(" + left->toString() + " && " + right->toString() + ")";
+        case Or:
+            return "(" + left->toString() + " || " + right->toString() + ")";
+        case Next:
+            return "X (" + left->toString() + ")";
+        case Until:
+            return "(" + left->toString() + " U " + right->toString() + ")";
+        case Release:
+            return "(" + left->toString() + " V " + right->toString() + ")";
+    }
+    return "";
+}
+
+// static factory methods
+LtlFormulaPtr LtlFormula::makeTrue() {
+    return LtlFormulaPtr(new LtlFormula(True, "", LtlFormulaPtr(),
+            LtlFormulaPtr()));
+}
+
+LtlFormulaPtr LtlFormula::makeFalse() {
+    return LtlFormulaPtr(new LtlFormula(False, "", LtlFormulaPtr(),
+            LtlFormulaPtr()));
+}
+
+LtlFormulaPtr LtlFormula::makeProposition(const string & name) {
+    return LtlFormulaPtr(new LtlFormula(Proposition, name, LtlFormulaPtr(),
+            LtlFormulaPtr()));
+}
+
+LtlFormulaPtr LtlFormula::makeNot(const LtlFormulaPtr & formula) {
+    return LtlFormulaPtr(new LtlFormula(Not, "", formula, LtlFormulaPtr()));
+}
+
+LtlFormulaPtr LtlFormula::makeAnd(const LtlFormulaPtr & left,
+        const LtlFormulaPtr & right) {
+    return LtlFormulaPtr(new LtlFormula(And, "", left, right));
+}
+
+LtlFormulaPtr LtlFormula::makeOr(const LtlFormulaPtr & left,
+        const LtlFormulaPtr & right) {
+    return LtlFormulaPtr(new LtlFormula(Or, "", left, right));
+}
+
+LtlFormulaPtr LtlFormula::makeNext(const LtlFormulaPtr & formula) {
+    return LtlFormulaPtr(new LtlFormula(Next, "", formula, LtlFormulaPtr()));
+}
+
+LtlFormulaPtr LtlFormula::makeUntil(const LtlFormulaPtr & left,
+        const LtlFormulaPtr & right) {
+    return LtlFormulaPtr(new LtlFormula(Until, "", left, right));
+}
+
+LtlFormulaPtr LtlFormula::makeRelease(const LtlFormulaPtr & left,
+        const LtlFormulaPtr & right) {
+    return LtlFormulaPtr(new LtlFormula(Release, "", left, right));
+}
+
+// private methods
+void LtlFormula::checkRep() const {
+    if (doCheckRep) {
+        assertTrue((op == Proposition) == (name.length() > 0));
+        assertTrue((op == True || op == False || op == Proposition) == !left);
+        assertTrue((op == And || op == Or || op == Until || op == Release)
+                == (bool) right);
+    }
+}
+
+} // namespace neverclaim
@@ -0,0 +1,169 @@
+/*
+ * LtlFormula.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef NEVERCLAIM_LTLFORMULA_HPP
+#define NEVERCLAIM_LTLFORMULA_HPP
+
+#include "forwards.hpp"
+#include "util/Uncopyable.hpp"
+
+#include <string>
+#include <tr1/memory>
+
+namespace neverclaim {
+
+/**
+ * LtlFormulas are immutable formulas of the linear temporal logic, built from
+ * the constants true and false, propositions, negation, conjunction,
+ * disjunction, and the next, until and release temporal operators. The other
+ * operators of the Spin syntax ([], <>, ->, <->) are expressed with these ones
+ * (see LtlParser).
+ *
+ * Specification Fields:
+ *   - op : Operator       // The main operator of this formula.
+ *   - name : string       // The name of the proposition, if op = Proposition.
+ *   - left : LtlFormula   // The first operand, if any.
+ *   - right : LtlFormula  // The second operand of the binary operators.
+ *
+ * @author mwi
+ */
+class LtlFormula : private util::Uncopyable {
+
+public:
+    /**
+     * The operators of the formulas.
+     */
+    enum Operator {
+        True,
+        False,
+        Proposition,
+        Not,
+        And,
+        Or,
+        Next,
+        Until,
+        Release
+    };
+
+private:
+    const Operator op;
+    const std::string name;
+    const LtlFormulaPtr left;
+    const LtlFormulaPtr right;
+
+    /*
+     * Representation Invariant:
+     *   I(c) = (c.op = Proposition) <=> (c.name.length > 0)
+     *     (c.op in {True, False, Proposition}) <=> (c.left = null)
+     *     (c.op in {And, Or, Until, Release}) <=> (c.right != null)
+     */
+
+    /**
+     * @requires the arguments satisfy the rep invariant
+     * @effects Makes this be a new formula with the operator 'op', the name
+     *           'name' and the operands 'left' and 'right'.
+     */
+    LtlFormula(Operator op, const std::string & name,
+        const LtlFormulaPtr & left, const LtlFormulaPtr & right);
+
+public:
+    // The default destructor is fine.
+
+    /**
+     * @return this.op
+     */
+    Operator getOperator() const;
+
+    /**
+     * @requires this.op = Proposition
+     * @return this.name
+     */
+    const std::string & getName() const;
+
+    /**
+     * @requires this.op is not in {True, False, Proposition}
+     * @return this.left
+     */
+    const LtlFormulaPtr & getLeft() const;
+
+    /**
+     * @requires this.op in {And, Or, Until, Release}
+     * @return this.right
+     */
+    const LtlFormulaPtr & getRight() const;
+
+    /**
+     * @return a string representation of this in the Spin syntax, where the
+     *          release operator is written V.
+     */
+    std::string toString() const;
+
+    /**
+     * @return the formula true.
+     */
+    static LtlFormulaPtr makeTrue();
+
+    /**
+     * @return the formula false.
+     */
+    static LtlFormulaPtr makeFalse();
+
+    /**
+     * @requires name.length > 0
+     * @return the proposition named 'name'.
+     */
+    static LtlFormulaPtr makeProposition(const std::string & name);
+
+    /**
+     * @requires formula != null
+     * @return the negation of 'formula'.
+     */
+    static LtlFormulaPtr makeNot(const LtlFormulaPtr & formula);
+
+    /**
+     * @requires left != null && right != null
+     * @return the conjunction of 'left' and 'right'.
+     */
+    static LtlFormulaPtr makeAnd(const LtlFormulaPtr & left,
+        const LtlFormulaPtr & right);
+
+    /**
+     * @requires left != null && right != null
+     * @return the disjunction of 'left' and 'right'.
+     */
+    static LtlFormulaPtr makeOr(const LtlFormulaPtr & left,
+        const LtlFormulaPtr & right);
+
+    /**
+     * @requires formula != null
+     * @return the formula X 'formula'.
+     */
+    static LtlFormulaPtr makeNext(const LtlFormulaPtr & formula);
+
+    /**
+     * @requires left != null && right != null
+     * @return the formula 'left' U 'right'.
+     */
+    static LtlFormulaPtr makeUntil(const LtlFormulaPtr & left,
+        const LtlFormulaPtr & right);
+
+    /**
+     * @requires left != null && right != null
+     * @return the formula 'left' V 'right', i.e., !(!'left' U !'right').
+     */
+    static LtlFormulaPtr makeRelease(const LtlFormulaPtr & left,
+        const LtlFormulaPtr & right);
+
+private:
+    /**
+     * @effects Asserts the rep invariant holds for this.
+     */
+    void checkRep() const;
+};
+
+} // namespace neverclaim
+
+#endif /* NEVERCLAIM_LTLFORMULA_HPP */
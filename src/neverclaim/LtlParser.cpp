@@ -0,0 +1,216 @@
+/*
+ * LtlParser.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "LtlParser.hpp"
+
+#include "LtlFormula.hpp"
+#include "util/Assert.hpp"
+
+#include <sstream>
+#include <stdexcept>
+
+using std::logic_error;
+using std::ostringstream;
+using std::string;
+
+namespace neverclaim {
+
+// constructors
+LtlParser::LtlParser(const string & ltl)
+        : AbstractParser(ltl), errorMessage() {
+    checkRep();
+}
+
+// public methods
+LtlFormulaPtr LtlParser::parse() {
+    LtlFormulaPtr formula;
+    if (!equivExp(formula)) {
+        checkRep();
+        throw logic_error(errorMessage);
+    }
+
+    eatWhitespaces();
+    if (!isEndOfInputReach()) {
+        error();
+        checkRep();
+        throw logic_error(errorMessage);
+    }
+
+    checkRep();
+    return formula;
+}
+
+// private methods
+bool LtlParser::equivExp(LtlFormulaPtr & exp) {
+    if (!impliesExp(exp)) {
+        return false;
+    }
+    while (expect("<->")) {
+        LtlFormulaPtr rhs;
+        if (!impliesExp(rhs)) {
+            return false;
+        }
+        exp = LtlFormula::makeOr(LtlFormula::makeAnd(exp, rhs),
+                LtlFormula::makeAnd(LtlFormula::makeNot(exp),
+                        LtlFormula::makeNot(rhs)));
+    }
+    return true;
+}
+
+bool LtlParser::impliesExp(LtlFormulaPtr & exp) {
+    if (!orExp(exp)) {
+        return false;
+    }
+    if (expect("->")) {
+        LtlFormulaPtr rhs;
+        if (!impliesExp(rhs)) {
+            return false;
+        }
+        exp = LtlFormula::makeOr(LtlFormula::makeNot(exp), rhs);
+    }
+    return true;
+}
+
+bool LtlParser::orExp(LtlFormulaPtr & exp) {
+    if (!andExp(exp)) {
+        return false;
+    }
+    while (expect("||")) {
+        LtlFormulaPtr rhs;
+        if (!andExp(rhs)) {
+            return false;
+        }
+        exp = LtlFormula::makeOr(exp, rhs);
+    }
+    return true;
+}
+
+bool LtlParser::andExp(LtlFormulaPtr & exp) {
+    if (!untilExp(exp)) {
+        return false;
+    }
+    while (expect("&&")) {
+        LtlFormulaPtr rhs;
+        if (!untilExp(rhs)) {
+            return false;
+        }
+        exp = LtlFormula::makeAnd(exp, rhs);
+    }
+    return true;
+}
+
+bool LtlParser::untilExp(LtlFormulaPtr & exp) {
+    if (!unaryExp(exp)) {
+        return false;
+    }
+    while (true) {
+        LtlFormulaPtr rhs;
+        if (expect("U")) {
+            if (!unaryExp(rhs)) {
+                return false;
+            }
+            exp = LtlFormula::makeUntil(exp, rhs);
+        } else if (expect("V")) {
+            if (!unaryExp(rhs)) {
+                return false;
+            }
+            exp = LtlFormula::makeRelease(exp, rhs);
+        } else {
+            return true;
+        }
+    }
+}
+
+bool LtlParser::unaryExp(LtlFormulaPtr & exp) {
+    if (expect("!")) {
+        if (!unaryExp(exp)) {
+            return false;
+        }
+        exp = LtlFormula::makeNot(exp);
+    } else if (expect("[]")) {
+        if (!unaryExp(exp)) {
+            return false;
+        }
+        exp = LtlFormula::makeRelease(LtlFormula::makeFalse(), exp);
+    } else if (expect("<>")) {
+        if (!unaryExp(exp)) {
+            return false;
+        }
+        exp = LtlFormula::makeUntil(LtlFormula::makeTrue(), exp);
+    } else if (expect("X")) {
+        if (!unaryExp(exp)) {
+            return false;
+        }
+        exp = LtlFormula::makeNext(exp);
+    } else if (!atomExp(exp)) {
+        return false;
+    }
+    return true;
+}
+
+bool LtlParser::atomExp(LtlFormulaPtr & exp) {
+    if (!expect("(")) {
+        if (!name(exp)) {
+            return false;
+        }
+        return true;
+    }
+    if (!equivExp(exp)) {
+        return false;
+    }
+    if (!expect(")")) {
+        return false;
+    }
+    return true;
+}
+
+bool LtlParser::name(LtlFormulaPtr & exp) {
+    eatWhitespaces();
+    string varName;
+
+    if (!isLowercase()) {
+        error();
+        return false;
+    }
+    varName += getNextSymbol();
+    advanceCursor();
+
+    while (isLowercase() || isUppercase() || isDigit() || isUnderscore()) {
+        varName += getNextSymbol();
+        advanceCursor();
+    }
+
+    appendToParsedInput(varName);
+    if (varName == "true") {
+        exp = LtlFormula::makeTrue();
+    } else if (varName == "false") {
+        exp = LtlFormula::makeFalse();
+    } else {
+        exp = LtlFormula::makeProposition(varName);
+    }
+    return true;
+}
+
+void LtlParser::error() {
+    ostringstream oss;
+    oss << "Syntax Error: unexpected " ;
+    if (hasNextSymbol()) {
+        oss << "symbol '" << getNextSymbol() << "' ";
+    } else {
+        oss << "end ";
+    }
+    oss << "at position " << getPosition()
+        << " in the following LTL formula\n" << getInput();
+    errorMessage = oss.str();
+}
+
+void LtlParser::checkRep() const {
+    if (doCheckRep) {
+        AbstractParser::checkRep();
+    }
+}
+
+} // namespace neverclaim
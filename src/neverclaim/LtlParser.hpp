@@ -0,0 +1,160 @@
+/*
+ * LtlParser.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef NEVERCLAIM_LTLPARSER_HPP
+#define NEVERCLAIM_LTLPARSER_HPP
+
+#include "forwards.hpp"
+#include "util/parser/AbstractParser.hpp"
+
+#include <string>
+
+namespace neverclaim {
+
+/**
+ * LtlParser is a simple recursive descent parser for LTL formulas written in
+ * the syntax of Spin and ltl2ba.
+ *
+ * The EBNF LL(1) grammar for LTL formulas is as follows:
+ *
+ *   Ltl: EquivExp
+ *
+ *   EquivExp: ImpliesExp ('<->' ImpliesExp)*
+ *
+ *   ImpliesExp: OrExp ('->' ImpliesExp)?
+ *
+ *   OrExp: AndExp ('||' AndExp)*
+ *
+ *   AndExp: UntilExp ('&&' UntilExp)*
+ *
+ *   UntilExp: UnaryExp (('U' | 'V') UnaryExp)*
+ *
+ *   UnaryExp: ('!' | '[]' | '<>' | 'X') UnaryExp | AtomExp
+ *
+ *   AtomExp: '(' Ltl ')' | TRUE | FALSE | NAME
+ *
+ *   TRUE: 'true'
+ *
+ *   FALSE: 'false'
+ *
+ *   NAME: ('a'..'z') ('a'..'z'|'A'..'Z'|'0'..'9'|'_')*
+ *
+ * As in ltl2ba, the temporal binary operators bind tighter than the boolean
+ * ones and are left associative. The parsed formula only uses the operators of
+ * LtlFormula: []f is parsed as false V f, <>f as true U f, f -> g as !f || g
+ * and f <-> g as (f && g) || (!f && !g).
+ *
+ * Whitespaces, tabs, newlines and carriage returns are ignored.
+ *
+ * @author mwi
+ */
+class LtlParser : private util::parser::AbstractParser {
+
+private:
+    /* The error message (if any). */
+    std::string errorMessage;
+
+    /*
+     * Representation Invariant:
+     *   I(c) = I(c.super)
+     */
+
+public:
+    /**
+     * @effects Makes this be a new parser for the LTL formula 'ltl'.
+     */
+    LtlParser(const std::string & ltl);
+
+    // The defaut destructor is fine.
+
+    /**
+     * @modifies this
+     * @effects Parses the LTL formula of this.
+     * @return the parsed LTL formula.
+     * @throws logic_error iff an error occurs during the parsing, i.e.,
+     *          the LTL formula was not valid.
+     */
+    LtlFormulaPtr parse();
+
+private:
+    /**
+     * @modifies this, exp
+     * @effects Applies the EquivExp production rule and sets 'exp' to the
+     *           parsed formula.
+     * @return true iff the production rule matches the upcoming symbols.
+     */
+    bool equivExp(LtlFormulaPtr & exp);
+
+    /**
+     * @modifies this, exp
+     * @effects Applies the ImpliesExp production rule and sets 'exp' to the
+     *           parsed formula.
+     * @return true iff the production rule matches the upcoming symbols.
+     */
+    bool impliesExp(LtlFormulaPtr & exp);
+
+    /**
+     * @modifies this, exp
+     * @effects Applies the OrExp production rule and sets 'exp' to the
+     *           parsed formula.
+     * @return true iff the production rule matches the upcoming symbols.
+     */
+    bool orExp(LtlFormulaPtr & exp);
+
+    /**
+     * @modifies this, exp
+     * @effects Applies the AndExp production rule and sets 'exp' to the
+     *           parsed formula.
+     * @return true iff the production rule matches the upcoming symbols.
+     */
+    bool andExp(LtlFormulaPtr & exp);
+
+    /**
+     * @modifies this, exp
+     * @effects Applies the UntilExp production rule and sets 'exp' to the
+     *           parsed formula.
+     * @return true iff the production rule matches the upcoming symbols.
+     */
+    bool untilExp(LtlFormulaPtr & exp);
+
+    /**
+     * @modifies this, exp
+     * @effects Applies the UnaryExp production rule and sets 'exp' to the
+     *           parsed formula.
+     * @return true iff the production rule matches the upcoming symbols.
+     */
+    bool unaryExp(LtlFormulaPtr & exp);
+
+    /**
+     * @modifies this, exp
+     * @effects Applies the AtomExp production rule and sets 'exp' to the
+     *           parsed formula.
+     * @return true iff the production rule matches the upcoming symbols.
+     */
+    bool atomExp(LtlFormulaPtr & exp);
+
+    /**
+     * @modifies this, exp
+     * @effects Applies the TRUE, FALSE and NAME terminal rules and sets 'exp'
+     *           to the parsed formula.
+     * @return true iff one of the terminal rules matches the upcoming
+     *          symbols.
+     */
+    bool name(LtlFormulaPtr & exp);
+
+    // overridden methods
+    void error();
+
+    /**
+     * @effects Asserts this satisfies the rep invariant.
+     */
+    void checkRep() const;
+
+};
+
+} // namespace neverclaim
+
+#endif /* NEVERCLAIM_LTLPARSER_HPP */
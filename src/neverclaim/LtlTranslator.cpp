@@ -0,0 +1,953 @@
+/*
+ * LtlTranslator.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "LtlTranslator.hpp"
+
+#include "ClaimTransition.hpp"
+#include "util/Assert.hpp"
+#include "util/parser/AndExp.hpp"
+#include "util/parser/BoolExp.hpp"
+#include "util/parser/BoolValue.hpp"
+#include "util/parser/NotExp.hpp"
+#include "util/parser/OrExp.hpp"
+#include "util/parser/Var.hpp"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+using std::abs;
+using std::binary_search;
+using std::make_pair;
+using std::map;
+using std::ostringstream;
+using std::pair;
+using std::string;
+using std::vector;
+using std::tr1::shared_ptr;
+
+using util::parser::AndExp;
+using util::parser::BoolExp;
+using util::parser::BoolValue;
+using util::parser::NotExp;
+using util::parser::OrExp;
+using util::parser::Var;
+
+namespace neverclaim {
+
+namespace {
+
+/**
+ * @return true iff the sorted vector 'set' contains 'element'.
+ */
+bool contains(const vector<int> & set, int element) {
+    return binary_search(set.begin(), set.end(), element);
+}
+
+/**
+ * @modifies set
+ * @effects Inserts 'element' in the sorted vector 'set', if not in it yet.
+ */
+void insert(vector<int> & set, int element) {
+    vector<int>::iterator it = std::lower_bound(set.begin(), set.end(),
+            element);
+    if (it == set.end() || *it != element) {
+        set.insert(it, element);
+    }
+}
+
+} // namespace
+
+const string LtlTranslator::FinalLabel("accept_all");
+
+// constructors
+LtlTranslator::LtlTranslator(const LtlFormulaPtr & formula)
+        : propositions(), propositionIds(), formulas(), formulaIds(),
+          labels(), edges(), claimTransitions() {
+    assertTrue(formula);
+
+    const int root = normalize(*formula, false);
+    vector<State> automaton = degeneralize(buildTableau(root), root);
+    vector<State>::iterator it;
+    for (it = automaton.begin(); it != automaton.end(); ++it) {
+        map<unsigned int, Guard>::iterator succ;
+        for (succ = it->successors.begin(); succ != it->successors.end();
+                ++succ) {
+            simplify(succ->second);
+        }
+    }
+    const unsigned int nbOfBuiltStates = automaton.size();
+
+    const vector<bool> universal = findUniversal(automaton);
+    if (universal[0]) {
+        makeUniversal();
+    } else {
+        automaton = collapse(automaton, universal);
+        const int final = automaton.size() - 1;
+        const vector<bool> useful = findUseful(automaton, final);
+        if (!useful[0]) {
+            makeEmpty();
+        } else {
+            automaton = restrict(automaton, useful);
+            minimize(automaton, useful[final] ? (int) automaton.size() - 1 : -1);
+        }
+    }
+    buildClaimTransitions();
+
+    DVLOG(1) << "Translated " << formula->toString() << " into "
+             << labels.size() << " states (" << nbOfBuiltStates
+             << " before reduction)";
+
+    checkRep();
+}
+
+// public methods
+unsigned int LtlTranslator::getNbOfStates() const {
+    return labels.size();
+}
+
+ClaimTransitionGeneratorPtr LtlTranslator::getTransitions() const {
+    return claimTransitions.elements();
+}
+
+string LtlTranslator::toPromela(const string & comment) const {
+    ostringstream oss;
+    oss << "never { /* " << comment << " */\n";
+    for (unsigned int i = 0; i < labels.size(); i++) {
+        oss << labels[i] << ":\n";
+        if (edges[i].empty()) {
+            oss << "\tskip\n";
+            continue;
+        }
+        oss << "\tif\n";
+        vector<pair<unsigned int, Guard> >::const_iterator it;
+        for (it = edges[i].begin(); it != edges[i].end(); ++it) {
+            oss << "\t:: " << toString(it->second) << " -> goto "
+                << labels[it->first] << "\n";
+        }
+        oss << "\tfi;\n";
+    }
+    oss << "}\n";
+    return oss.str();
+}
+
+// private methods
+int LtlTranslator::make(LtlFormula::Operator op, int left, int right) {
+    switch (op) {
+        case LtlFormula::And:
+            if (formulas[left].op == LtlFormula::False
+                    || formulas[right].op == LtlFormula::True
+                    || left == right) {
+                return left;
+            }
+            if (formulas[right].op == LtlFormula::False
+                    || formulas[left].op == LtlFormula::True) {
+                return right;
+            }
+            if (isLiteral(left) && isLiteral(right)
+                    && literalOf(left) == -literalOf(right)) {
+                return make(LtlFormula::False, -1, -1);
+            }
+            if (right < left) {
+                std::swap(left, right);
+            }
+            break;
+        case LtlFormula::Or:
+            if (formulas[left].op == LtlFormula::True
+                    || formulas[right].op == LtlFormula::False
+                    || left == right) {
+                return left;
+            }
+            if (formulas[right].op == LtlFormula::True
+                    || formulas[left].op == LtlFormula::False) {
+                return right;
+            }
+            if (isLiteral(left) && isLiteral(right)
+                    && literalOf(left) == -literalOf(right)) {
+                return make(LtlFormula::True, -1, -1);
+            }
+            if (right < left) {
+                std::swap(left, right);
+            }
+            break;
+        case LtlFormula::Next:
+            if (formulas[left].op == LtlFormula::True
+                    || formulas[left].op == LtlFormula::False) {
+                return left;
+            }
+            break;
+        case LtlFormula::Until:
+            // false U f = f U f = f, f U true = true, f U false = false
+            if (formulas[left].op == LtlFormula::False || left == right
+                    || formulas[right].op == LtlFormula::True
+                    || formulas[right].op == LtlFormula::False) {
+                return right;
+            }
+            break;
+        case LtlFormula::Release:
+            // true V f = f V f = f, f V true = true, f V false = false
+            if (formulas[left].op == LtlFormula::True || left == right
+                    || formulas[right].op == LtlFormula::True
+                    || formulas[right].op == LtlFormula::False) {
+                return right;
+            }
+            break;
+        default:
+            break;
+    }
+
+    pair<map<pair<int, pair<int, int> >, int>::iterator, bool> id =
+            formulaIds.insert(make_pair(make_pair((int) op,
+                    make_pair(left, right)), (int) formulas.size()));
+    if (id.second) {
+        formulas.push_back(Formula(op, left, right));
+    }
+    return id.first->second;
+}
+
+int LtlTranslator::normalize(const LtlFormula & formula, bool negated) {
+    switch (formula.getOperator()) {
+        case LtlFormula::True:
+        case LtlFormula::False:
+            return make((formula.getOperator() == LtlFormula::True)
+                    != negated ? LtlFormula::True : LtlFormula::False, -1, -1);
+        case LtlFormula::Proposition: {
+            pair<map<string, int>::iterator, bool> id = propositionIds.insert(
+                    make_pair(formula.getName(), (int) propositions.size()));
+            if (id.second) {
+                propositions.push_back(formula.getName());
+            }
+            return make(negated ? LtlFormula::Not : LtlFormula::Proposition,
+                    id.first->second, -1);
+        }
+        case LtlFormula::Not:
+            return normalize(*formula.getLeft(), !negated);
+        case LtlFormula::Next:
+            return make(LtlFormula::Next,
+                    normalize(*formula.getLeft(), negated), -1);
+        default:
+            break;
+    }
+
+    // Binary operators, whose dual is taken under a negation
+    const int left = normalize(*formula.getLeft(), negated);
+    const int right = normalize(*formula.getRight(), negated);
+    switch (formula.getOperator()) {
+        case LtlFormula::And:
+            return make(negated ? LtlFormula::Or : LtlFormula::And,
+                    left, right);
+        case LtlFormula::Or:
+            return make(negated ? LtlFormula::And : LtlFormula::Or,
+                    left, right);
+        case LtlFormula::Until:
+            return make(negated ? LtlFormula::Release : LtlFormula::Until,
+                    left, right);
+        default:
+            return make(negated ? LtlFormula::Until : LtlFormula::Release,
+                    left, right);
+    }
+}
+
+bool LtlTranslator::isLiteral(int id) const {
+    return formulas[id].op == LtlFormula::Proposition
+            || formulas[id].op == LtlFormula::Not;
+}
+
+int LtlTranslator::literalOf(int id) const {
+    assertTrue(isLiteral(id));
+
+    return formulas[id].op == LtlFormula::Proposition ?
+            formulas[id].left + 1 : -(formulas[id].left + 1);
+}
+
+vector<int> LtlTranslator::untilsOf(int root) const {
+    vector<int> untils;
+    vector<bool> visited(formulas.size(), false);
+    vector<int> pending(1, root);
+    visited[root] = true;
+    while (!pending.empty()) {
+        const Formula & formula = formulas[pending.back()];
+        if (formula.op == LtlFormula::Until) {
+            untils.push_back(pending.back());
+        }
+        pending.pop_back();
+        if (formula.op != LtlFormula::True && formula.op != LtlFormula::False
+                && formula.op != LtlFormula::Proposition
+                && formula.op != LtlFormula::Not) {
+            if (!visited[formula.left]) {
+                visited[formula.left] = true;
+                pending.push_back(formula.left);
+            }
+            if (formula.right >= 0 && !visited[formula.right]) {
+                visited[formula.right] = true;
+                pending.push_back(formula.right);
+            }
+        }
+    }
+    std::sort(untils.begin(), untils.end());
+    return untils;
+}
+
+vector<LtlTranslator::TableauNode> LtlTranslator::buildTableau(int root) {
+    typedef map<pair<vector<int>, vector<int> >, int> NodeTable;
+    NodeTable ids;
+    vector<TableauNode> nodes(1);
+    vector<TableauNode> pending(1);
+    pending.back().incoming.push_back(0);
+    pending.back().newFormulas.push_back(root);
+
+    while (!pending.empty()) {
+        TableauNode node = pending.back();
+        pending.pop_back();
+
+        if (node.newFormulas.empty()) {
+            // The node is fully expanded.
+            NodeTable::iterator it = ids.find(make_pair(node.oldFormulas,
+                    node.nextFormulas));
+            if (it != ids.end()) {
+                TableauNode & existing = nodes[it->second];
+                vector<int> incoming;
+                std::set_union(existing.incoming.begin(),
+                        existing.incoming.end(), node.incoming.begin(),
+                        node.incoming.end(), std::back_inserter(incoming));
+                existing.incoming.swap(incoming);
+            } else {
+                const int id = nodes.size();
+                ids.insert(make_pair(make_pair(node.oldFormulas,
+                        node.nextFormulas), id));
+                nodes.push_back(node);
+                TableauNode successor;
+                successor.incoming.push_back(id);
+                successor.newFormulas = node.nextFormulas;
+                pending.push_back(successor);
+            }
+            continue;
+        }
+
+        const int eta = node.newFormulas.back();
+        node.newFormulas.pop_back();
+        if (contains(node.oldFormulas, eta)) {
+            pending.push_back(node);
+            continue;
+        }
+
+        const Formula formula = formulas[eta];
+        TableauNode other;
+        switch (formula.op) {
+            case LtlFormula::False:
+                // The node is contradictory.
+                break;
+            case LtlFormula::True:
+                pending.push_back(node);
+                break;
+            case LtlFormula::Proposition:
+            case LtlFormula::Not:
+                if (!contains(node.oldFormulas, make(formula.op
+                        == LtlFormula::Proposition ? LtlFormula::Not
+                        : LtlFormula::Proposition, formula.left, -1))) {
+                    insert(node.oldFormulas, eta);
+                    pending.push_back(node);
+                }
+                break;
+            case LtlFormula::And:
+                insert(node.oldFormulas, eta);
+                node.newFormulas.push_back(formula.left);
+                node.newFormulas.push_back(formula.right);
+                pending.push_back(node);
+                break;
+            case LtlFormula::Next:
+                insert(node.oldFormulas, eta);
+                insert(node.nextFormulas, formula.left);
+                pending.push_back(node);
+                break;
+            case LtlFormula::Or:
+                insert(node.oldFormulas, eta);
+                other = node;
+                node.newFormulas.push_back(formula.left);
+                other.newFormulas.push_back(formula.right);
+                pending.push_back(other);
+                pending.push_back(node);
+                break;
+            case LtlFormula::Until:
+                // f U g = g || (f && X (f U g))
+                insert(node.oldFormulas, eta);
+                other = node;
+                node.newFormulas.push_back(formula.left);
+                insert(node.nextFormulas, eta);
+                other.newFormulas.push_back(formula.right);
+                pending.push_back(other);
+                pending.push_back(node);
+                break;
+            case LtlFormula::Release:
+                // f V g = (f && g) || (g && X (f V g))
+                insert(node.oldFormulas, eta);
+                other = node;
+                node.newFormulas.push_back(formula.right);
+                insert(node.nextFormulas, eta);
+                other.newFormulas.push_back(formula.left);
+                other.newFormulas.push_back(formula.right);
+                pending.push_back(other);
+                pending.push_back(node);
+                break;
+        }
+    }
+
+    DVLOG(2) << "Tableau: " << nodes.size() - 1 << " nodes";
+
+    return nodes;
+}
+
+vector<LtlTranslator::State> LtlTranslator::degeneralize(
+        const vector<TableauNode> & nodes, int root) const {
+    const vector<int> untils = untilsOf(root);
+    const unsigned int nbOfSets = untils.size();
+
+    /* The successors of each node, the label of its incoming transitions and
+     * the acceptance sets it belongs to. */
+    vector<vector<int> > successors(nodes.size());
+    vector<Cube> cubes(nodes.size());
+    vector<vector<bool> > inSet(nodes.size());
+    for (unsigned int n = 1; n < nodes.size(); n++) {
+        const TableauNode & node = nodes[n];
+        vector<int>::const_iterator it;
+        for (it = node.incoming.begin(); it != node.incoming.end(); ++it) {
+            successors[*it].push_back(n);
+        }
+        for (it = node.oldFormulas.begin(); it != node.oldFormulas.end();
+                ++it) {
+            if (isLiteral(*it)) {
+                cubes[n].push_back(literalOf(*it));
+            }
+        }
+        std::sort(cubes[n].begin(), cubes[n].end(), literalLess);
+        for (unsigned int j = 0; j < nbOfSets; j++) {
+            inSet[n].push_back(!contains(node.oldFormulas, untils[j])
+                    || contains(node.oldFormulas, formulas[untils[j]].right));
+        }
+    }
+
+    /* The states are pairs (node, counter), the counter being the number of
+     * acceptance sets visited in a row; a state is accepting iff all the sets
+     * have been visited. */
+    typedef map<pair<int, unsigned int>, unsigned int> StateTable;
+    StateTable ids;
+    vector<pair<int, unsigned int> > states;
+    vector<State> automaton;
+    ids.insert(make_pair(make_pair(0, 0u), 0u));
+    states.push_back(make_pair(0, 0u));
+    automaton.push_back(State(nbOfSets == 0));
+
+    for (unsigned int s = 0; s < states.size(); s++) {
+        const int node = states[s].first;
+        const unsigned int start = states[s].second == nbOfSets ?
+                0 : states[s].second;
+        vector<int>::const_iterator it;
+        for (it = successors[node].begin(); it != successors[node].end();
+                ++it) {
+            unsigned int counter = start;
+            while (counter < nbOfSets && inSet[*it][counter]) {
+                counter++;
+            }
+            pair<StateTable::iterator, bool> id = ids.insert(make_pair(
+                    make_pair(*it, counter), (unsigned int) states.size()));
+            if (id.second) {
+                states.push_back(make_pair(*it, counter));
+                automaton.push_back(State(counter == nbOfSets));
+            }
+            automaton[s].successors[id.first->second].insert(cubes[*it]);
+        }
+    }
+
+    return automaton;
+}
+
+vector<bool> LtlTranslator::findUniversal(const vector<State> & automaton) {
+    const unsigned int nbOfStates = automaton.size();
+    vector<bool> universal(nbOfStates, false);
+    for (unsigned int q = 0; q < nbOfStates; q++) {
+        universal[q] = automaton[q].accepting;
+    }
+
+    /* The greatest set of accepting states from which every letter leads to
+     * the set, then extended with the states from which every letter leads
+     * to the set. */
+    for (int pass = 0; pass < 2; pass++) {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (unsigned int q = 0; q < nbOfStates; q++) {
+                if (universal[q] != (pass == 0)) {
+                    continue;
+                }
+                Guard guard;
+                map<unsigned int, Guard>::const_iterator it;
+                for (it = automaton[q].successors.begin();
+                        it != automaton[q].successors.end(); ++it) {
+                    if (universal[it->first]) {
+                        guard.insert(it->second.begin(), it->second.end());
+                    }
+                }
+                if (isValid(guard) != universal[q]) {
+                    universal[q] = !universal[q];
+                    changed = true;
+                }
+            }
+        }
+    }
+    return universal;
+}
+
+vector<LtlTranslator::State> LtlTranslator::collapse(
+        const vector<State> & automaton, const vector<bool> & universal) {
+    vector<int> index(automaton.size(), -1);
+    vector<State> collapsed;
+    for (unsigned int q = 0; q < automaton.size(); q++) {
+        if (!universal[q]) {
+            index[q] = collapsed.size();
+            collapsed.push_back(State(automaton[q].accepting));
+        }
+    }
+    const unsigned int final = collapsed.size();
+    collapsed.push_back(State(true));
+
+    for (unsigned int q = 0; q < automaton.size(); q++) {
+        if (universal[q]) {
+            continue;
+        }
+        State & state = collapsed[index[q]];
+        map<unsigned int, Guard>::const_iterator it;
+        for (it = automaton[q].successors.begin();
+                it != automaton[q].successors.end(); ++it) {
+            Guard & guard = state.successors[universal[it->first] ?
+                    final : index[it->first]];
+            guard.insert(it->second.begin(), it->second.end());
+        }
+        if (state.successors.count(final) > 0) {
+            simplify(state.successors[final]);
+        }
+    }
+    return collapsed;
+}
+
+vector<bool> LtlTranslator::findUseful(const vector<State> & automaton,
+        int final) {
+    typedef map<unsigned int, Guard>::const_iterator Iterator;
+    const unsigned int nbOfStates = automaton.size();
+
+    // Post order of a depth first search
+    vector<unsigned int> postOrder;
+    vector<bool> visited(nbOfStates, false);
+    vector<pair<unsigned int, Iterator> > stack;
+    for (unsigned int s = 0; s < nbOfStates; s++) {
+        if (visited[s]) {
+            continue;
+        }
+        visited[s] = true;
+        stack.push_back(make_pair(s, automaton[s].successors.begin()));
+        while (!stack.empty()) {
+            const unsigned int q = stack.back().first;
+            if (stack.back().second == automaton[q].successors.end()) {
+                postOrder.push_back(q);
+                stack.pop_back();
+                continue;
+            }
+            const unsigned int target = (stack.back().second++)->first;
+            if (!visited[target]) {
+                visited[target] = true;
+                stack.push_back(make_pair(target,
+                        automaton[target].successors.begin()));
+            }
+        }
+    }
+
+    vector<vector<unsigned int> > predecessors(nbOfStates);
+    for (unsigned int q = 0; q < nbOfStates; q++) {
+        Iterator it;
+        for (it = automaton[q].successors.begin();
+                it != automaton[q].successors.end(); ++it) {
+            predecessors[it->first].push_back(q);
+        }
+    }
+
+    // Strongly connected components, on the reverse automaton (Kosaraju)
+    vector<int> components(nbOfStates, -1);
+    vector<unsigned int> sizes;
+    vector<unsigned int> pending;
+    vector<unsigned int>::const_reverse_iterator r;
+    for (r = postOrder.rbegin(); r != postOrder.rend(); ++r) {
+        if (components[*r] >= 0) {
+            continue;
+        }
+        const int component = sizes.size();
+        sizes.push_back(0);
+        components[*r] = component;
+        pending.push_back(*r);
+        while (!pending.empty()) {
+            const unsigned int q = pending.back();
+            pending.pop_back();
+            sizes[component]++;
+            vector<unsigned int>::const_iterator p;
+            for (p = predecessors[q].begin(); p != predecessors[q].end();
+                    ++p) {
+                if (components[*p] < 0) {
+                    components[*p] = component;
+                    pending.push_back(*p);
+                }
+            }
+        }
+    }
+
+    // The states reaching the final state or an accepting cycle
+    vector<bool> useful(nbOfStates, false);
+    for (unsigned int q = 0; q < nbOfStates; q++) {
+        if ((int) q == final || (automaton[q].accepting
+                && (sizes[components[q]] > 1
+                        || automaton[q].successors.count(q) > 0))) {
+            useful[q] = true;
+            pending.push_back(q);
+        }
+    }
+    while (!pending.empty()) {
+        const unsigned int q = pending.back();
+        pending.pop_back();
+        vector<unsigned int>::const_iterator p;
+        for (p = predecessors[q].begin(); p != predecessors[q].end(); ++p) {
+            if (!useful[*p]) {
+                useful[*p] = true;
+                pending.push_back(*p);
+            }
+        }
+    }
+    return useful;
+}
+
+vector<LtlTranslator::State> LtlTranslator::restrict(
+        const vector<State> & automaton, const vector<bool> & kept) {
+    vector<int> index(automaton.size(), -1);
+    vector<State> restricted;
+    for (unsigned int q = 0; q < automaton.size(); q++) {
+        if (kept[q]) {
+            index[q] = restricted.size();
+            restricted.push_back(State(automaton[q].accepting));
+        }
+    }
+    for (unsigned int q = 0; q < automaton.size(); q++) {
+        if (!kept[q]) {
+            continue;
+        }
+        map<unsigned int, Guard>::const_iterator it;
+        for (it = automaton[q].successors.begin();
+                it != automaton[q].successors.end(); ++it) {
+            if (kept[it->first]) {
+                restricted[index[q]].successors[index[it->first]] =
+                        it->second;
+            }
+        }
+    }
+    return restricted;
+}
+
+map<unsigned int, LtlTranslator::Guard> LtlTranslator::signatureOf(
+        const State & state, const vector<unsigned int> & blocks) {
+    map<unsigned int, Guard> signature;
+    map<unsigned int, Guard>::const_iterator it;
+    for (it = state.successors.begin(); it != state.successors.end(); ++it) {
+        signature[blocks[it->first]].insert(it->second.begin(),
+                it->second.end());
+    }
+    map<unsigned int, Guard>::iterator sig;
+    for (sig = signature.begin(); sig != signature.end(); ++sig) {
+        simplify(sig->second);
+    }
+    return signature;
+}
+
+void LtlTranslator::minimize(const vector<State> & automaton, int final) {
+    typedef pair<unsigned int, map<unsigned int, Guard> > Signature;
+    const unsigned int nbOfStates = automaton.size();
+
+    /* The initial partition separates the initial state, the final state,
+     * and the accepting and non accepting states. It is then refined until
+     * the states of a block have the same successor blocks, with the same
+     * guards. */
+    vector<unsigned int> blocks(nbOfStates);
+    for (unsigned int q = 0; q < nbOfStates; q++) {
+        blocks[q] = q == 0 ? 0 : ((int) q == final ? 1
+                : (automaton[q].accepting ? 2 : 3));
+    }
+    unsigned int nbOfBlocks = 0;
+    while (true) {
+        map<Signature, unsigned int> ids;
+        vector<unsigned int> refined(nbOfStates);
+        for (unsigned int q = 0; q < nbOfStates; q++) {
+            const Signature signature(blocks[q],
+                    signatureOf(automaton[q], blocks));
+            refined[q] = ids.insert(make_pair(signature,
+                    (unsigned int) ids.size())).first->second;
+        }
+        blocks.swap(refined);
+        if (ids.size() == nbOfBlocks) {
+            break;
+        }
+        nbOfBlocks = ids.size();
+    }
+
+    /* The initial state, which has no incoming transition, is merged with
+     * a block with the same transitions, whatever its acceptance. */
+    vector<int> representatives(nbOfBlocks, -1);
+    for (unsigned int q = 1; q < nbOfStates; q++) {
+        if (representatives[blocks[q]] < 0) {
+            representatives[blocks[q]] = q;
+        }
+    }
+    const map<unsigned int, Guard> initial = signatureOf(automaton[0], blocks);
+    for (unsigned int b = 0; b < nbOfBlocks; b++) {
+        if (representatives[b] >= 0 && representatives[b] != final
+                && signatureOf(automaton[representatives[b]], blocks)
+                        == initial) {
+            blocks[0] = b;
+            break;
+        }
+    }
+    if (representatives[blocks[0]] < 0) {
+        representatives[blocks[0]] = 0;
+    }
+
+    // The blocks are numbered in breadth-first order, the final one last.
+    const int finalBlock = final >= 0 ? (int) blocks[final] : -1;
+    vector<int> numbers(nbOfBlocks, -1);
+    vector<unsigned int> order(1, blocks[0]);
+    numbers[blocks[0]] = 0;
+    bool finalReached = false;
+    vector<map<unsigned int, Guard> > signatures;
+    for (unsigned int i = 0; i < order.size(); i++) {
+        signatures.push_back(signatureOf(
+                automaton[representatives[order[i]]], blocks));
+        map<unsigned int, Guard>::const_iterator it;
+        for (it = signatures.back().begin(); it != signatures.back().end();
+                ++it) {
+            if ((int) it->first == finalBlock) {
+                finalReached = true;
+            } else if (numbers[it->first] < 0) {
+                numbers[it->first] = order.size();
+                order.push_back(it->first);
+            }
+        }
+    }
+    if (finalReached) {
+        numbers[finalBlock] = order.size();
+        order.push_back(finalBlock);
+        signatures.push_back(map<unsigned int, Guard>());
+    }
+
+    labels.clear();
+    edges.assign(order.size(), vector<pair<unsigned int, Guard> >());
+    for (unsigned int i = 0; i < order.size(); i++) {
+        const bool accepting =
+                automaton[representatives[order[i]]].accepting;
+        ostringstream label;
+        if ((int) order[i] == finalBlock) {
+            label << FinalLabel;
+        } else if (i == 0) {
+            label << (accepting ? "accept_init" : "T0_init");
+        } else {
+            label << (accepting ? "accept_S" : "T0_S") << i;
+        }
+        labels.push_back(label.str());
+
+        map<unsigned int, Guard>::const_iterator it;
+        for (it = signatures[i].begin(); it != signatures[i].end(); ++it) {
+            edges[i].push_back(make_pair((unsigned int) numbers[it->first],
+                    it->second));
+        }
+        std::sort(edges[i].begin(), edges[i].end());
+    }
+}
+
+void LtlTranslator::makeEmpty() {
+    labels.assign(1, "T0_init");
+    edges.assign(1, vector<pair<unsigned int, Guard> >(1,
+            make_pair(0u, Guard())));
+}
+
+void LtlTranslator::makeUniversal() {
+    labels.clear();
+    labels.push_back("T0_init");
+    labels.push_back(FinalLabel);
+    edges.assign(2, vector<pair<unsigned int, Guard> >());
+    Guard guard;
+    guard.insert(Cube());
+    edges[0].push_back(make_pair(1u, guard));
+}
+
+void LtlTranslator::buildClaimTransitions() {
+    for (unsigned int i = 0; i < labels.size(); i++) {
+        vector<pair<unsigned int, Guard> >::const_iterator it;
+        for (it = edges[i].begin(); it != edges[i].end(); ++it) {
+            claimTransitions.addLast(ClaimTransitionPtr(new ClaimTransition(
+                    labels[i], labels[it->first], toBoolExp(it->second))));
+        }
+    }
+}
+
+string LtlTranslator::toString(const Guard & guard) const {
+    if (guard.empty()) {
+        return "(0)";
+    }
+    ostringstream oss;
+    Guard::const_iterator cube;
+    for (cube = guard.begin(); cube != guard.end(); ++cube) {
+        if (cube != guard.begin()) {
+            oss << " || ";
+        }
+        if (cube->empty()) {
+            oss << "(1)";
+            continue;
+        }
+        oss << "(";
+        Cube::const_iterator it;
+        for (it = cube->begin(); it != cube->end(); ++it) {
+            if (it != cube->begin()) {
+                oss << " && ";
+            }
+            oss << (*it < 0 ? "!" : "") << propositions[abs(*it) - 1];
+        }
+        oss << ")";
+    }
+    return oss.str();
+}
+
+shared_ptr<BoolExp> LtlTranslator::toBoolExp(const Guard & guard) const {
+    shared_ptr<BoolExp> exp;
+    Guard::const_iterator cube;
+    for (cube = guard.begin(); cube != guard.end(); ++cube) {
+        shared_ptr<BoolExp> conjunction;
+        Cube::const_iterator it;
+        for (it = cube->begin(); it != cube->end(); ++it) {
+            shared_ptr<BoolExp> literal(new Var(propositions[abs(*it) - 1]));
+            if (*it < 0) {
+                literal = shared_ptr<BoolExp>(new NotExp(literal));
+            }
+            conjunction = conjunction ? shared_ptr<BoolExp>(
+                    new AndExp(conjunction, literal)) : literal;
+        }
+        if (!conjunction) {
+            conjunction = shared_ptr<BoolExp>(new BoolValue(true));
+        }
+        exp = exp ? shared_ptr<BoolExp>(new OrExp(exp, conjunction))
+                : conjunction;
+    }
+    if (!exp) {
+        exp = shared_ptr<BoolExp>(new BoolValue(false));
+    }
+    return exp;
+}
+
+void LtlTranslator::simplify(Guard & guard) {
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        // Removes the cubes implied by another one
+        Guard simplified;
+        Guard::const_iterator c;
+        Guard::const_iterator d;
+        for (c = guard.begin(); c != guard.end(); ++c) {
+            bool implied = false;
+            for (d = guard.begin(); d != guard.end() && !implied; ++d) {
+                implied = d != c && std::includes(c->begin(), c->end(),
+                        d->begin(), d->end(), literalLess);
+            }
+            if (!implied) {
+                simplified.insert(*c);
+            }
+        }
+
+        // Merges two cubes that only differ by the sign of one literal
+        Cube cube;
+        Cube complement;
+        unsigned int position = 0;
+        for (c = simplified.begin(); c != simplified.end() && !changed; ++c) {
+            for (unsigned int i = 0; i < c->size() && !changed; i++) {
+                complement = *c;
+                complement[i] = -complement[i];
+                if (simplified.count(complement) > 0) {
+                    cube = *c;
+                    position = i;
+                    changed = true;
+                }
+            }
+        }
+        if (changed) {
+            simplified.erase(cube);
+            simplified.erase(complement);
+            cube.erase(cube.begin() + position);
+            simplified.insert(cube);
+        }
+        guard.swap(simplified);
+    }
+}
+
+bool LtlTranslator::isValid(const Guard & guard) {
+    if (guard.empty()) {
+        return false;
+    }
+    // The empty cube, if any, is the smallest one.
+    if (guard.begin()->empty()) {
+        return true;
+    }
+
+    // Shannon expansion on the first proposition of the first cube
+    const int proposition = abs(guard.begin()->front());
+    Guard positive;
+    Guard negative;
+    Guard::const_iterator cube;
+    for (cube = guard.begin(); cube != guard.end(); ++cube) {
+        Cube rest;
+        int sign = 0;
+        Cube::const_iterator it;
+        for (it = cube->begin(); it != cube->end(); ++it) {
+            if (abs(*it) == proposition) {
+                sign = *it;
+            } else {
+                rest.push_back(*it);
+            }
+        }
+        if (sign >= 0) {
+            positive.insert(rest);
+        }
+        if (sign <= 0) {
+            negative.insert(rest);
+        }
+    }
+    return isValid(positive) && isValid(negative);
+}
+
+bool LtlTranslator::literalLess(int a, int b) {
+    return abs(a) < abs(b) || (abs(a) == abs(b) && a < b);
+}
+
+void LtlTranslator::checkRep() const {
+    if (doCheckRep) {
+        assertTrue(labels.size() > 0);
+        assertTrue(labels.size() == edges.size());
+        assertTrue(labels[0] == "T0_init" || labels[0] == "accept_init");
+        assertTrue(edges[0].size() > 0);
+        unsigned int nbOfEdges = 0;
+        for (unsigned int j = 0; j < edges.size(); j++) {
+            vector<pair<unsigned int, Guard> >::const_iterator it;
+            for (it = edges[j].begin(); it != edges[j].end(); ++it) {
+                assertTrue(it->first < labels.size());
+            }
+            nbOfEdges += edges[j].size();
+        }
+        assertTrue((unsigned int) claimTransitions.count() == nbOfEdges);
+    }
+}
+
+} // namespace neverclaim
@@ -0,0 +1,297 @@
+/*
+ * LtlTranslator.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef NEVERCLAIM_LTLTRANSLATOR_HPP
+#define NEVERCLAIM_LTLTRANSLATOR_HPP
+
+#include "forwards.hpp"
+#include "LtlFormula.hpp"
+#include "util/List.hpp"
+#include "util/Uncopyable.hpp"
+#include "util/parser/forwards.hpp"
+
+#include <map>
+#include <set>
+#include <string>
+#include <tr1/memory>
+#include <utility>
+#include <vector>
+
+namespace neverclaim {
+
+/**
+ * An LtlTranslator translates an LTL formula into a Büchi automaton that
+ * accepts exactly the words satisfying the formula, in the form of the
+ * transitions of a never claim. The translation is done in process and
+ * replaces the ltl2ba executable.
+ *
+ * The translation goes as follows:
+ *   1. the formula is put in negation normal form, its subformulas being
+ *      shared and simplified;
+ *   2. a generalized Büchi automaton is built with the tableau construction
+ *      of Gerth, Peled, Vardi and Wolper, with one acceptance set per until
+ *      subformula;
+ *   3. the automaton is degeneralized with a counter that can skip several
+ *      acceptance sets on a single transition;
+ *   4. the accepting states from which every word is accepted are merged into
+ *      the final state accept_all, the states from which no word is accepted
+ *      are removed, and bisimilar states are merged.
+ *
+ * The guards of the transitions are disjunctions of conjunctions of possibly
+ * negated propositions. The initial state is labelled T0_init (or
+ * accept_init), the other states T0_S<n> or accept_S<n>, and the final state
+ * accept_all, as with ltl2ba.
+ *
+ * Specification Fields:
+ *   - states : seq(string)    // The labels of the states, the first one
+ *                             // being the initial state.
+ *   - transitions : seq(ClaimTransition)   // The transitions, ordered by
+ *                                          // source state.
+ *
+ * @author mwi
+ */
+class LtlTranslator : private util::Uncopyable {
+
+private:
+    /** A literal is the index of a proposition plus one, negative iff the
+     *  proposition is negated. A cube is a conjunction of literals, sorted by
+     *  proposition. */
+    typedef std::vector<int> Cube;
+
+    /** A guard is a disjunction of cubes. */
+    typedef std::set<Cube> Guard;
+
+    /** Structure for the subformulas in negation normal form */
+    struct Formula {
+        LtlFormula::Operator op;
+        /** The first operand, or the index of the proposition of a literal */
+        int left;
+        /** The second operand, or -1 */
+        int right;
+        Formula(LtlFormula::Operator op, int left, int right)
+            : op(op), left(left), right(right) {}
+    };
+
+    /** Structure for the nodes of the tableau */
+    struct TableauNode {
+        /** The nodes with a transition to this one, 0 being the initial one */
+        std::vector<int> incoming;
+        /** The formulas still to process */
+        std::vector<int> newFormulas;
+        /** The processed formulas, sorted */
+        std::vector<int> oldFormulas;
+        /** The formulas to satisfy in the next node, sorted */
+        std::vector<int> nextFormulas;
+    };
+
+    /** Structure for the states of the intermediate automata */
+    struct State {
+        bool accepting;
+        std::map<unsigned int, Guard> successors;
+        State(bool accepting) : accepting(accepting), successors() {}
+    };
+
+    /** The label of the final state */
+    static const std::string FinalLabel;
+
+    /* The names of the propositions, by index. */
+    std::vector<std::string> propositions;
+    /* The index of each proposition. */
+    std::map<std::string, int> propositionIds;
+    /* The subformulas in negation normal form, by index. */
+    std::vector<Formula> formulas;
+    /* The index of each subformula. */
+    std::map<std::pair<int, std::pair<int, int> >, int> formulaIds;
+
+    /* The labels of the states of the never claim. */
+    std::vector<std::string> labels;
+    /* The outgoing transitions of each state of the never claim, ordered by
+     * target state. */
+    std::vector<std::vector<std::pair<unsigned int, Guard> > > edges;
+    /* The transitions of the never claim. */
+    util::List<ClaimTransitionPtr> claimTransitions;
+
+    /*
+     * Representation Invariant:
+     *   I(c) = c.labels.size > 0 && c.labels.size = c.edges.size
+     *     c.labels[0] in {"T0_init", "accept_init"}
+     *     c.edges[0].size > 0
+     *     forall i, (i, g) in c.edges[j]: i < c.labels.size
+     *     c.claimTransitions.size = sum_j c.edges[j].size
+     */
+
+public:
+    /**
+     * @requires formula != null
+     * @effects Makes this be the translation of the LTL formula 'formula'
+     *           into a never claim.
+     */
+    LtlTranslator(const LtlFormulaPtr & formula);
+
+    // The default destructor is fine.
+
+    /**
+     * @return the number of states of this.
+     */
+    unsigned int getNbOfStates() const;
+
+    /**
+     * @return a generator that will produce all the transitions of this, in
+     *          order. The source of the first transition is the initial
+     *          state. The generator must not outlive this.
+     */
+    ClaimTransitionGeneratorPtr getTransitions() const;
+
+    /**
+     * @requires comment does not contain "*" followed by "/"
+     * @return the never claim of this written in promela, with the comment
+     *          'comment', in the format produced by ltl2ba.
+     */
+    std::string toPromela(const std::string & comment) const;
+
+private:
+    /**
+     * @modifies this
+     * @return the index of the subformula with the operator 'op' and the
+     *          operands 'left' and 'right', simplified and shared.
+     */
+    int make(LtlFormula::Operator op, int left, int right);
+
+    /**
+     * @modifies this
+     * @return the index of the negation normal form of 'formula', or of its
+     *          negation if 'negated' is true.
+     */
+    int normalize(const LtlFormula & formula, bool negated);
+
+    /**
+     * @return true iff the subformula 'id' is a literal.
+     */
+    bool isLiteral(int id) const;
+
+    /**
+     * @requires isLiteral(id)
+     * @return the literal of the subformula 'id'.
+     */
+    int literalOf(int id) const;
+
+    /**
+     * @return the indexes of the until subformulas of 'root', in increasing
+     *          order.
+     */
+    std::vector<int> untilsOf(int root) const;
+
+    /**
+     * @return the nodes of the tableau of 'root', the first one being the
+     *          initial pseudo node.
+     */
+    std::vector<TableauNode> buildTableau(int root);
+
+    /**
+     * @return the degeneralized Büchi automaton of the tableau 'nodes' of
+     *          'root', whose first state is the initial state.
+     */
+    std::vector<State> degeneralize(const std::vector<TableauNode> & nodes,
+        int root) const;
+
+    /**
+     * @return the states of 'automaton' from which every word is accepted.
+     */
+    static std::vector<bool> findUniversal(
+        const std::vector<State> & automaton);
+
+    /**
+     * @return 'automaton' where the states 'universal' are replaced by a
+     *          final state without successor, added last.
+     */
+    static std::vector<State> collapse(const std::vector<State> & automaton,
+        const std::vector<bool> & universal);
+
+    /**
+     * @return the states of 'automaton' from which an accepting cycle or the
+     *          final state 'final' is reachable.
+     */
+    static std::vector<bool> findUseful(const std::vector<State> & automaton,
+        int final);
+
+    /**
+     * @return 'automaton' restricted to the states 'kept', in the same order.
+     */
+    static std::vector<State> restrict(const std::vector<State> & automaton,
+        const std::vector<bool> & kept);
+
+    /**
+     * @return the guards of the transitions of 'state', grouped by the block
+     *          'blocks' of their target.
+     */
+    static std::map<unsigned int, Guard> signatureOf(const State & state,
+        const std::vector<unsigned int> & blocks);
+
+    /**
+     * @requires the first state of 'automaton' has no incoming transition
+     * @modifies this
+     * @effects Makes this be the quotient of 'automaton' by bisimulation,
+     *           where 'final' is the final state or -1.
+     */
+    void minimize(const std::vector<State> & automaton, int final);
+
+    /**
+     * @modifies this
+     * @effects Makes this be the never claim accepting no word.
+     */
+    void makeEmpty();
+
+    /**
+     * @modifies this
+     * @effects Makes this be the never claim accepting every word.
+     */
+    void makeUniversal();
+
+    /**
+     * @modifies this
+     * @effects Fills the claim transitions of this from its edges.
+     */
+    void buildClaimTransitions();
+
+    /**
+     * @return the promela representation of 'guard'.
+     */
+    std::string toString(const Guard & guard) const;
+
+    /**
+     * @return a boolean expression equivalent to 'guard'.
+     */
+    std::tr1::shared_ptr<util::parser::BoolExp> toBoolExp(
+        const Guard & guard) const;
+
+    /**
+     * @modifies guard
+     * @effects Removes the cubes of 'guard' that are implied by another one,
+     *           and merges the cubes that only differ by the sign of one
+     *           literal, until no more change is possible.
+     */
+    static void simplify(Guard & guard);
+
+    /**
+     * @return true iff 'guard' is true whatever the values of the
+     *          propositions.
+     */
+    static bool isValid(const Guard & guard);
+
+    /**
+     * @return true iff literal 'a' is ordered before literal 'b' in cubes.
+     */
+    static bool literalLess(int a, int b);
+
+    /**
+     * @effects Asserts the rep invariant holds for this.
+     */
+    void checkRep() const;
+};
+
+} // namespace neverclaim
+
+#endif /* NEVERCLAIM_LTLTRANSLATOR_HPP */
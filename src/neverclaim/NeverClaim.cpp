@@ -8,18 +8,15 @@
 
 #include "ClaimState.hpp"
 #include "ClaimTransition.hpp"
-#include "NeverClaimParser.hpp"
-#include "ltl2ba.hpp"
+#include "LtlFormula.hpp"
+#include "LtlParser.hpp"
+#include "LtlTranslator.hpp"
 
 #include "util/Assert.hpp"
-#include "util/strings.hpp"
 
 #include <glog/logging.h>
 
-#include <fstream>
-
 using std::auto_ptr;
-using std::ifstream;
 using std::string;
 using std::tr1::shared_ptr;
 
@@ -27,8 +24,6 @@ using util::Generator;
 
 namespace neverclaim {
 
-const string NeverClaim::NeverClaimFilePath("/tmp/pvl_ltl2ba.tmp");
-
 // constructors
 NeverClaim::NeverClaim(const auto_ptr<Generator<ClaimTransitionPtr> > &
         transGen) : transitionTable(), initialState() {
@@ -59,15 +54,11 @@ auto_ptr<Generator<ClaimTransitionPtr > > NeverClaim::executables(const
 
 // static factory methods
 shared_ptr<NeverClaim> NeverClaim::create(const string & ltl) {
-    ltl2ba(ltl, NeverClaimFilePath);
-    ifstream inputFileStream(NeverClaimFilePath.c_str());
-    assertTrue(inputFileStream.is_open());
-
-    string strNeverClaim = util::toString(inputFileStream);
+    LtlTranslator translator(LtlFormula::makeNot(LtlParser(ltl).parse()));
 
-    DVLOG(2) << strNeverClaim;
+    DVLOG(2) << translator.toPromela("!(" + ltl + ")");
 
-    return NeverClaimParser(strNeverClaim).parse();
+    return shared_ptr<NeverClaim>(new NeverClaim(translator.getTransitions()));
 }
 
 // private methods
@@ -27,9 +27,6 @@ namespace neverclaim {
 class NeverClaim : private util::Uncopyable {
 
 private:
-    /* Temp file path to use with ltl2ba */
-    static const std::string NeverClaimFilePath;
-
     util::StdHashTable<ClaimState, ClaimTransitionPtr> transitionTable;
     std::tr1::shared_ptr<ClaimState> initialState;
 
@@ -64,7 +61,9 @@ public:
     /**
      * @requires ltl is a valid LTL formula using Spin syntax
      * @return a new never claim automaton that allows the verification of the
-     *          the LTL property 'ltl'.
+     *          the LTL property 'ltl', translated in process by an
+     *          LtlTranslator.
+     * @throws logic_error iff ltl is not a valid LTL formula.
      */
     static std::tr1::shared_ptr<NeverClaim> create(const std::string & ltl);
 
@@ -17,11 +17,13 @@ namespace neverclaim {
 // Forward declarations
 class ClaimState;
 class ClaimTransition;
+class LtlFormula;
 class NeverClaim;
 
 // Smart pointer typedefs
 typedef std::tr1::shared_ptr<ClaimState> ClaimStatePtr;
 typedef std::tr1::shared_ptr<ClaimTransition> ClaimTransitionPtr;
+typedef std::tr1::shared_ptr<LtlFormula> LtlFormulaPtr;
 typedef std::tr1::shared_ptr<NeverClaim> NeverClaimPtr;
 
 // Generator typedefs
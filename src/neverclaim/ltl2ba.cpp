@@ -6,24 +6,37 @@
 
 #include "ltl2ba.hpp"
 
+#include "LtlFormula.hpp"
+#include "LtlParser.hpp"
+#include "LtlTranslator.hpp"
+
 #include "util/Assert.hpp"
 
-#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
 
+using std::logic_error;
+using std::ofstream;
 using std::string;
 
 namespace neverclaim {
 
 bool ltl2ba(const string & ltlProperty, const string & filePath) {
+    ofstream outputFileStream(filePath.c_str());
+    assertTrue(outputFileStream.is_open());
 
-    string command("ltl2ba -f \"!(");
-    command.append(ltlProperty);
-    command.append(")\" > ");
-    command.append(filePath);
+    LtlFormulaPtr property;
+    try {
+        property = LtlParser(ltlProperty).parse();
+    } catch (const logic_error & e) {
+        outputFileStream << "ltl2ba: " << e.what() << "\n";
+        return false;
+    }
 
-    int result = system(command.c_str());
+    LtlTranslator translator(LtlFormula::makeNot(property));
+    outputFileStream << translator.toPromela("!(" + ltlProperty + ")");
 
-    return result == 0;
+    return true;
 }
 
 } // namespace neverclaim
@@ -14,8 +14,11 @@ namespace neverclaim {
 /**
  * @requires filePath is a valid path to a file
  * @modifies the file at 'filePath'
- * @effects Converts the LTL property 'ltlProperty' into a Büchi automaton
- *           written in the file at 'filePath' in the form of a never claim.
+ * @effects Converts the negation of the LTL property 'ltlProperty' into a
+ *           Büchi automaton written in the file at 'filePath' in the form of
+ *           a never claim, as the ltl2ba tool does. The translation is done
+ *           in process by an LtlTranslator. If 'ltlProperty' is not valid,
+ *           writes the syntax error in the file instead.
  * @return true iff ltlProperty is a valid LTL property
  */
 bool ltl2ba(const std::string & ltlProperty, const std::string & filePath);
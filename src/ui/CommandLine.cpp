@@ -13,6 +13,8 @@
 #include <sstream>
 
 using config::Messages;
+using math::CuddOptions;
+using std::istringstream;
 using std::endl;
 using std::string;
 using std::ostringstream;
@@ -20,21 +22,59 @@ using util::NotPossibleException;
 
 namespace ui {
 
+namespace {
+
+/**
+ * @modifies value
+ * @effects Makes 'value' be the value of type T of the string 'str', if any.
+ * @return true iff 'str' is a valid value of type T.
+ */
+template <typename T>
+bool parseValue(const string & str, T & value) {
+    istringstream iss(str);
+    return str.length() > 0 && str[0] != '-' && (iss >> value) && iss.eof();
+}
+
+} // namespace
+
 // constructors
 CommandLine::CommandLine(int argc, const char * argv[])
-        : verbose(false), inputPath() {
-    if (argc < 2 || argc > 3) {
-        throw NotPossibleException(Messages::wrongNumberOfArgs());
-    }
+        : verbose(false), productGraph(false), compile(false), inputPath(),
+          outputPath(), cuddOptions() {
+    if (argc >= 2 && string(argv[1]) == "compile") {
+        if (argc != 4) {
+            throw NotPossibleException(Messages::wrongNumberOfArgs());
+        }
+        inputPath = string(argv[2]);
+        outputPath = string(argv[3]);
+        if (inputPath.empty() || outputPath.empty()) {
+            throw NotPossibleException(Messages::emptyFilePath());
+        }
+        compile = true;
+    } else {
+        if (argc < 2) {
+            throw NotPossibleException(Messages::wrongNumberOfArgs());
+        }
 
-    inputPath = string(argv[argc - 1]);
+        inputPath = string(argv[argc - 1]);
+        if (inputPath.empty()) {
+            throw NotPossibleException(Messages::emptyFilePath());
+        }
 
-    if (argc == 3) {
-        string flag(argv[1]);
-        if (flag == "-v") {
-            verbose = true;
-        } else {
-            throw NotPossibleException(Messages::invalidArg(flag));
+        for (int i = 1; i < argc - 1; i++) {
+            string flag(argv[i]);
+            if (flag == "-v" && !verbose) {
+                verbose = true;
+            } else if (flag == "-p" && !productGraph) {
+                productGraph = true;
+            } else if (isCuddOption(flag)) {
+                if (i + 1 >= argc - 1) {
+                    throw NotPossibleException(Messages::wrongNumberOfArgs());
+                }
+                setCuddOption(flag, string(argv[++i]));
+            } else {
+                throw NotPossibleException(Messages::invalidArg(flag));
+            }
         }
     }
 
@@ -45,25 +85,108 @@ bool CommandLine::isVerbose() const {
     return verbose;
 }
 
+bool CommandLine::isProductGraph() const {
+    return productGraph;
+}
+
+bool CommandLine::isCompile() const {
+    return compile;
+}
+
 string CommandLine::getInputPath() const {
     return inputPath;
 }
 
+string CommandLine::getOutputPath() const {
+    assertTrue(compile);
+    return outputPath;
+}
+
+const CuddOptions & CommandLine::getCuddOptions() const {
+    return cuddOptions;
+}
+
 // static public methods
 string CommandLine::getUsage() {
     ostringstream oss;
     oss << "Usage: provelines [-options] input" << endl
+        << "   or: provelines compile input output" << endl
+        << "       to compile the JSON FSTM 'input' into the binary file"
+        << " 'output'," << endl
+        << "       which can then be given as input" << endl
         << "where options include:" << endl
         << "    -v            "
-        << "enable verbose output, i.e., print counterexamples" << endl
+        << "enable verbose output, i.e., print counterexamples and BDD"
+        << " statistics" << endl
+        << "    -p            "
+        << "precompute the product of the FSTM and of its property before"
+        << endl
+        << "                  checking it, which is faster but cannot detect"
+        << " deadlocks" << endl
+        << "    -unique n     "
+        << "initial number of slots of each unique subtable of the BDDs"
+        << endl
+        << "    -cache n      "
+        << "initial number of slots of the computed table of the BDDs" << endl
+        << "    -memory mb    "
+        << "maximum memory of the BDDs, in megabytes" << endl
+        << "    -reorder m    "
+        << "dynamic reordering method of the BDD variables, one of none,"
+        << endl
+        << "                  sift, sift-converge, symm-sift,"
+        << " symm-sift-converge, window2," << endl
+        << "                  window3, window4, group-sift, lazy-sift,"
+        << " linear, annealing," << endl
+        << "                  genetic and exact (default: none)" << endl
+        << "    -reorder-at n "
+        << "number of BDD nodes triggering the first dynamic reordering"
+        << endl
+        << "    -max-growth x "
+        << "maximum growth of the number of BDD nodes while reordering"
+        << " a variable" << endl
         << "See http://www.info.fundp.ac.be/fts/provelines/ for more details.";
     return oss.str();
 }
 
 // private methods
+bool CommandLine::isCuddOption(const string & flag) {
+    return flag == "-unique" || flag == "-cache" || flag == "-memory"
+            || flag == "-reorder" || flag == "-reorder-at"
+            || flag == "-max-growth";
+}
+
+void CommandLine::setCuddOption(const string & flag, const string & value) {
+    bool valid = false;
+    if (flag == "-unique") {
+        valid = parseValue(value, cuddOptions.uniqueSlots)
+                && cuddOptions.uniqueSlots > 0;
+    } else if (flag == "-cache") {
+        valid = parseValue(value, cuddOptions.cacheSlots)
+                && cuddOptions.cacheSlots > 0;
+    } else if (flag == "-memory") {
+        unsigned long megabytes = 0;
+        valid = parseValue(value, megabytes) && megabytes > 0;
+        cuddOptions.maxMemory = megabytes << 20;
+    } else if (flag == "-reorder") {
+        valid = CuddOptions::parseReordering(value, cuddOptions.reordering);
+    } else if (flag == "-reorder-at") {
+        valid = parseValue(value, cuddOptions.firstReordering)
+                && cuddOptions.firstReordering > 0;
+    } else if (flag == "-max-growth") {
+        valid = parseValue(value, cuddOptions.maxGrowth)
+                && cuddOptions.maxGrowth >= 1.0;
+    } else {
+        assertTrue(false);
+    }
+
+    if (!valid) {
+        throw NotPossibleException(Messages::invalidArgValue(flag, value));
+    }
+}
+
 void CommandLine::checkRep() const {
     if (doCheckRep) {
-        // Nothing to do
+        assertTrue(compile == (outputPath.length() > 0));
     }
 }
 
@@ -7,6 +7,8 @@
 #ifndef UI_COMMANDLINE_HPP
 #define	UI_COMMANDLINE_HPP
 
+#include "math/CuddOptions.hpp"
+
 #include "util/Uncopyable.hpp"
 
 #include <string>
@@ -23,19 +25,23 @@ class CommandLine : private util::Uncopyable {
 
 private:
     bool verbose;
+    bool productGraph;
+    bool compile;
     std::string inputPath;
+    std::string outputPath;
+    math::CuddOptions cuddOptions;
 
     /*
      * Representation Invariant:
-     *   I(c) = true
+     *   I(c) = c.compile <=> (c.outputPath.length > 0)
      */
 
 public:
     /**
      * @effects Makes this be a new command line containing 'argc' arguments
      *           in the 'argv' array.
-     * @throws NotPossibleException iff there are some invalid arguments or
-     *          some mandatory arguments are missing.
+     * @throws NotPossibleException iff there are some invalid arguments,
+     *          some mandatory arguments are missing or some paths are empty.
      */
     CommandLine(int argc, const char * argv[]);
 
@@ -46,17 +52,53 @@ public:
      */
     bool isVerbose() const;
 
+    /**
+     * @return true iff the product graph flag is present.
+     */
+    bool isProductGraph() const;
+
+    /**
+     * @return true iff the compile command is present.
+     */
+    bool isCompile() const;
+
     /**
      * @return the mandatory input path.
      */
     std::string getInputPath() const;
 
+    /**
+     * @requires this.isCompile()
+     * @return the output path of the compile command.
+     */
+    std::string getOutputPath() const;
+
+    /**
+     * @return the options of the CUDD manager, i.e. the defaults of
+     *          CuddOptions overridden by the BDD options present.
+     */
+    const math::CuddOptions & getCuddOptions() const;
+
     /**
      * @return a description of the typical usage of this.
      */
     static std::string getUsage();
 
 private:
+    /**
+     * @return true iff 'flag' is a BDD option, which is followed by a value.
+     */
+    static bool isCuddOption(const std::string & flag);
+
+    /**
+     * @requires isCuddOption(flag)
+     * @modifies this
+     * @effects Sets the option of the CUDD manager of flag 'flag' to 'value'.
+     * @throws NotPossibleException iff 'value' is not a valid value for
+     *          'flag'.
+     */
+    void setCuddOption(const std::string & flag, const std::string & value);
+
     /**
      * @effects Asserts the rep invariant holds for this.
      */
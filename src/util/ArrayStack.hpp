@@ -0,0 +1,132 @@
+/*
+ * ArrayStack.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef UTIL_ARRAYSTACK_HPP
+#define UTIL_ARRAYSTACK_HPP
+
+#include "Assert.hpp"
+#include "Uncopyable.hpp"
+
+#include <vector>
+
+namespace util {
+
+/**
+ * ArrayStacks are mutable stacks of elements of type T stored in a contiguous
+ * array.
+ *
+ * Unlike Stack, pushing an element does not allocate a node: the array only
+ * grows when it is full, and popping an element never frees memory. ArrayStack
+ * is thus meant for small, trivially copyable elements that are pushed and
+ * popped very often, such as the frames of an undo stack.
+ *
+ * @author mwi
+ */
+template <typename T>
+class ArrayStack : private Uncopyable {
+
+private:
+    std::vector<T> array;
+
+    /*
+     * Abstraction Function:
+     *   AF(c) = stack s such that
+     *     s.elements = c.array, from the bottom to the top of s
+     *
+     * Representation Invariant:
+     *   I(c) = true
+     */
+
+public:
+    /**
+     * @effects Makes this be a new empty stack.
+     */
+    ArrayStack();
+
+    // The default destructor is fine.
+
+    /**
+     * @modifies this
+     * @effects Adds 'element' at the top of this.
+     */
+    void push(const T & element);
+
+    /**
+     * @requires !empty()
+     * @modifies this
+     * @effects Removes the top element from this.
+     * @return the element at the top of this.
+     */
+    T pop();
+
+    /**
+     * @requires !empty()
+     * @return the element at the top of this.
+     */
+    const T & peek() const;
+
+    /**
+     * @requires 0 <= index < count()
+     * @return the element at index 'index' of this, the bottom element being
+     *          at index 0.
+     */
+    const T & at(int index) const;
+
+    /**
+     * @return true iff this is empty, i.e., this contains no element.
+     */
+    bool empty() const;
+
+    /**
+     * @return the number of elements in this.
+     */
+    int count() const;
+};
+
+template <typename T>
+ArrayStack<T>::ArrayStack() : array() {}
+
+template <typename T>
+void ArrayStack<T>::push(const T & element) {
+    array.push_back(element);
+}
+
+template <typename T>
+T ArrayStack<T>::pop() {
+    assertTrue(!empty());
+
+    T top = array.back();
+    array.pop_back();
+    return top;
+}
+
+template <typename T>
+const T & ArrayStack<T>::peek() const {
+    assertTrue(!empty());
+
+    return array.back();
+}
+
+template <typename T>
+const T & ArrayStack<T>::at(int index) const {
+    assertTrue(0 <= index && index < count());
+
+    return array[index];
+}
+
+template <typename T>
+bool ArrayStack<T>::empty() const {
+    return array.empty();
+}
+
+template <typename T>
+int ArrayStack<T>::count() const {
+    return array.size();
+}
+
+} // namespace util
+
+#endif /* UTIL_ARRAYSTACK_HPP */
@@ -0,0 +1,62 @@
+/*
+ * MappedFile.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "MappedFile.hpp"
+
+#include "Assert.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using std::size_t;
+using std::string;
+
+namespace util {
+
+// constructors
+MappedFile::MappedFile(const string & path) : data(NULL), size(0) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+
+    struct stat status;
+    if (fstat(fd, &status) == 0 && status.st_size > 0) {
+        void * mapping = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE,
+                fd, 0);
+        if (mapping != MAP_FAILED) {
+            data = static_cast<const char *>(mapping);
+            size = status.st_size;
+        }
+    }
+    // The mapping remains valid after the file is closed.
+    close(fd);
+
+    assertTrue(data != NULL || size == 0);
+}
+
+MappedFile::~MappedFile() {
+    if (data != NULL) {
+        munmap(const_cast<char *>(data), size);
+    }
+}
+
+// public methods
+bool MappedFile::isMapped() const {
+    return data != NULL;
+}
+
+const char * MappedFile::getData() const {
+    return data;
+}
+
+size_t MappedFile::getSize() const {
+    return size;
+}
+
+} // namespace util
@@ -0,0 +1,68 @@
+/*
+ * MappedFile.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef UTIL_MAPPEDFILE_HPP
+#define UTIL_MAPPEDFILE_HPP
+
+#include "Uncopyable.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace util {
+
+/**
+ * A MappedFile is a read-only memory mapping of a file. The mapping is
+ * released when the MappedFile is destroyed.
+ *
+ * Specification fields:
+ * - data : const char *   // The content of the file, or null if unmapped.
+ * - size : size_t         // The size of the file.
+ *
+ * @author mwi
+ */
+class MappedFile : private Uncopyable {
+
+private:
+    const char * data;
+    std::size_t size;
+
+    /*
+     * Representation Invariant:
+     *   I(c) = (c.data = null) => (c.size = 0)
+     */
+
+public:
+    /**
+     * @effects Makes this be a new mapping of the file at 'path', or an
+     *           unmapped file if it cannot be opened or is empty.
+     */
+    explicit MappedFile(const std::string & path);
+
+    /**
+     * @effects Releases the mapping of this (if any).
+     */
+    ~MappedFile();
+
+    /**
+     * @return true iff this.data != null
+     */
+    bool isMapped() const;
+
+    /**
+     * @return this.data
+     */
+    const char * getData() const;
+
+    /**
+     * @return this.size
+     */
+    std::size_t getSize() const;
+};
+
+} // namespace util
+
+#endif /* UTIL_MAPPEDFILE_HPP */
@@ -0,0 +1,134 @@
+/*
+ * ThreadPool.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "ThreadPool.hpp"
+
+#include "Assert.hpp"
+
+#include <unistd.h>
+
+namespace util {
+
+// constructors
+ThreadPool::ThreadPool(unsigned int nbOfThreads)
+    : workers(), task(NULL), nbOfItems(0), nextItem(0), nbOfActiveWorkers(0),
+      generation(0), stopping(false) {
+    assertTrue(nbOfThreads > 0);
+
+    pthread_mutex_init(&mutex, NULL);
+    pthread_cond_init(&taskSubmitted, NULL);
+    pthread_cond_init(&workerDone, NULL);
+
+    for (unsigned int i = 1; i < nbOfThreads; i++) {
+        pthread_t worker;
+        if (pthread_create(&worker, NULL, &ThreadPool::startWorker, this)
+                != 0) {
+            // Runs with the threads created so far.
+            break;
+        }
+        workers.push_back(worker);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    pthread_mutex_lock(&mutex);
+    stopping = true;
+    pthread_cond_broadcast(&taskSubmitted);
+    pthread_mutex_unlock(&mutex);
+
+    for (unsigned int i = 0; i < workers.size(); i++) {
+        pthread_join(workers[i], NULL);
+    }
+
+    pthread_cond_destroy(&workerDone);
+    pthread_cond_destroy(&taskSubmitted);
+    pthread_mutex_destroy(&mutex);
+}
+
+// public methods
+unsigned int ThreadPool::getNbOfThreads() const {
+    return workers.size() + 1;
+}
+
+void ThreadPool::run(ParallelTask & task, unsigned int nbOfItems) {
+    pthread_mutex_lock(&mutex);
+    this->task = &task;
+    this->nbOfItems = nbOfItems;
+    nextItem = 0;
+    generation++;
+    pthread_cond_broadcast(&taskSubmitted);
+    pthread_mutex_unlock(&mutex);
+
+    work();
+
+    pthread_mutex_lock(&mutex);
+    while (nbOfActiveWorkers > 0) {
+        pthread_cond_wait(&workerDone, &mutex);
+    }
+    this->task = NULL;
+    checkRep();
+    pthread_mutex_unlock(&mutex);
+}
+
+// static public methods
+unsigned int ThreadPool::getNbOfCores() {
+    long nbOfCores = sysconf(_SC_NPROCESSORS_ONLN);
+    return nbOfCores > 0 ? nbOfCores : 1;
+}
+
+// private methods
+void ThreadPool::work() {
+    while (true) {
+        pthread_mutex_lock(&mutex);
+        if (nextItem >= nbOfItems) {
+            pthread_mutex_unlock(&mutex);
+            return;
+        }
+        unsigned int item = nextItem++;
+        ParallelTask * current = task;
+        pthread_mutex_unlock(&mutex);
+
+        current->run(item);
+    }
+}
+
+void ThreadPool::workerLoop() {
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&mutex);
+    while (true) {
+        while (!stopping && generation == seen) {
+            pthread_cond_wait(&taskSubmitted, &mutex);
+        }
+        if (stopping) {
+            break;
+        }
+        seen = generation;
+        nbOfActiveWorkers++;
+        pthread_mutex_unlock(&mutex);
+
+        work();
+
+        pthread_mutex_lock(&mutex);
+        nbOfActiveWorkers--;
+        pthread_cond_signal(&workerDone);
+    }
+    pthread_mutex_unlock(&mutex);
+}
+
+void * ThreadPool::startWorker(void * pool) {
+    static_cast<ThreadPool *>(pool)->workerLoop();
+    return NULL;
+}
+
+void ThreadPool::checkRep() const {
+    if (doCheckRep) {
+        assertTrue(nbOfActiveWorkers <= workers.size());
+        assertTrue(task != NULL || nextItem >= nbOfItems);
+    }
+}
+
+} // namespace util
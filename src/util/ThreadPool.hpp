@@ -0,0 +1,132 @@
+/*
+ * ThreadPool.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef UTIL_THREADPOOL_HPP
+#define UTIL_THREADPOOL_HPP
+
+#include "Uncopyable.hpp"
+
+#include <pthread.h>
+
+#include <vector>
+
+namespace util {
+
+/**
+ * A ParallelTask is a task made of independent items that can be run
+ * concurrently by a ThreadPool.
+ *
+ * @author mwi
+ */
+class ParallelTask {
+
+public:
+    /**
+     * @requires this.run does not throw and may run concurrently for
+     *            distinct items
+     * @effects Runs the item 'index' of this.
+     */
+    virtual void run(unsigned int index) = 0;
+
+    // mandatory virtual destructor
+    virtual ~ParallelTask() {}
+};
+
+/**
+ * A ThreadPool is a fixed set of threads that run the items of parallel
+ * tasks. The thread that runs a task takes part in it, so that a pool of one
+ * thread runs the tasks sequentially without creating any thread.
+ *
+ * @author mwi
+ */
+class ThreadPool : private Uncopyable {
+
+private:
+    std::vector<pthread_t> workers;
+    pthread_mutex_t mutex;
+    /* Signaled when a task is submitted or the pool is stopped. */
+    pthread_cond_t taskSubmitted;
+    /* Signaled when a worker is done with the current task. */
+    pthread_cond_t workerDone;
+
+    /* The following fields are guarded by 'mutex'. */
+
+    /* The current task, if any. */
+    ParallelTask * task;
+    unsigned int nbOfItems;
+    /* The next item of the current task to run. */
+    unsigned int nextItem;
+    /* The number of workers running items of the current task. */
+    unsigned int nbOfActiveWorkers;
+    /* Incremented each time a task is submitted. */
+    unsigned long generation;
+    bool stopping;
+
+    /*
+     * Representation Invariant:
+     *   I(c) = c.nbOfActiveWorkers <= c.workers.size &&
+     *     (c.task = null) => (c.nextItem >= c.nbOfItems)
+     */
+
+public:
+    /**
+     * @requires nbOfThreads > 0
+     * @effects Makes this be a new pool of 'nbOfThreads' threads, including
+     *           the thread that runs the tasks.
+     */
+    explicit ThreadPool(unsigned int nbOfThreads);
+
+    /**
+     * @effects Stops and joins the threads of this.
+     */
+    ~ThreadPool();
+
+    /**
+     * @return the number of threads of this.
+     */
+    unsigned int getNbOfThreads() const;
+
+    /**
+     * @modifies task
+     * @effects Runs task.run(i) for each i in [0, nbOfItems) on the threads
+     *           of this and returns once all of them are done.
+     */
+    void run(ParallelTask & task, unsigned int nbOfItems);
+
+    /**
+     * @return the number of online processors, at least 1.
+     */
+    static unsigned int getNbOfCores();
+
+private:
+    /**
+     * @modifies this
+     * @effects Runs the remaining items of the current task.
+     */
+    void work();
+
+    /**
+     * @modifies this
+     * @effects Runs the items of the tasks submitted to this until this is
+     *           stopped.
+     */
+    void workerLoop();
+
+    /**
+     * @effects Runs the worker loop of the pool 'pool'.
+     */
+    static void * startWorker(void * pool);
+
+    /**
+     * @requires this.mutex is locked
+     * @effects Asserts the rep invariant holds for this.
+     */
+    void checkRep() const;
+};
+
+} // namespace util
+
+#endif /* UTIL_THREADPOOL_HPP */
@@ -24,7 +24,7 @@ const string AbstractParser::CommentEnd = "*/";
 AbstractParser::AbstractParser(const std::string & input)
     : input(input), parsedInput(), nextSymbol(), position(1) {
 
-    nextSymbol = input.begin();
+    nextSymbol = this->input.begin();
 
     checkRep();
 }
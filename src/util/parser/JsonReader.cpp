@@ -0,0 +1,312 @@
+/*
+ * JsonReader.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "JsonReader.hpp"
+
+#include "util/Assert.hpp"
+#include "util/JsonException.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+
+using std::istream;
+using std::ostringstream;
+using std::string;
+
+namespace util {
+namespace parser {
+
+// constructors
+JsonReader::JsonReader(istream & input)
+    : input(input), scopes(), afterComma(false), pendingComma(false) {
+
+    checkRep();
+}
+
+// public methods
+JsonReader::ValueType JsonReader::peek() {
+    switch (peekChar()) {
+        case '{':
+            return ObjectValue;
+        case '[':
+            return ArrayValue;
+        case '"':
+            return StringValue;
+        case 't':
+        case 'f':
+            return BooleanValue;
+        case 'n':
+            return NullValue;
+        case '}':
+        case ']':
+        case EOF:
+            return EndValue;
+        default:
+            return NumberValue;
+    }
+}
+
+bool JsonReader::hasNext() {
+    bool next = peek() != EndValue;
+    if (next && pendingComma) {
+        error("',' expected");
+    }
+    return next;
+}
+
+void JsonReader::beginObject() {
+    expectChar('{');
+    scopes.push_back(true);
+    afterComma = false;
+    pendingComma = false;
+}
+
+void JsonReader::endObject() {
+    endScope(true, '}');
+}
+
+void JsonReader::beginArray() {
+    expectChar('[');
+    scopes.push_back(false);
+    afterComma = false;
+    pendingComma = false;
+}
+
+void JsonReader::endArray() {
+    endScope(false, ']');
+}
+
+string JsonReader::nextName() {
+    if (scopes.empty() || !scopes.back()) {
+        error("name outside of an object");
+    }
+    string name = readString();
+    expectChar(':');
+    afterComma = false;
+    pendingComma = false;
+    return name;
+}
+
+string JsonReader::nextString() {
+    string str = readString();
+    endValue();
+    return str;
+}
+
+int JsonReader::nextInt() {
+    if (peek() != NumberValue) {
+        error("number expected");
+    }
+    string number = readNumber();
+    char * end = NULL;
+    long value = std::strtol(number.c_str(), &end, 10);
+    if (number.empty() || *end != '\0') {
+        error("integer expected");
+    }
+    endValue();
+    return static_cast<int>(value);
+}
+
+bool JsonReader::nextBool() {
+    bool value = peekChar() == 't';
+    expectLiteral(value ? "true" : "false");
+    endValue();
+    return value;
+}
+
+void JsonReader::nextNull() {
+    expectLiteral("null");
+    endValue();
+}
+
+void JsonReader::skipValue() {
+    switch (peek()) {
+        case ObjectValue:
+            beginObject();
+            while (hasNext()) {
+                nextName();
+                skipValue();
+            }
+            endObject();
+            break;
+        case ArrayValue:
+            beginArray();
+            while (hasNext()) {
+                skipValue();
+            }
+            endArray();
+            break;
+        case StringValue:
+            nextString();
+            break;
+        case NumberValue:
+            readNumber();
+            endValue();
+            break;
+        case BooleanValue:
+            nextBool();
+            break;
+        case NullValue:
+            nextNull();
+            break;
+        case EndValue:
+            error("value expected");
+            break;
+    }
+}
+
+// private methods
+int JsonReader::peekChar() {
+    int c = input.peek();
+    while (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+        input.get();
+        c = input.peek();
+    }
+    return c;
+}
+
+void JsonReader::expectChar(char c) {
+    if (peekChar() != c) {
+        error(string("'") + c + "' expected");
+    }
+    input.get();
+}
+
+void JsonReader::expectLiteral(const string & literal) {
+    peekChar();
+    string::const_iterator it;
+    for (it = literal.begin(); it != literal.end(); ++it) {
+        if (input.get() != *it) {
+            error(literal + " expected");
+        }
+    }
+}
+
+string JsonReader::readString() {
+    expectChar('"');
+    string str;
+    int c = input.get();
+    while (c != '"') {
+        if (c == EOF || c == '\n') {
+            error("unterminated string");
+        }
+        if (c == '\\') {
+            c = input.get();
+            switch (c) {
+                case '"':
+                case '\\':
+                case '/':
+                    str += static_cast<char>(c);
+                    break;
+                case 'b':
+                    str += '\b';
+                    break;
+                case 'f':
+                    str += '\f';
+                    break;
+                case 'n':
+                    str += '\n';
+                    break;
+                case 'r':
+                    str += '\r';
+                    break;
+                case 't':
+                    str += '\t';
+                    break;
+                case 'u': {
+                    char hex[5] = { 0, 0, 0, 0, 0 };
+                    for (int i = 0; i < 4; i++) {
+                        hex[i] = static_cast<char>(input.get());
+                    }
+                    char * end = NULL;
+                    unsigned long code = std::strtoul(hex, &end, 16);
+                    if (*end != '\0') {
+                        error("invalid unicode escape");
+                    }
+                    // Encodes the code point in UTF-8, surrogates excepted.
+                    if (code < 0x80) {
+                        str += static_cast<char>(code);
+                    } else if (code < 0x800) {
+                        str += static_cast<char>(0xC0 | (code >> 6));
+                        str += static_cast<char>(0x80 | (code & 0x3F));
+                    } else {
+                        str += static_cast<char>(0xE0 | (code >> 12));
+                        str += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                        str += static_cast<char>(0x80 | (code & 0x3F));
+                    }
+                    break;
+                }
+                default:
+                    error("invalid escape sequence");
+            }
+        } else {
+            str += static_cast<char>(c);
+        }
+        c = input.get();
+    }
+    return str;
+}
+
+string JsonReader::readNumber() {
+    peekChar();
+    string number;
+    int c = input.peek();
+    while ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.'
+            || c == 'e' || c == 'E') {
+        number += static_cast<char>(input.get());
+        c = input.peek();
+    }
+    if (number.empty()) {
+        error("value expected");
+    }
+    return number;
+}
+
+void JsonReader::endValue() {
+    afterComma = false;
+    pendingComma = false;
+    if (!scopes.empty()) {
+        if (peekChar() == ',') {
+            input.get();
+            afterComma = true;
+        } else {
+            pendingComma = true;
+        }
+    }
+    checkRep();
+}
+
+void JsonReader::endScope(bool isObject, char c) {
+    if (scopes.empty() || scopes.back() != isObject) {
+        error(string("unexpected '") + c + "'");
+    }
+    if (afterComma) {
+        error(string("value expected before '") + c + "'");
+    }
+    expectChar(c);
+    scopes.pop_back();
+    endValue();
+}
+
+void JsonReader::error(const string & msg) const {
+    ostringstream oss;
+    oss << "JsonReader: " << msg;
+    if (input.good()) {
+        oss << " at offset " << input.tellg();
+    }
+    throw JsonException(oss.str());
+}
+
+void JsonReader::checkRep() const {
+    if (doCheckRep) {
+        assertTrue(!(afterComma || pendingComma) || scopes.size() > 0);
+        assertTrue(!(afterComma && pendingComma));
+    }
+}
+
+} // namespace parser
+} // namespace util
@@ -0,0 +1,211 @@
+/*
+ * JsonReader.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef UTIL_PARSER_JSONREADER_HPP
+#define UTIL_PARSER_JSONREADER_HPP
+
+#include "util/Uncopyable.hpp"
+
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace util {
+namespace parser {
+
+/**
+ * JsonReader is a pull parser for JSON documents. It reads a JSON document
+ * from an input stream one token at a time, so that a document of any size
+ * can be processed with a memory bounded by the largest value actually
+ * returned to the caller.
+ *
+ * Values are read in document order: an object is read with beginObject, then
+ * nextName and the value of each member while hasNext holds, then endObject.
+ * Arrays are read likewise with beginArray and endArray. Any value can be
+ * ignored with skipValue.
+ *
+ * Every method throws a JsonException upon a syntax error, or if the read
+ * value does not have the expected type.
+ *
+ * @author mwi
+ */
+class JsonReader : private Uncopyable {
+
+public:
+    /** The types of JSON values. */
+    enum ValueType {
+        ObjectValue,
+        ArrayValue,
+        StringValue,
+        NumberValue,
+        BooleanValue,
+        NullValue,
+        /* The end of the enclosing object or array, or of the document. */
+        EndValue
+    };
+
+private:
+    std::istream & input;
+    /* The opened containers, true for an object and false for an array. */
+    std::vector<bool> scopes;
+    /* True iff a comma has been read since the last value. */
+    bool afterComma;
+    /* True iff the last value of the current container is not followed by
+     * a comma. */
+    bool pendingComma;
+
+    /*
+     * Representation Invariant:
+     *   I(c) = (c.afterComma || c.pendingComma) => c.scopes.size > 0 &&
+     *     !(c.afterComma && c.pendingComma)
+     */
+
+public:
+    /**
+     * @effects Makes this be a new reader for the JSON document 'input'.
+     */
+    explicit JsonReader(std::istream & input);
+
+    // The default destructor is fine.
+
+    /**
+     * @modifies this
+     * @return the type of the next value, without reading it.
+     */
+    ValueType peek();
+
+    /**
+     * @modifies this
+     * @return true iff the current object or array has another member or
+     *          element.
+     */
+    bool hasNext();
+
+    /**
+     * @modifies this
+     * @effects Reads the beginning of an object.
+     */
+    void beginObject();
+
+    /**
+     * @requires !hasNext()
+     * @modifies this
+     * @effects Reads the end of the current object.
+     */
+    void endObject();
+
+    /**
+     * @modifies this
+     * @effects Reads the beginning of an array.
+     */
+    void beginArray();
+
+    /**
+     * @requires !hasNext()
+     * @modifies this
+     * @effects Reads the end of the current array.
+     */
+    void endArray();
+
+    /**
+     * @requires the current scope is an object
+     * @modifies this
+     * @return the name of the next member of the current object.
+     */
+    std::string nextName();
+
+    /**
+     * @modifies this
+     * @return the next value, which must be a string.
+     */
+    std::string nextString();
+
+    /**
+     * @modifies this
+     * @return the next value, which must be an integer number.
+     */
+    int nextInt();
+
+    /**
+     * @modifies this
+     * @return the next value, which must be a boolean.
+     */
+    bool nextBool();
+
+    /**
+     * @modifies this
+     * @effects Reads the next value, which must be null.
+     */
+    void nextNull();
+
+    /**
+     * @modifies this
+     * @effects Reads and ignores the next value, including all its members or
+     *           elements.
+     */
+    void skipValue();
+
+private:
+    /**
+     * @modifies this
+     * @effects Eats the upcoming whitespaces.
+     * @return the next character, or EOF, without reading it.
+     */
+    int peekChar();
+
+    /**
+     * @modifies this
+     * @effects Reads the character 'c', possibly prefixed by whitespaces.
+     * @throws JsonException iff the next character is not 'c'.
+     */
+    void expectChar(char c);
+
+    /**
+     * @modifies this
+     * @effects Reads the literal 'literal'.
+     * @throws JsonException iff the next characters do not match 'literal'.
+     */
+    void expectLiteral(const std::string & literal);
+
+    /**
+     * @modifies this
+     * @return the next string, which is not followed by a separator.
+     */
+    std::string readString();
+
+    /**
+     * @modifies this
+     * @return the characters of the next number.
+     */
+    std::string readNumber();
+
+    /**
+     * @modifies this
+     * @effects Reads the comma following a member or an element, if any.
+     */
+    void endValue();
+
+    /**
+     * @modifies this
+     * @effects Reads the end 'c' of the current container.
+     */
+    void endScope(bool isObject, char c);
+
+    /**
+     * @throws JsonException with a message built from 'msg'.
+     */
+    void error(const std::string & msg) const;
+
+    /**
+     * @effects Asserts the rep invariant holds for this.
+     */
+    void checkRep() const;
+};
+
+} // namespace parser
+} // namespace util
+
+#endif /* UTIL_PARSER_JSONREADER_HPP */
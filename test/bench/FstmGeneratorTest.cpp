@@ -0,0 +1,120 @@
+/*
+ * FstmGeneratorTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "bench/FstmGenerator.hpp"
+
+#include "config/Context.hpp"
+#include "core/fts/FTS.hpp"
+
+#include <json/json.h>
+
+#include <sstream>
+#include <string>
+
+using config::Context;
+using core::fts::FTSPtr;
+using std::string;
+using std::stringstream;
+
+namespace bench {
+
+/**
+ * Unit tests for the FstmGenerator class.
+ *
+ * @author mwi
+ */
+class FstmGeneratorTest : public ::testing::Test {
+
+protected:
+    Json::Value root;
+
+    /**
+     * Sets up the test fixture.
+     */
+    void SetUp() {
+        stringstream json;
+        FstmGenerator generator(10, 35, 4, 3, 2);
+        generator.generate(json);
+
+        Json::Reader reader;
+        ASSERT_TRUE(reader.parse(json, root));
+    }
+};
+
+/**
+ * Tests that the generated FSTM has the requested size.
+ */
+TEST_F(FstmGeneratorTest, generate_size) {
+    // Verify
+    ASSERT_EQ(10u, root["states"].size());
+    ASSERT_EQ(35u, root["transitions"].size());
+    ASSERT_EQ(35, root["FSTM"]["nbOfTransitions"].asInt());
+    ASSERT_EQ(2u, root["ltlProperties"].size());
+    ASSERT_EQ(2, root["FSTM"]["nbOfLtlProperties"].asInt());
+}
+
+/**
+ * Tests that the transitions are grouped by source and that the first
+ * transition of each state belongs to the ring labelled with true.
+ */
+TEST_F(FstmGeneratorTest, generate_transitions) {
+    // Setup
+    const Json::Value & transitions = root["transitions"];
+    int source = -1;
+
+    // Verify
+    for (unsigned int i = 0; i < transitions.size(); ++i) {
+        const string name = transitions[i]["source"].asString();
+        if (source < 0 || name != FstmGenerator::stateName(source)) {
+            ++source;
+            ASSERT_EQ(FstmGenerator::stateName(source), name);
+            ASSERT_EQ(FstmGenerator::stateName((source + 1) % 10),
+                    transitions[i]["target"].asString());
+            ASSERT_EQ("true", transitions[i]["featureExp"].asString());
+        }
+    }
+    ASSERT_EQ(9, source);
+}
+
+/**
+ * Tests that the generation is deterministic for a given seed.
+ */
+TEST_F(FstmGeneratorTest, generate_deterministic) {
+    // Setup
+    stringstream first;
+    stringstream second;
+    FstmGenerator generator1(20, 60, 5, 2, 1, 42);
+    FstmGenerator generator2(20, 60, 5, 2, 1, 42);
+
+    // Exercise
+    generator1.generate(first);
+    generator2.generate(second);
+
+    // Verify
+    ASSERT_EQ(first.str(), second.str());
+}
+
+/**
+ * Tests that the generated FSTM can be loaded.
+ */
+TEST_F(FstmGeneratorTest, generate_loadable) {
+    // Setup
+    Context ctx;
+    stringstream json;
+    FstmGenerator generator(10, 40, 4, 3, 0);
+    generator.generate(json);
+
+    // Exercise
+    FTSPtr fts = ctx.createFSTM(json);
+
+    // Verify
+    ASSERT_FALSE(fts->hasProperty());
+    ASSERT_TRUE(fts->hasNextTransition());
+}
+
+} // namespace bench
@@ -0,0 +1,60 @@
+/*
+ * MemoryStatsTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "core/checker/MemoryStats.hpp"
+
+#include <string>
+
+using std::string;
+
+namespace core {
+namespace checker {
+
+/**
+ * Unit tests for the MemoryStats struct.
+ *
+ * @author mwi
+ */
+class MemoryStatsTest : public ::testing::Test {
+
+protected:
+    MemoryStats memory;
+};
+
+/**
+ * Tests that a new breakdown is empty.
+ */
+TEST_F(MemoryStatsTest, constructor) {
+    // Verify
+    ASSERT_EQ(0, memory.peakRss);
+    ASSERT_EQ(0u, memory.tableBytes);
+    ASSERT_EQ(0u, memory.bddBytes);
+    ASSERT_EQ(0u, memory.counterExampleBytes);
+}
+
+/**
+ * Tests that toString reports every field.
+ */
+TEST_F(MemoryStatsTest, toString) {
+    // Setup
+    memory.peakRss = 4096;
+    memory.tableBytes = 2048;
+    memory.bddBytes = 10240;
+    memory.counterExampleBytes = 1024;
+    const string expected("peak RSS: 4096 KB; table: 2 KB; BDD: 10 KB; "
+            "counter examples: 1 KB");
+
+    // Exercise
+    const string actual(memory.toString());
+
+    // Verify
+    ASSERT_EQ(expected, actual);
+}
+
+} // namespace checker
+} // namespace core
@@ -6,7 +6,10 @@
 
 #include "gtest/gtest.h"
 
+#include "SearchFixtures.hpp"
+
 #include "config/Context.hpp"
+#include "core/checker/CounterExample.hpp"
 #include "core/checker/NestedSearch.hpp"
 #include "core/fts/fstm/FSTM.hpp"
 #include "core/features/BoolFeatureExp.hpp"
@@ -15,13 +18,16 @@
 
 using config::Context;
 using core::fts::FTS;
+using core::fts::StatePtr;
 using core::fts::fstm::FSTM;
 using core::features::BoolFeatureExp;
 using core::features::BoolFeatureExpFactory;
 using core::features::FeatureExp;
+using std::auto_ptr;
 using std::string;
 using std::stringstream;
 using std::tr1::shared_ptr;
+using util::Generator;
 
 namespace core {
 namespace checker {
@@ -59,343 +65,7 @@ protected:
         DVLOG(1) << "Property: " << property;
 
         stringstream jsonFstm;
-
-        switch(test) {
-            case 0:
-                jsonFstm
-                        << " {"
-                        << "   \"FSTM\":{"
-                        << "      \"name\":\"Test1\","
-                        << "      \"generated\":\"Tue Aug 06 10:31:18 CEST 2013\","
-                        << "      \"nbOfLtlProperties\":1,"
-                        << "      \"nbOfTransitions\":6"
-                        << "   },"
-                        << "   \"states\":["
-                        << "      \"state1\","
-                        << "      \"state2\""
-                        << "   ],"
-                        << "   \"events\":["
-                        << "      \"evt\""
-                        << "   ],"
-                        << "   \"ltlProperties\":[\"" + property + "\""
-                        << "   ],"
-                        << "   \"transitions\":[ "
-                        << "      {"
-                        << "         \"source\":\"state1\","
-                        << "         \"target\":\"state1\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state1\","
-                        << "         \"target\":\"state2\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"f\""
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state2\","
-                        << "         \"target\":\"state2\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      }"
-                        << "   ]"
-                        << "}";
-                break;
-            case 1:
-                jsonFstm
-                        << " {"
-                        << "   \"FSTM\":{"
-                        << "      \"name\":\"Test1\","
-                        << "      \"generated\":\"Tue Aug 06 10:31:18 CEST 2013\","
-                        << "      \"nbOfLtlProperties\":1,"
-                        << "      \"nbOfTransitions\":6"
-                        << "   },"
-                        << "   \"states\":["
-                        << "      \"state1\","
-                        << "      \"state2\","
-                        << "      \"state3\","
-                        << "      \"state4\","
-                        << "      \"state5\""
-                        << "   ],"
-                        << "   \"events\":["
-                        << "      \"evt0\","
-                        << "      \"evt1\","
-                        << "      \"evt2\","
-                        << "      \"evt3\","
-                        << "      \"evt4\","
-                        << "      \"evt5\","
-                        << "      \"evt6\","
-                        << "      \"evt7\""
-                        << "   ],"
-                        << "   \"ltlProperties\":[\"" + property + "\""
-                        << "   ],"
-                        << "   \"transitions\":[ "
-                        << "      {"
-                        << "         \"source\":\"state1\","
-                        << "         \"target\":\"state2\","
-                        << "         \"event\":\"evt1\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state2\","
-                        << "         \"target\":\"state3\","
-                        << "         \"event\":\"evt2\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state2\","
-                        << "         \"target\":\"state4\","
-                        << "         \"event\":\"evt3\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"f || g\""
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state3\","
-                        << "         \"target\":\"state1\","
-                        << "         \"event\":\"evt4\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state3\","
-                        << "         \"target\":\"state4\","
-                        << "         \"event\":\"evt5\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"h\""
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state4\","
-                        << "         \"target\":\"state3\","
-                        << "         \"event\":\"evt6\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"f || h\""
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state4\","
-                        << "         \"target\":\"state4\","
-                        << "         \"event\":\"evt7\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"g\""
-                        << "      }"
-                        << "   ]"
-                        << "}";
-                break;
-            case 2 :
-                jsonFstm
-                        << "{"
-                        << "   \"FSTM\":{"
-                        << "      \"name\":\"Test\","
-                        << "      \"generated\":\"Tue Aug 06 10:31:18 CEST 2013\","
-                        << "      \"nbOfLtlProperties\":1,"
-                        << "      \"nbOfTransitions\":12"
-                        << "   },"
-                        << "   \"states\":["
-                        << "      \"state1\","
-                        << "      \"state2\","
-                        << "      \"state3\","
-                        << "      \"state4\","
-                        << "      \"state5\","
-                        << "      \"state6\","
-                        << "      \"state7\","
-                        << "      \"state8\","
-                        << "      \"state9\","
-                        << "      \"state10\""
-                        << "   ],"
-                        << "   \"events\":["
-                        << "      \"evt\""
-                        << "   ],"
-                        << "   \"ltlProperties\":[\"" + property + "\""
-                        << "   ],"
-                        << "   \"transitions\":[ "
-                        << "      {"
-                        << "         \"source\":\"state1\","
-                        << "         \"target\":\"state2\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state1\","
-                        << "         \"target\":\"state3\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state2\","
-                        << "         \"target\":\"state4\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state3\","
-                        << "         \"target\":\"state4\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state4\","
-                        << "         \"target\":\"state6\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"!(f)\""
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state4\","
-                        << "         \"target\":\"state7\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state5\","
-                        << "         \"target\":\"state5\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state6\","
-                        << "         \"target\":\"state8\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state7\","
-                        << "         \"target\":\"state9\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state8\","
-                        << "         \"target\":\"state10\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state9\","
-                        << "         \"target\":\"state10\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state9\","
-                        << "         \"target\":\"state6\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"f\""
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state10\","
-                        << "         \"target\":\"state1\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":null"
-                        << "      }"
-                        << "   ]"
-                        << "}";
-                break;
-            case 3 :
-                jsonFstm
-                        << "{"
-                        << "   \"FSTM\":{"
-                        << "      \"name\":\"Test\","
-                        << "      \"generated\":\"Tue Aug 06 10:31:18 CEST 2013\","
-                        << "      \"nbOfLtlProperties\":1,"
-                        << "      \"nbOfTransitions\":9"
-                        << "   },"
-                        << "   \"states\":["
-                        << "      \"state1\","
-                        << "      \"state2\","
-                        << "      \"state3\","
-                        << "      \"state4\","
-                        << "      \"state5\","
-                        << "      \"state6\""
-                        << "   ],"
-                        << "   \"events\":["
-                        << "      \"evt\""
-                        << "   ],"
-                        << "   \"ltlProperties\":[\"[] (state5 -> X state3)\""
-                        << "   ],"
-                        << "   \"transitions\":[ "
-                        << "      {"
-                        << "         \"source\":\"state1\","
-                        << "         \"target\":\"state2\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"f\""
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state1\","
-                        << "         \"target\":\"state2\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"!(f)\""
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state2\","
-                        << "         \"target\":\"state3\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"g\""
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state2\","
-                        << "         \"target\":\"state3\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"!(g)\""
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state3\","
-                        << "         \"target\":\"state4\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"h\""
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state4\","
-                        << "         \"target\":\"state5\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"h\""
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state5\","
-                        << "         \"target\":\"state6\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"h\""
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state5\","
-                        << "         \"target\":\"state3\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"h\""
-                        << "      },"
-                        << "      {"
-                        << "         \"source\":\"state6\","
-                        << "         \"target\":\"state3\","
-                        << "         \"event\":\"evt\","
-                        << "         \"guard\":null,"
-                        << "         \"featureExp\":\"h\""
-                        << "      }"
-                        << "   ]"
-                        << "}";
-                break;
-        }
+        writeJsonFstm(test, property, jsonFstm);
 
         shared_ptr<FTS> fts(new FSTM(jsonFstm, *factory));
 
@@ -403,6 +73,22 @@ protected:
 
     }
 
+    /**
+     * @return the names of the states of 'counterExample', separated by
+     *         spaces.
+     */
+    static string path(const CounterExample & counterExample) {
+        auto_ptr<Generator<StatePtr> > states(counterExample.states());
+        string result;
+        while (states->hasNext()) {
+            if (!result.empty()) {
+                result += " ";
+            }
+            result += states->next()->getName();
+        }
+        return result;
+    }
+
 };
 
 // ____TEST 0____
@@ -802,5 +488,96 @@ TEST_F(NestedSearchTest, test3_safety1) {
     ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
 }
 
+// ____TEST 4____
+
+/*
+ * The claim has several SCCs: only the transitions of the component of the
+ * accepting state are followed by the inner search. The bad products and the
+ * counterexample are the ones of the nested search over the whole claim.
+ */
+TEST_F(NestedSearchTest, test4_components) {
+    // Setup
+    init(4, "([] <> state1) -> (state2 U state3)");
+    shared_ptr<FeatureExp> badProducts(factory->create("f"));
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+    ASSERT_EQ(1, target->getCounterExamples()->count());
+    ASSERT_EQ("state1 state2 state4 state1 state2 state3 state4 state1",
+            path(target->getCounterExamples()->getFirst()));
+}
+
+// ____TEST 5____
+
+/*
+ * The accepting state is reached twice, the second time (through state4)
+ * under features subsumed by the ones of the first visit.
+ */
+TEST_F(NestedSearchTest, test5_subsumedFeatures) {
+    // Setup
+    init(5, "[] <> state3");
+    shared_ptr<FeatureExp> badProducts(factory->create("g"));
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+    ASSERT_EQ(1, target->getCounterExamples()->count());
+    ASSERT_EQ("state1 state2 state2 state2",
+            path(target->getCounterExamples()->getFirst()));
+}
+
+// ____TEST 6____
+
+/*
+ * The transition closing the lasso leaves an accepting state. The cycle is
+ * found by the outer search, before the inner one is started; the nested
+ * search without early detection explores 7 states.
+ */
+TEST_F(NestedSearchTest, test6_lassoLeavingAccepting) {
+    // Setup
+    init(6, "<> [] ! state2");
+    shared_ptr<FeatureExp> badProducts(factory->getTrue());
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+    ASSERT_EQ(2, target->getCounterExamples()->count());
+    ASSERT_EQ("state1 state2 state1 state2",
+            path(target->getCounterExamples()->getFirst()));
+    ASSERT_EQ("state1 state2 state2 state2",
+            path(target->getCounterExamples()->getLast()));
+    ASSERT_EQ(4, target->getNbOfExploredStates());
+}
+
+// ____TEST 7____
+
+/*
+ * The transition closing the lasso enters an accepting state. The cycle is
+ * found by the outer search, before the inner one is started; the nested
+ * search without early detection explores 7 states.
+ */
+TEST_F(NestedSearchTest, test7_lassoEnteringAccepting) {
+    // Setup
+    init(7, "([] <> state2) -> ([] <> state4)");
+    shared_ptr<FeatureExp> badProducts(factory->getTrue());
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+    ASSERT_EQ(1, target->getCounterExamples()->count());
+    ASSERT_EQ("state1 state2 state2 state2 state2 state2",
+            path(target->getCounterExamples()->getFirst()));
+    ASSERT_EQ(5, target->getNbOfExploredStates());
+}
+
 } // namespace checker
 } // namespace core
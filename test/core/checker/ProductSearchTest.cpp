@@ -0,0 +1,198 @@
+/*
+ * ProductSearchTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "SearchFixtures.hpp"
+
+#include "config/Context.hpp"
+#include "core/checker/ProductSearch.hpp"
+#include "core/fts/fstm/ClaimPropertyAutomaton.hpp"
+#include "core/fts/fstm/FSTM.hpp"
+#include "core/fts/fstm/ProductGraph.hpp"
+#include "core/features/BoolFeatureExp.hpp"
+
+#include <glog/logging.h>
+
+#include <sstream>
+
+using config::Context;
+using core::fts::fstm::ClaimPropertyAutomaton;
+using core::fts::fstm::FSTM;
+using core::fts::fstm::ProductGraph;
+using core::fts::fstm::ProductGraphPtr;
+using core::features::BoolFeatureExp;
+using core::features::BoolFeatureExpFactory;
+using core::features::FeatureExp;
+using std::string;
+using std::stringstream;
+using std::tr1::dynamic_pointer_cast;
+using std::tr1::shared_ptr;
+
+namespace core {
+namespace checker {
+
+/**
+ * Unit tests for the ProductSearch class. The expected bad products are the
+ * ones found by NestedSearch (see NestedSearchTest).
+ *
+ * @author mwi
+ */
+class ProductSearchTest : public ::testing::Test {
+
+protected:
+    shared_ptr<ProductSearch> target;
+    shared_ptr<BoolFeatureExpFactory> factory;
+    shared_ptr<BoolFeatureExp> fd;
+
+    /**
+     * Sets up the test fixture.
+     */
+    void SetUp() {
+        DVLOG(1) << "ProductSearchTest";
+        Context ctx;
+        factory = ctx.getBoolFeatureExpFactory();
+        fd.reset(factory->getTrue());
+    }
+
+    void init(int test, const string & property) {
+
+        DVLOG(1) << "Test: " << test;
+        DVLOG(1) << "Property: " << property;
+
+        stringstream jsonFstm;
+        writeJsonFstm(test, property, jsonFstm);
+
+        shared_ptr<FSTM> fstm(new FSTM(jsonFstm, *factory));
+        ProductGraphPtr graph(new ProductGraph(fstm->getTransitionTable(),
+                dynamic_pointer_cast<ClaimPropertyAutomaton>(
+                        fstm->getPropertyAutomaton())));
+
+        target = shared_ptr<ProductSearch>(
+                new ProductSearch(fd, graph, factory));
+    }
+
+};
+
+// ____TEST 0____
+
+TEST_F(ProductSearchTest, test0_false) {
+    // Setup
+    init(0, "false");
+    shared_ptr<FeatureExp> badProducts(factory->getTrue());
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+}
+
+TEST_F(ProductSearchTest, test0_safety1) {
+    // Setup
+    init(0, "[] ! state2");
+    shared_ptr<FeatureExp> badProducts(factory->create("f"));
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+    ASSERT_EQ(1, target->getCounterExamples()->count());
+}
+
+TEST_F(ProductSearchTest, test0_liveness1) {
+    // Setup
+    init(0, "[] state1");
+    shared_ptr<FeatureExp> badProducts(factory->create("f"));
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+}
+
+// ____TEST 1____
+
+TEST_F(ProductSearchTest, test1_safety1) {
+    // Setup
+    init(1, "[] (state1 -> (X state2))");
+    shared_ptr<FeatureExp> badProducts(factory->getFalse());
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+    ASSERT_EQ(0, target->getCounterExamples()->count());
+}
+
+TEST_F(ProductSearchTest, test1_safety2) {
+    // Setup
+    init(1, "[] (state2 -> (X state3))");
+    shared_ptr<FeatureExp> badProducts(factory->create("f"));
+    badProducts->disjunction(*factory->create("g"));
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+}
+
+TEST_F(ProductSearchTest, test1_event) {
+    // Setup
+    init(1, "[] ! evt3");
+    shared_ptr<FeatureExp> badProducts(factory->create("f"));
+    badProducts->disjunction(*factory->create("g"));
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+}
+
+TEST_F(ProductSearchTest, test1_oneday2) {
+    // Setup
+    init(1, "<> state3");
+    shared_ptr<FeatureExp> badProducts(factory->create("g"));
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+}
+
+TEST_F(ProductSearchTest, test1_liveness1) {
+    // Setup
+    init(1, "[] <> state1");
+    shared_ptr<FeatureExp> badProducts(factory->create("g"));
+    badProducts->disjunction(*factory->create("h"));
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+}
+
+TEST_F(ProductSearchTest, test1_liveness3) {
+    // Setup
+    init(1, "[] <> state3");
+    shared_ptr<FeatureExp> badProducts(factory->create("g"));
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+}
+
+} // namespace checker
+} // namespace core
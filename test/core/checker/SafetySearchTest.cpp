@@ -0,0 +1,171 @@
+/*
+ * SafetySearchTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "SearchFixtures.hpp"
+
+#include "config/Context.hpp"
+#include "core/checker/SafetySearch.hpp"
+#include "core/fts/fstm/FSTM.hpp"
+#include "core/features/BoolFeatureExp.hpp"
+
+#include <glog/logging.h>
+
+#include <sstream>
+
+using config::Context;
+using core::fts::fstm::FSTM;
+using core::features::BoolFeatureExp;
+using core::features::BoolFeatureExpFactory;
+using core::features::FeatureExp;
+using std::string;
+using std::stringstream;
+using std::tr1::shared_ptr;
+
+namespace core {
+namespace checker {
+
+/**
+ * Unit tests for the SafetySearch class. The expected bad products are the
+ * ones found by NestedSearch (see NestedSearchTest).
+ *
+ * @author mwi
+ */
+class SafetySearchTest : public ::testing::Test {
+
+protected:
+    shared_ptr<SafetySearch> target;
+    shared_ptr<BoolFeatureExpFactory> factory;
+    shared_ptr<BoolFeatureExp> fd;
+
+    /**
+     * Sets up the test fixture.
+     */
+    void SetUp() {
+        DVLOG(1) << "SafetySearchTest";
+        Context ctx;
+        factory = ctx.getBoolFeatureExpFactory();
+        fd.reset(factory->getTrue());
+    }
+
+    void init(int test, const string & property) {
+
+        DVLOG(1) << "Test: " << test;
+        DVLOG(1) << "Property: " << property;
+
+        stringstream jsonFstm;
+        writeJsonFstm(test, property, jsonFstm);
+
+        shared_ptr<FSTM> fstm(new FSTM(jsonFstm, *factory));
+        ASSERT_TRUE(fstm->getPropertyAutomaton()->isSafety());
+
+        target = shared_ptr<SafetySearch>(
+                new SafetySearch(fd, fstm, factory));
+    }
+
+};
+
+// ____TEST 0____
+
+TEST_F(SafetySearchTest, test0_false) {
+    // Setup
+    init(0, "false");
+    shared_ptr<FeatureExp> badProducts(factory->getTrue());
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+}
+
+TEST_F(SafetySearchTest, test0_safety1) {
+    // Setup
+    init(0, "[] ! state2");
+    shared_ptr<FeatureExp> badProducts(factory->create("f"));
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+    ASSERT_EQ(1, target->getCounterExamples()->count());
+}
+
+// ____TEST 1____
+
+TEST_F(SafetySearchTest, test1_safety1) {
+    // Setup
+    init(1, "[] (state1 -> (X state2))");
+    shared_ptr<FeatureExp> badProducts(factory->getFalse());
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+    ASSERT_EQ(0, target->getCounterExamples()->count());
+}
+
+TEST_F(SafetySearchTest, test1_safety2) {
+    // Setup
+    init(1, "[] (state2 -> (X state3))");
+    shared_ptr<FeatureExp> badProducts(factory->create("f"));
+    badProducts->disjunction(*factory->create("g"));
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+}
+
+TEST_F(SafetySearchTest, test1_event) {
+    // Setup
+    init(1, "[] ! evt3");
+    shared_ptr<FeatureExp> badProducts(factory->create("f"));
+    badProducts->disjunction(*factory->create("g"));
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+}
+
+// ____TEST 8____
+
+TEST_F(SafetySearchTest, test8_deadlock) {
+    // Setup
+    init(8, "[] ! state3");
+    shared_ptr<FeatureExp> badProducts(factory->create("g"));
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+    ASSERT_EQ(1, target->getCounterExamples()->count());
+}
+
+TEST_F(SafetySearchTest, test8_deadlockedState) {
+    // Setup
+    init(8, "[] ! state2");
+    // The property automaton reads a state when leaving it, so that it never
+    // reads the deadlocked state2.
+    shared_ptr<FeatureExp> badProducts(factory->getFalse());
+
+    // Exercise
+    target->run();
+
+    // Verify
+    ASSERT_TRUE(badProducts->isEquivalent(*target->getBadProducts()));
+    ASSERT_EQ(0, target->getCounterExamples()->count());
+}
+
+} // namespace checker
+} // namespace core
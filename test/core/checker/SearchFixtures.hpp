@@ -0,0 +1,685 @@
+/*
+ * SearchFixtures.hpp
+ *
+ * Created on 2026-10-19
+ */
+
+#ifndef CORE_CHECKER_SEARCHFIXTURES_HPP
+#define	CORE_CHECKER_SEARCHFIXTURES_HPP
+
+#include <ostream>
+#include <string>
+
+namespace core {
+namespace checker {
+
+/**
+ * @modifies jsonFstm
+ * @effects Writes to 'jsonFstm' the JSON FSTM of the test 'test' with the LTL
+ *           property 'property', except for the test 3 whose property is
+ *           always "[] (state5 -> X state3)". These FSTMs are shared by the
+ *           unit tests of the searches (see NestedSearchTest,
+ *           ProductSearchTest and SafetySearchTest), so that they check the
+ *           same models.
+ */
+inline void writeJsonFstm(int test, const std::string & property,
+        std::ostream & jsonFstm) {
+    switch(test) {
+        case 0:
+            jsonFstm
+                    << " {"
+                    << "   \"FSTM\":{"
+                    << "      \"name\":\"Test1\","
+                    << "      \"generated\":\"Tue Aug 06 10:31:18 CEST 2013\","
+                    << "      \"nbOfLtlProperties\":1,"
+                    << "      \"nbOfTransitions\":6"
+                    << "   },"
+                    << "   \"states\":["
+                    << "      \"state1\","
+                    << "      \"state2\""
+                    << "   ],"
+                    << "   \"events\":["
+                    << "      \"evt\""
+                    << "   ],"
+                    << "   \"ltlProperties\":[\"" + property + "\""
+                    << "   ],"
+                    << "   \"transitions\":[ "
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state1\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"f\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state2\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      }"
+                    << "   ]"
+                    << "}";
+            break;
+        case 1:
+            jsonFstm
+                    << " {"
+                    << "   \"FSTM\":{"
+                    << "      \"name\":\"Test1\","
+                    << "      \"generated\":\"Tue Aug 06 10:31:18 CEST 2013\","
+                    << "      \"nbOfLtlProperties\":1,"
+                    << "      \"nbOfTransitions\":6"
+                    << "   },"
+                    << "   \"states\":["
+                    << "      \"state1\","
+                    << "      \"state2\","
+                    << "      \"state3\","
+                    << "      \"state4\","
+                    << "      \"state5\""
+                    << "   ],"
+                    << "   \"events\":["
+                    << "      \"evt0\","
+                    << "      \"evt1\","
+                    << "      \"evt2\","
+                    << "      \"evt3\","
+                    << "      \"evt4\","
+                    << "      \"evt5\","
+                    << "      \"evt6\","
+                    << "      \"evt7\""
+                    << "   ],"
+                    << "   \"ltlProperties\":[\"" + property + "\""
+                    << "   ],"
+                    << "   \"transitions\":[ "
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt1\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state2\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt2\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state2\","
+                    << "         \"target\":\"state4\","
+                    << "         \"event\":\"evt3\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"f || g\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state3\","
+                    << "         \"target\":\"state1\","
+                    << "         \"event\":\"evt4\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state3\","
+                    << "         \"target\":\"state4\","
+                    << "         \"event\":\"evt5\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"h\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state4\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt6\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"f || h\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state4\","
+                    << "         \"target\":\"state4\","
+                    << "         \"event\":\"evt7\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"g\""
+                    << "      }"
+                    << "   ]"
+                    << "}";
+            break;
+        case 2 :
+            jsonFstm
+                    << "{"
+                    << "   \"FSTM\":{"
+                    << "      \"name\":\"Test\","
+                    << "      \"generated\":\"Tue Aug 06 10:31:18 CEST 2013\","
+                    << "      \"nbOfLtlProperties\":1,"
+                    << "      \"nbOfTransitions\":12"
+                    << "   },"
+                    << "   \"states\":["
+                    << "      \"state1\","
+                    << "      \"state2\","
+                    << "      \"state3\","
+                    << "      \"state4\","
+                    << "      \"state5\","
+                    << "      \"state6\","
+                    << "      \"state7\","
+                    << "      \"state8\","
+                    << "      \"state9\","
+                    << "      \"state10\""
+                    << "   ],"
+                    << "   \"events\":["
+                    << "      \"evt\""
+                    << "   ],"
+                    << "   \"ltlProperties\":[\"" + property + "\""
+                    << "   ],"
+                    << "   \"transitions\":[ "
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state2\","
+                    << "         \"target\":\"state4\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state3\","
+                    << "         \"target\":\"state4\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state4\","
+                    << "         \"target\":\"state6\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"!(f)\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state4\","
+                    << "         \"target\":\"state7\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state5\","
+                    << "         \"target\":\"state5\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state6\","
+                    << "         \"target\":\"state8\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state7\","
+                    << "         \"target\":\"state9\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state8\","
+                    << "         \"target\":\"state10\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state9\","
+                    << "         \"target\":\"state10\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state9\","
+                    << "         \"target\":\"state6\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"f\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state10\","
+                    << "         \"target\":\"state1\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      }"
+                    << "   ]"
+                    << "}";
+            break;
+        case 3 :
+            jsonFstm
+                    << "{"
+                    << "   \"FSTM\":{"
+                    << "      \"name\":\"Test\","
+                    << "      \"generated\":\"Tue Aug 06 10:31:18 CEST 2013\","
+                    << "      \"nbOfLtlProperties\":1,"
+                    << "      \"nbOfTransitions\":9"
+                    << "   },"
+                    << "   \"states\":["
+                    << "      \"state1\","
+                    << "      \"state2\","
+                    << "      \"state3\","
+                    << "      \"state4\","
+                    << "      \"state5\","
+                    << "      \"state6\""
+                    << "   ],"
+                    << "   \"events\":["
+                    << "      \"evt\""
+                    << "   ],"
+                    << "   \"ltlProperties\":[\"[] (state5 -> X state3)\""
+                    << "   ],"
+                    << "   \"transitions\":[ "
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"f\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"!(f)\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state2\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"g\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state2\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"!(g)\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state3\","
+                    << "         \"target\":\"state4\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"h\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state4\","
+                    << "         \"target\":\"state5\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"h\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state5\","
+                    << "         \"target\":\"state6\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"h\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state5\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"h\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state6\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"h\""
+                    << "      }"
+                    << "   ]"
+                    << "}";
+            break;
+        case 4 :
+            jsonFstm
+                    << "{"
+                    << "   \"FSTM\":{"
+                    << "      \"name\":\"Test\","
+                    << "      \"generated\":\"Tue Aug 06 10:31:18 CEST 2013\","
+                    << "      \"nbOfLtlProperties\":1,"
+                    << "      \"nbOfTransitions\":6"
+                    << "   },"
+                    << "   \"states\":["
+                    << "      \"state1\","
+                    << "      \"state2\","
+                    << "      \"state3\","
+                    << "      \"state4\""
+                    << "   ],"
+                    << "   \"events\":["
+                    << "      \"evt\""
+                    << "   ],"
+                    << "   \"ltlProperties\":[\"" + property + "\""
+                    << "   ],"
+                    << "   \"transitions\":[ "
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state2\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state3\","
+                    << "         \"target\":\"state4\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state4\","
+                    << "         \"target\":\"state1\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"f\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state4\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state2\","
+                    << "         \"target\":\"state4\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      }"
+                    << "   ]"
+                    << "}";
+            break;
+        case 5 :
+            jsonFstm
+                    << "{"
+                    << "   \"FSTM\":{"
+                    << "      \"name\":\"Test\","
+                    << "      \"generated\":\"Tue Aug 06 10:31:18 CEST 2013\","
+                    << "      \"nbOfLtlProperties\":1,"
+                    << "      \"nbOfTransitions\":6"
+                    << "   },"
+                    << "   \"states\":["
+                    << "      \"state1\","
+                    << "      \"state2\","
+                    << "      \"state3\","
+                    << "      \"state4\""
+                    << "   ],"
+                    << "   \"events\":["
+                    << "      \"evt\""
+                    << "   ],"
+                    << "   \"ltlProperties\":[\"" + property + "\""
+                    << "   ],"
+                    << "   \"transitions\":[ "
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state4\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"f\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state2\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state2\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"g\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state3\","
+                    << "         \"target\":\"state1\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state4\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      }"
+                    << "   ]"
+                    << "}";
+            break;
+        case 6 :
+            jsonFstm
+                    << "{"
+                    << "   \"FSTM\":{"
+                    << "      \"name\":\"Test\","
+                    << "      \"generated\":\"Tue Aug 06 10:31:18 CEST 2013\","
+                    << "      \"nbOfLtlProperties\":1,"
+                    << "      \"nbOfTransitions\":7"
+                    << "   },"
+                    << "   \"states\":["
+                    << "      \"state1\","
+                    << "      \"state2\","
+                    << "      \"state3\","
+                    << "      \"state4\","
+                    << "      \"state5\""
+                    << "   ],"
+                    << "   \"events\":["
+                    << "      \"evt\""
+                    << "   ],"
+                    << "   \"ltlProperties\":[\"" + property + "\""
+                    << "   ],"
+                    << "   \"transitions\":[ "
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state2\","
+                    << "         \"target\":\"state1\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"f\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state2\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"!(f)\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state3\","
+                    << "         \"target\":\"state4\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state4\","
+                    << "         \"target\":\"state5\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state5\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      }"
+                    << "   ]"
+                    << "}";
+            break;
+        case 7 :
+            jsonFstm
+                    << "{"
+                    << "   \"FSTM\":{"
+                    << "      \"name\":\"Test\","
+                    << "      \"generated\":\"Tue Aug 06 10:31:18 CEST 2013\","
+                    << "      \"nbOfLtlProperties\":1,"
+                    << "      \"nbOfTransitions\":6"
+                    << "   },"
+                    << "   \"states\":["
+                    << "      \"state1\","
+                    << "      \"state2\","
+                    << "      \"state3\","
+                    << "      \"state4\","
+                    << "      \"state5\""
+                    << "   ],"
+                    << "   \"events\":["
+                    << "      \"evt\""
+                    << "   ],"
+                    << "   \"ltlProperties\":[\"" + property + "\""
+                    << "   ],"
+                    << "   \"transitions\":[ "
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state2\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state2\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state3\","
+                    << "         \"target\":\"state4\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state4\","
+                    << "         \"target\":\"state5\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state5\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      }"
+                    << "   ]"
+                    << "}";
+            break;
+        case 8:
+            jsonFstm
+                    << " {"
+                    << "   \"FSTM\":{"
+                    << "      \"name\":\"Test\","
+                    << "      \"generated\":\"Tue Aug 06 10:31:18 CEST 2013\","
+                    << "      \"nbOfLtlProperties\":1,"
+                    << "      \"nbOfTransitions\":3"
+                    << "   },"
+                    << "   \"states\":["
+                    << "      \"state1\","
+                    << "      \"state2\","
+                    << "      \"state3\""
+                    << "   ],"
+                    << "   \"events\":["
+                    << "      \"evt\""
+                    << "   ],"
+                    << "   \"ltlProperties\":[\"" + property + "\""
+                    << "   ],"
+                    << "   \"transitions\":[ "
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state2\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"f\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state1\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":\"g\""
+                    << "      },"
+                    << "      {"
+                    << "         \"source\":\"state3\","
+                    << "         \"target\":\"state3\","
+                    << "         \"event\":\"evt\","
+                    << "         \"guard\":null,"
+                    << "         \"featureExp\":null"
+                    << "      }"
+                    << "   ]"
+                    << "}";
+            break;
+    }
+}
+
+} // namespace checker
+} // namespace core
+
+#endif	/* CORE_CHECKER_SEARCHFIXTURES_HPP */
@@ -0,0 +1,138 @@
+/*
+ * FDCacheTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "config/Context.hpp"
+#include "core/fd/FDCache.hpp"
+#include "core/features/BoolFeatureExp.hpp"
+#include "core/features/BoolFeatureExpFactory.hpp"
+#include "core/features/FeatureExp.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <tr1/memory>
+
+#include <unistd.h>
+
+using config::Context;
+using core::features::BoolFeatureExpFactory;
+using core::features::FeatureExp;
+using std::ofstream;
+using std::string;
+using std::tr1::shared_ptr;
+
+namespace core {
+namespace fd {
+
+/**
+ * Unit tests for the FDCache class. The entries are stored in a temporary
+ * directory.
+ *
+ * @author mwi
+ */
+class FDCacheTest : public ::testing::Test {
+
+protected:
+    Context ctx;
+    shared_ptr<BoolFeatureExpFactory> factory;
+    shared_ptr<FDCache> target;
+    string directory;
+
+    /**
+     * Sets up the test fixture.
+     */
+    void SetUp() {
+        factory = ctx.getBoolFeatureExpFactory();
+
+        char name[] = "/tmp/fdCacheXXXXXX";
+        directory = mkdtemp(name) ? name : "/tmp";
+        target = shared_ptr<FDCache>(new FDCache(directory, *factory));
+    }
+
+    /**
+     * Tears down the test fixture.
+     */
+    void TearDown() {
+        target.reset();
+        rmdir(directory.c_str());
+    }
+
+    /**
+     * @return the path of the entry 'key' of the target.
+     */
+    string getPath(const string & key) const {
+        return directory + "/" + key + ".fd";
+    }
+};
+
+TEST_F(FDCacheTest, makeKey) {
+    // Exercise & Verify
+    ASSERT_EQ(FDCache::makeKey("root A", ""), FDCache::makeKey("root A", ""));
+    ASSERT_EQ(16u, FDCache::makeKey("root A", "").length());
+    ASSERT_NE(FDCache::makeKey("root A", ""), FDCache::makeKey("root B", ""));
+    ASSERT_NE(FDCache::makeKey("root A", ""), FDCache::makeKey("root A", "A;"));
+    ASSERT_NE(FDCache::makeKey("root A", "B"), FDCache::makeKey("root AB", ""));
+}
+
+TEST_F(FDCacheTest, storeLoad) {
+    // Setup
+    shared_ptr<FeatureExp> fd(factory->create("FDCacheTest_A"));
+    shared_ptr<FeatureExp> b(factory->create("FDCacheTest_B"));
+    shared_ptr<FeatureExp> c(factory->create("FDCacheTest_C"));
+    b->negation();
+    b->disjunction(*c);
+    fd->conjunction(*b);
+    const string key = FDCache::makeKey("storeLoad", "");
+
+    // Exercise
+    target->store(key, *fd);
+    shared_ptr<FeatureExp> loaded(target->load(key));
+    std::remove(getPath(key).c_str());
+
+    // Verify
+    ASSERT_TRUE(loaded);
+    ASSERT_TRUE(loaded->isEquivalent(*fd));
+}
+
+TEST_F(FDCacheTest, storeLoadConstant) {
+    // Setup
+    shared_ptr<FeatureExp> fd(factory->getFalse());
+    const string key = FDCache::makeKey("storeLoadConstant", "");
+
+    // Exercise
+    target->store(key, *fd);
+    shared_ptr<FeatureExp> loaded(target->load(key));
+    std::remove(getPath(key).c_str());
+
+    // Verify
+    ASSERT_TRUE(loaded);
+    ASSERT_TRUE(loaded->isEquivalent(*fd));
+}
+
+TEST_F(FDCacheTest, loadMissing) {
+    // Exercise & Verify
+    ASSERT_FALSE(target->load(FDCache::makeKey("loadMissing", "")));
+}
+
+TEST_F(FDCacheTest, loadCorrupted) {
+    // Setup
+    const string key = FDCache::makeKey("loadCorrupted", "");
+    ofstream entry(getPath(key).c_str(), std::ios::binary);
+    entry << "not an FD cache entry";
+    entry.close();
+
+    // Exercise
+    FeatureExp * loaded = target->load(key);
+    std::remove(getPath(key).c_str());
+
+    // Verify
+    ASSERT_FALSE(loaded);
+}
+
+} // namespace fd
+} // namespace core
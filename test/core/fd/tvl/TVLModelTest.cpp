@@ -7,6 +7,7 @@
 #include "gtest/gtest.h"
 
 #include "config/Context.hpp"
+#include "core/fd/FDCache.hpp"
 #include "core/fd/tvl/TVLModel.hpp"
 #include "core/features/BoolFeatureExp.hpp"
 #include "core/features/FeatureExp.hpp"
@@ -17,8 +18,14 @@
 
 #include <glog/logging.h>
 
+#include <cstdio>
+#include <sstream>
+
+#include <unistd.h>
+
 using config::Context;
 
+using core::fd::FDCache;
 using core::fd::tvl::TVLModel;
 
 using core::features::FeatureExp;
@@ -28,6 +35,7 @@ using core::features::BoolFeatureExpFactory;
 using math::BoolFctFactory;
 using math::BoolVar;
 
+using std::string;
 using std::stringstream;
 using std::tr1::shared_ptr;
 
@@ -109,7 +117,7 @@ protected:
     }
 };
 
-/*TEST_F(TVLModelTest, and) {
+TEST_F(TVLModelTest, and) {
     // Setup
     stringstream stream;
     stream
@@ -121,12 +129,58 @@ protected:
     TVLModel model(stream, fctFactory, expFactory);
 
     // Exercise
-    shared_ptr<FeatureExp> exp = model.toFeatureExp();
+    shared_ptr<FeatureExp> exp(model.toFeatureExp());
+    createExp();
+
+    // Verify
+    ASSERT_TRUE(exp->isEquivalent(*exp1));
+}
+
+TEST_F(TVLModelTest, filter) {
+    // Setup
+    stringstream stream;
+    stream
+            << "root TVLModelTest_Main group someOf {\n"
+            << "TVLModelTest_a,\n"
+            << "TVLModelTest_b\n"
+            << "}";
+
+    TVLModel model(stream, "TVLModelTest_a && TVLModelTest_b;", fctFactory,
+            expFactory);
+
+    // Exercise
+    shared_ptr<FeatureExp> exp(model.toFeatureExp());
+    createExp();
+
+    // Verify
+    ASSERT_TRUE(exp->isEquivalent(*exp1));
+}
+
+TEST_F(TVLModelTest, cache) {
+    // Setup
+    const string source(
+            "root TVLModelTest_Main group allOf {\n"
+            "TVLModelTest_a,\n"
+            "TVLModelTest_b\n"
+            "}");
+    char name[] = "/tmp/tvlModelXXXXXX";
+    ASSERT_TRUE(mkdtemp(name));
+    const string directory(name);
+    FDCache cache(directory, *expFactory);
+    stringstream stream(source);
+    TVLModel model(stream, fctFactory, expFactory, &cache);
+
+    // Exercise
+    stringstream cachedStream(source);
+    TVLModel cachedModel(cachedStream, fctFactory, expFactory, &cache);
+    shared_ptr<FeatureExp> exp(cachedModel.toFeatureExp());
     createExp();
+    std::remove((directory + "/" + FDCache::makeKey(source, "") + ".fd").c_str());
+    rmdir(directory.c_str());
 
     // Verify
     ASSERT_TRUE(exp->isEquivalent(*exp1));
-}*/
+}
 
 } // namespace tvl
 } // namespace fd
@@ -0,0 +1,187 @@
+/*
+ * TVLParserTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "config/Context.hpp"
+#include "core/fd/tvl/TVLParser.hpp"
+#include "core/features/FeatureExp.hpp"
+#include "core/features/FeatureExpGenVisitor.hpp"
+
+#include "util/parser/BoolExp.hpp"
+#include "util/parser/BoolExpParser.hpp"
+
+#include <stdexcept>
+
+using config::Context;
+
+using core::features::BoolFeatureExpFactoryPtr;
+using core::features::FeatureExpGenVisitor;
+using core::features::FeatureExpPtr;
+
+using util::parser::BoolExpParser;
+
+using std::logic_error;
+using std::string;
+
+namespace core {
+namespace fd {
+namespace tvl {
+
+/**
+ * Unit tests for the TVLParser class.
+ *
+ * @author mwi
+ */
+class TVLParserTest : public ::testing::Test {
+
+protected:
+    /** Context */
+    Context ctx;
+
+    /** BoolFeatureExpFactory */
+    BoolFeatureExpFactoryPtr expFactory;
+
+    void SetUp() {
+        expFactory = ctx.getBoolFeatureExpFactory();
+    }
+
+    void TearDown() {
+        // Nothing here
+    }
+
+    /**
+     * @return the feature expression of the Boolean expression 'exp'.
+     */
+    FeatureExpPtr makeExp(const string & exp) {
+        FeatureExpGenVisitor visitor(*expFactory);
+        BoolExpParser(exp).parse()->accept(visitor);
+        return visitor.getFeatureExp();
+    }
+
+    /**
+     * @return the feature expression of the TVL model 'model'.
+     */
+    FeatureExpPtr parse(const string & model) {
+        return TVLParser(model, *expFactory).parse();
+    }
+};
+
+TEST_F(TVLParserTest, parse_allOf) {
+    // Exercise
+    FeatureExpPtr exp = parse(
+            "root TVLParserTest_M group allOf { TVLParserTest_a, TVLParserTest_b }");
+
+    // Verify
+    ASSERT_TRUE(exp->isEquivalent(*makeExp(
+            "TVLParserTest_M && TVLParserTest_a && TVLParserTest_b")));
+}
+
+TEST_F(TVLParserTest, parse_oneOf) {
+    // Exercise
+    FeatureExpPtr exp = parse(
+            "root TVLParserTest_M {\n"
+            "  group oneOf { TVLParserTest_a, TVLParserTest_b }\n"
+            "}");
+
+    // Verify
+    ASSERT_TRUE(exp->isEquivalent(*makeExp(
+            "TVLParserTest_M && (TVLParserTest_a && !(TVLParserTest_b)"
+            " || !(TVLParserTest_a) && TVLParserTest_b)")));
+}
+
+TEST_F(TVLParserTest, parse_cardinality) {
+    // Exercise
+    FeatureExpPtr exp = parse(
+            "root TVLParserTest_M group [1..*] {\n"
+            "  TVLParserTest_a,\n"
+            "  TVLParserTest_b,\n"
+            "  opt TVLParserTest_c\n"
+            "}");
+
+    // Verify
+    ASSERT_TRUE(exp->isEquivalent(*makeExp(
+            "TVLParserTest_M && (TVLParserTest_a || TVLParserTest_b)")));
+}
+
+TEST_F(TVLParserTest, parse_nested) {
+    // Exercise
+    FeatureExpPtr exp = parse(
+            "root TVLParserTest_M group allOf {\n"
+            "  opt TVLParserTest_a group oneOf { TVLParserTest_b, TVLParserTest_c }\n"
+            "}");
+
+    // Verify
+    ASSERT_TRUE(exp->isEquivalent(*makeExp(
+            "TVLParserTest_M && !(TVLParserTest_b && TVLParserTest_c)"
+            " && (TVLParserTest_a || !(TVLParserTest_b || TVLParserTest_c))"
+            " && (!(TVLParserTest_a) || TVLParserTest_b || TVLParserTest_c)")));
+}
+
+TEST_F(TVLParserTest, parse_shared) {
+    // Exercise
+    FeatureExpPtr exp = parse(
+            "root TVLParserTest_M group [0..*] {\n"
+            "  opt TVLParserTest_a group [0..*] { opt shared TVLParserTest_s },\n"
+            "  opt TVLParserTest_b group [0..*] { opt shared TVLParserTest_s }\n"
+            "}");
+
+    // Verify
+    ASSERT_TRUE(exp->isEquivalent(*makeExp(
+            "TVLParserTest_M"
+            " && (!(TVLParserTest_s) || TVLParserTest_a || TVLParserTest_b)")));
+}
+
+TEST_F(TVLParserTest, parse_constraints) {
+    // Exercise
+    FeatureExpPtr exp = parse(
+            "// A model with constraints\n"
+            "root TVLParserTest_M {\n"
+            "  group someOf { TVLParserTest_a, TVLParserTest_b }\n"
+            "  TVLParserTest_a excludes TVLParserTest_b; /* xor */\n"
+            "}\n"
+            "TVLParserTest_b {\n"
+            "  ifIn: TVLParserTest_c <-> true;\n"
+            "}\n");
+
+    // Verify
+    ASSERT_TRUE(exp->isEquivalent(*makeExp(
+            "TVLParserTest_M && (TVLParserTest_a && !(TVLParserTest_b)"
+            " || !(TVLParserTest_a) && TVLParserTest_b && TVLParserTest_c)")));
+}
+
+TEST_F(TVLParserTest, parseBody) {
+    // Setup
+    TVLParser parser("TVLParserTest_a -> TVLParserTest_b;", *expFactory);
+
+    // Exercise
+    FeatureExpPtr exp = parser.parseBody("TVLParserTest_M");
+
+    // Verify
+    ASSERT_TRUE(exp->isEquivalent(*makeExp(
+            "!(TVLParserTest_a) || TVLParserTest_b")));
+}
+
+TEST_F(TVLParserTest, parse_noRoot) {
+    // Exercise & Verify
+    ASSERT_THROW(parse("TVLParserTest_M group allOf { TVLParserTest_a }"),
+            logic_error);
+}
+
+TEST_F(TVLParserTest, parse_attribute) {
+    // Exercise & Verify
+    ASSERT_THROW(parse("root TVLParserTest_M { int size; }"), logic_error);
+}
+
+TEST_F(TVLParserTest, parse_syntaxError) {
+    // Exercise & Verify
+    ASSERT_THROW(parse("root TVLParserTest_M group allOf { TVLParserTest_a, }"),
+            logic_error);
+}
+
+} // namespace tvl
+} // namespace fd
+} // namespace core
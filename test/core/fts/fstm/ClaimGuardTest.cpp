@@ -0,0 +1,147 @@
+/*
+ * ClaimGuardTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "core/fts/fstm/ClaimGuard.hpp"
+#include "core/fts/fstm/FstmEvalVisitor.hpp"
+#include "util/parser/AndExp.hpp"
+#include "util/parser/BoolExp.hpp"
+#include "util/parser/BoolExpParser.hpp"
+#include "util/parser/BoolValue.hpp"
+#include "util/parser/NotExp.hpp"
+#include "util/parser/OrExp.hpp"
+#include "util/parser/Var.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace util::parser;
+using std::string;
+using std::vector;
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+/**
+ * Unit tests for the ClaimGuard class.
+ *
+ * @author mwi
+ */
+class ClaimGuardTest : public ::testing::Test {
+
+protected:
+    ClaimGuard::VariableTable variables;
+    vector<string> names;
+
+    void SetUp() {
+        names.push_back("FCPowerUp");
+        names.push_back("FCMotorStopped");
+        names.push_back("CoastCommand");
+        names.push_back("Unused");
+    }
+
+    /**
+     * Asserts the guard 'exp' compiled has the same value as evaluated by
+     * FstmEvalVisitor for all the pairs of state and event of the fixture.
+     */
+    void assertSameAsVisitor(const BoolExpPtr & exp) {
+        ClaimGuard guard(*exp, variables);
+        vector<string>::const_iterator s, e;
+        for (s = names.begin(); s != names.end(); ++s) {
+            for (e = names.begin(); e != names.end(); ++e) {
+                FstmEvalVisitor visitor(*s, *e);
+                exp->accept(visitor);
+                ASSERT_EQ(visitor.isTrue(), guard.eval(
+                        ClaimGuard::lookup(variables, *s),
+                        ClaimGuard::lookup(variables, *e)))
+                        << *s << ", " << *e;
+            }
+        }
+    }
+};
+
+TEST_F(ClaimGuardTest, boolValue) {
+    ClaimGuard trueGuard(BoolValue(true), variables);
+    ClaimGuard falseGuard(BoolValue(false), variables);
+
+    ASSERT_TRUE(trueGuard.eval(ClaimGuard::NO_VARIABLE,
+            ClaimGuard::NO_VARIABLE));
+    ASSERT_FALSE(falseGuard.eval(ClaimGuard::NO_VARIABLE,
+            ClaimGuard::NO_VARIABLE));
+    ASSERT_TRUE(variables.empty());
+}
+
+TEST_F(ClaimGuardTest, var) {
+    // Exercise
+    ClaimGuard guard(Var("fCPowerUp"), variables);
+    int var = ClaimGuard::lookup(variables, "FCPowerUp");
+
+    // Verify
+    ASSERT_NE(ClaimGuard::NO_VARIABLE, var);
+    ASSERT_TRUE(guard.eval(var, ClaimGuard::NO_VARIABLE));
+    ASSERT_TRUE(guard.eval(ClaimGuard::NO_VARIABLE, var));
+    ASSERT_FALSE(guard.eval(ClaimGuard::NO_VARIABLE,
+            ClaimGuard::NO_VARIABLE));
+}
+
+TEST_F(ClaimGuardTest, lookup_unknown) {
+    ClaimGuard guard(Var("fCPowerUp"), variables);
+
+    ASSERT_EQ(ClaimGuard::NO_VARIABLE,
+            ClaimGuard::lookup(variables, "Unused"));
+}
+
+TEST_F(ClaimGuardTest, sharedVariables) {
+    // Exercise
+    ClaimGuard guard1(Var("fCPowerUp"), variables);
+    ClaimGuard guard2(Var("fCPowerUp"), variables);
+    ClaimGuard guard3(Var("coastCommand"), variables);
+
+    // Verify
+    ASSERT_EQ(2u, variables.size());
+}
+
+TEST_F(ClaimGuardTest, stateAndEvent) {
+    BoolExpPtr fCPowerUp(new Var("fCPowerUp"));
+    BoolExpPtr notFCPowerUp(new NotExp(fCPowerUp));
+    BoolExpPtr coastCommand(new Var("coastCommand"));
+
+    assertSameAsVisitor(BoolExpPtr(new AndExp(notFCPowerUp, coastCommand)));
+}
+
+TEST_F(ClaimGuardTest, deepGuard) {
+    // Setup: a guard whose evaluation stack is deeper than a local stack
+    BoolExpPtr exp(new Var("fCPowerUp"));
+    for (unsigned int i = 0; i < 100; i++) {
+        BoolExpPtr unused(new Var("unused"));
+        exp = BoolExpPtr(new OrExp(unused, exp));
+    }
+
+    // Exercise & Verify
+    assertSameAsVisitor(exp);
+}
+
+TEST_F(ClaimGuardTest, parsedGuards) {
+    const char * guards[] = {
+        "1",
+        "fCPowerUp",
+        "!(fCPowerUp) && !(fCMotorStopped)",
+        "(fCPowerUp || coastCommand) && !(fCMotorStopped || 0)",
+        "!(!(!(fCMotorStopped))) || (coastCommand && fCPowerUp)",
+        "(fCPowerUp && (coastCommand || (fCMotorStopped && !(coastCommand))))"
+    };
+    for (unsigned int i = 0; i < sizeof(guards) / sizeof(guards[0]); i++) {
+        const string guard(guards[i]);
+        BoolExpParser parser(guard);
+        assertSameAsVisitor(parser.parse());
+    }
+}
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
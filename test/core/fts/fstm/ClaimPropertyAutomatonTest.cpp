@@ -15,6 +15,7 @@
 #include "core/fts/fstm/ClaimPropertyAutomaton.hpp"
 #include "core/fts/fstm/ClaimPropertyState.hpp"
 #include "core/fts/fstm/ClaimPropertyTransition.hpp"
+#include "core/fts/fstm/ClaimGuard.hpp"
 #include "neverclaim/ClaimState.hpp"
 #include "util/Generator.hpp"
 
@@ -214,6 +215,86 @@ TEST_F(ClaimPropertyAutomatonTest, resetTransitions) {
     ASSERT_EQ(expected, actual);
 }
 
+TEST_F(ClaimPropertyAutomatonTest, reduce_unreachableAcceptance) {
+    // Setup
+    shared_ptr<FSTM> fstm = dynamic_pointer_cast<FSTM>(fts);
+
+    // Exercise
+    ClaimPropertyAutomaton automaton("[]!(state4)", FstmState::makeState(
+            "State1"), fstm->getTransitionTable());
+
+    // Verify
+    ASSERT_EQ(1u, automaton.getNbOfClaimStates());
+    ASSERT_EQ(claimState1, automaton.getClaimState(0));
+    ASSERT_EQ(automaton.firstIndexOf(0), automaton.endIndexOf(0));
+    ASSERT_FALSE(automaton.hasNextTransition());
+}
+
+TEST_F(ClaimPropertyAutomatonTest, reduce_validGuard) {
+    // Setup
+    shared_ptr<FSTM> fstm = dynamic_pointer_cast<FSTM>(fts);
+
+    // Exercise
+    ClaimPropertyAutomaton automaton("[]!(state1 || state2 || state3)",
+            FstmState::makeState("State1"), fstm->getTransitionTable());
+
+    // Verify
+    ASSERT_EQ(2u, automaton.getNbOfClaimStates());
+    ASSERT_EQ(claimState2, automaton.getClaimState(
+            automaton.getTargetOf(automaton.firstIndexOf(0) + 1)));
+    for (unsigned int i = automaton.firstIndexOf(0);
+            i < automaton.endIndexOf(0); i++) {
+        ASSERT_TRUE(automaton.getGuardOf(i).eval(ClaimGuard::NO_VARIABLE,
+                ClaimGuard::NO_VARIABLE));
+    }
+}
+
+TEST_F(ClaimPropertyAutomatonTest, reduce_keepsGuards) {
+    // Setup
+    shared_ptr<ClaimPropertyAutomaton> automaton =
+            dynamic_pointer_cast<ClaimPropertyAutomaton>(target);
+    int state1Var = automaton->getVariable("State1");
+    int state2Var = automaton->getVariable("State2");
+
+    // Exercise & Verify
+    ASSERT_EQ(2u, automaton->getNbOfClaimStates());
+    ASSERT_EQ(2u, automaton->endIndexOf(0) - automaton->firstIndexOf(0));
+    ASSERT_TRUE(automaton->getGuardOf(0).eval(state1Var,
+            ClaimGuard::NO_VARIABLE));
+    ASSERT_FALSE(automaton->getGuardOf(1).eval(state1Var,
+            ClaimGuard::NO_VARIABLE));
+    ASSERT_TRUE(automaton->getGuardOf(1).eval(state2Var,
+            ClaimGuard::NO_VARIABLE));
+}
+
+TEST_F(ClaimPropertyAutomatonTest, isSafety) {
+    // Exercise & Verify
+    ASSERT_TRUE(target->isSafety());
+}
+
+TEST_F(ClaimPropertyAutomatonTest, isSafety_false) {
+    // Setup
+    shared_ptr<FSTM> fstm = dynamic_pointer_cast<FSTM>(fts);
+
+    // Exercise
+    ClaimPropertyAutomaton automaton("[] <> state2", FstmState::makeState(
+            "State1"), fstm->getTransitionTable());
+
+    // Verify
+    ASSERT_FALSE(automaton.isSafety());
+}
+
+TEST_F(ClaimPropertyAutomatonTest, getComponent) {
+    // Setup
+    shared_ptr<ClaimPropertyAutomaton> automaton =
+            dynamic_pointer_cast<ClaimPropertyAutomaton>(target);
+
+    // Exercise & Verify
+    ASSERT_EQ(0, target->getComponent());
+    ASSERT_EQ(0, automaton->getComponentOf(0));
+    ASSERT_EQ(PropertyAutomaton::NO_COMPONENT, automaton->getComponentOf(1));
+}
+
 } // namespace fstm
 } // namespace fts
 } // namespace core
@@ -0,0 +1,199 @@
+/*
+ * CompiledFstmParserTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "config/Context.hpp"
+#include "core/features/BoolFeatureExpFactory.hpp"
+#include "core/fts/fstm/CompiledFstmParser.hpp"
+#include "core/fts/fstm/FstmTransition.hpp"
+#include "core/fts/fstm/FstmState.hpp"
+#include "core/fts/fstm/FstmEvent.hpp"
+#include "core/features/BoolFeatureExp.hpp"
+
+#include "util/NotPossibleException.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <tr1/memory>
+
+#include <unistd.h>
+
+using config::Context;
+using core::features::BoolFeatureExpFactory;
+using core::features::FeatureExp;
+using std::ofstream;
+using std::string;
+using std::stringstream;
+using std::tr1::shared_ptr;
+using util::Generator;
+using util::NotPossibleException;
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+/**
+ * Unit tests for the CompiledFstmParser class. The FSTM of JsonParserTest is
+ * compiled into a temporary file which is then parsed back.
+ *
+ * @author mwi
+ */
+class CompiledFstmParserTest : public ::testing::Test {
+
+protected:
+    shared_ptr<CompiledFstmParser> target;
+    shared_ptr<BoolFeatureExpFactory> factory;
+    string path;
+
+    /**
+     * Sets up the test fixture.
+     */
+    void SetUp() {
+        Context ctx;
+        factory = ctx.getBoolFeatureExpFactory();
+
+        stringstream jsonFstm;
+        jsonFstm << "{"
+                << "\"FSTM\":{ "
+                << "\"name\":\"Sample2\","
+                << "\"generated\":\"Thu Jul 25 11:01:23 CEST 2013\","
+                << "\"nbOfLtlProperties\":1, "
+                << "\"nbOfTransitions\":2 "
+                << "},"
+                << "\"states\":[\"State1\", \"State2\" ],"
+                << "\"events\":[\"evt1\", \"evt2\", \"evt3\" ],"
+                << "\"ltlProperties\":[\"[](<>A)\"],"
+                << "\"transitions\":[ "
+                << "{ \"source\":\"State1\","
+                << "\"target\":\"State2\", "
+                << "\"event\":\"evt1\","
+                << "\"guard\":\"\", "
+                << "\"featureExp\":\"!(A) && (B && B) || !(C && !(B) || "
+                << "(((C && B))))\" },"
+                << "{\"source\":\"State2\","
+                << "\"target\":\"State1\","
+                << "\"event\":\"evt3\","
+                << "\"guard\":\"\","
+                << "\"featureExp\":null }"
+                << "] }";
+
+        path = createTemporaryFile();
+        ofstream compiledFstm(path.c_str(), std::ios::binary);
+        ctx.compileFSTM(jsonFstm, compiledFstm);
+        compiledFstm.close();
+
+        target = shared_ptr<CompiledFstmParser>(
+                new CompiledFstmParser(path, *factory));
+    }
+
+    /**
+     * Tears down the test fixture.
+     */
+    void TearDown() {
+        target.reset();
+        std::remove(path.c_str());
+    }
+
+    /**
+     * @return the path of a new empty temporary file.
+     */
+    static string createTemporaryFile() {
+        char name[] = "/tmp/compiledFstmXXXXXX";
+        int fd = mkstemp(name);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return name;
+    }
+};
+
+TEST_F(CompiledFstmParserTest, isCompiled) {
+    // Verify
+    ASSERT_TRUE(CompiledFstmParser::isCompiled(path));
+}
+
+TEST_F(CompiledFstmParserTest, getNbOfTransitions) {
+    // Exercise
+    int actualNbOfTransition = target->getNbOfTransitions();
+
+    // Verify
+    ASSERT_EQ(2, actualNbOfTransition);
+}
+
+TEST_F(CompiledFstmParserTest, transitions) {
+    // Exercise
+    FstmTransitionGeneratorPtr g = target->transitions();
+
+    // Verify
+    ASSERT_TRUE(g->hasNext());
+    shared_ptr<FstmTransition> t = g->next();
+    ASSERT_EQ("State1", t->getSource()->getName());
+    ASSERT_EQ("State2", t->getTarget()->getName());
+    ASSERT_EQ("evt1", t->getEvent()->getName());
+    shared_ptr<FeatureExp> expectedExp(factory->create("A"));
+    expectedExp->negation();
+    expectedExp->conjunction(*factory->create("B"));
+    shared_ptr<FeatureExp> rhsOne(factory->create("B"));
+    rhsOne->negation();
+    rhsOne->conjunction(*factory->create("C"));
+    shared_ptr<FeatureExp> rhsTwo(factory->create("C"));
+    rhsTwo->conjunction(*factory->create("B"));
+    rhsOne->disjunction(*rhsTwo);
+    rhsOne->negation();
+    expectedExp->disjunction(*rhsOne);
+    ASSERT_TRUE(t->getFeatureExp()->isEquivalent(*expectedExp));
+
+    ASSERT_TRUE(g->hasNext());
+    t = g->next();
+    ASSERT_EQ("State2", t->getSource()->getName());
+    ASSERT_EQ("State1", t->getTarget()->getName());
+    ASSERT_EQ("evt3", t->getEvent()->getName());
+    ASSERT_TRUE(factory->getTrue()->isEquivalent(*t->getFeatureExp()));
+    ASSERT_FALSE(g->hasNext());
+}
+
+TEST_F(CompiledFstmParserTest, properties) {
+    // Exercise
+    shared_ptr<Generator<string> > g = target->properties();
+
+    // Verify
+    ASSERT_EQ(1, target->getNbOfProperties());
+    ASSERT_TRUE(g->hasNext());
+    ASSERT_EQ("[](<>A)", g->next());
+    ASSERT_FALSE(g->hasNext());
+}
+
+TEST_F(CompiledFstmParserTest, states) {
+    // Exercise
+    shared_ptr<Generator<string> > g = target->states();
+
+    // Verify
+    ASSERT_TRUE(g->hasNext());
+    ASSERT_EQ("State1", g->next());
+    ASSERT_TRUE(g->hasNext());
+    ASSERT_EQ("State2", g->next());
+    ASSERT_FALSE(g->hasNext());
+}
+
+TEST_F(CompiledFstmParserTest, invalidFile) {
+    // Setup
+    string invalidPath = createTemporaryFile();
+    ofstream invalid(invalidPath.c_str());
+    invalid << "{ \"FSTM\": {} }";
+    invalid.close();
+
+    // Exercise & Verify
+    ASSERT_FALSE(CompiledFstmParser::isCompiled(invalidPath));
+    ASSERT_THROW(CompiledFstmParser(invalidPath, *factory),
+            NotPossibleException);
+    std::remove(invalidPath.c_str());
+}
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
@@ -58,6 +58,18 @@ namespace fstm {
         ASSERT_EQ(expectedEvent.get(), actualEvent.get());
     }
 
+    TEST_F(FstmEventTest, getId) {
+        // Setup
+        shared_ptr<FstmEvent> eventOne = FstmEvent::makeEvent("Nymeria");
+        shared_ptr<FstmEvent> eventTwo = FstmEvent::makeEvent("Summer");
+
+        // Exercise & Verify
+        ASSERT_NE(eventOne->getId(), eventTwo->getId());
+        ASSERT_EQ(eventOne->getId(), FstmEvent::makeEvent("Nymeria")->getId());
+        ASSERT_LT(eventOne->getId(), FstmEvent::getNbOfEvents());
+        ASSERT_LT(eventTwo->getId(), FstmEvent::getNbOfEvents());
+    }
+
 } // namespace fstm
 } // namespace fts
 } // namespace core
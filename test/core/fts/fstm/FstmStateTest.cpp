@@ -81,6 +81,18 @@ TEST_F(FstmStateTest, hashCode_different) {
     ASSERT_FALSE(stateOne->equals(*stateTwo));
 }
 
+TEST_F(FstmStateTest, getId) {
+    // Setup
+    FstmStatePtr stateOne = FstmState::makeState("Jon Snow");
+    FstmStatePtr stateTwo = FstmState::makeState("Sansa Stark");
+
+    // Exercise && Verify
+    ASSERT_NE(stateOne->getId(), stateTwo->getId());
+    ASSERT_EQ(stateOne->getId(), FstmState::makeState("Jon Snow")->getId());
+    ASSERT_LT(stateOne->getId(), FstmState::getNbOfStates());
+    ASSERT_LT(stateTwo->getId(), FstmState::getNbOfStates());
+}
+
 } // namespace fstm
 } // namespace fts
 } // namespace core
@@ -100,6 +100,14 @@ namespace fstm {
         ASSERT_EQ(expectedEvent->getName(), actualEvent->getName());
     }
 
+    TEST_F(FstmTransitionTest, getEventId) {
+        // Exercise
+        int actualId = transition->getEventId();
+
+        // Verify
+        ASSERT_EQ((int) expectedEvent->getId(), actualId);
+    }
+
     TEST_F(FstmTransitionTest, getFeatureExp) {
         // Exercise
         shared_ptr<FeatureExp> actualExp = transition->getFeatureExp();
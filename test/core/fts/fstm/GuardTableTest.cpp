@@ -0,0 +1,68 @@
+/*
+ * GuardTableTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "config/Context.hpp"
+#include "core/features/BoolFeatureExp.hpp"
+#include "core/features/BoolFeatureExpFactory.hpp"
+#include "core/fts/fstm/GuardTable.hpp"
+
+using config::Context;
+using core::features::BoolFeatureExpFactory;
+using core::features::FeatureExpPtr;
+using std::tr1::shared_ptr;
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+/**
+ * Unit tests for the GuardTable class.
+ *
+ * @author mwi
+ */
+class GuardTableTest : public ::testing::Test {
+
+protected:
+    GuardTable target;
+};
+
+TEST_F(GuardTableTest, normalize) {
+    // Verify
+    ASSERT_EQ("", GuardTable::normalize(" \t\n"));
+    ASSERT_EQ("!(A)&&(B||C_1)",
+            GuardTable::normalize(" ! ( A )  &&\t(B ||\nC_1) "));
+    ASSERT_EQ(GuardTable::normalize("A&&B"), GuardTable::normalize("A && B"));
+    // Whitespaces separating identifiers are kept.
+    ASSERT_EQ("A B", GuardTable::normalize("A   B"));
+    ASSERT_NE(GuardTable::normalize("AB"), GuardTable::normalize("A B"));
+}
+
+TEST_F(GuardTableTest, addAndFind) {
+    // Setup
+    Context ctx;
+    shared_ptr<BoolFeatureExpFactory> factory = ctx.getBoolFeatureExpFactory();
+    FeatureExpPtr a(factory->create("A"));
+    FeatureExpPtr b(factory->create("B"));
+
+    // Exercise
+    ASSERT_EQ(-1, target.find("A"));
+    int idA = target.add("A", a);
+    int idB = target.add("B", b);
+
+    // Verify
+    ASSERT_EQ(2, target.size());
+    ASSERT_NE(idA, idB);
+    ASSERT_EQ(idA, target.find("A"));
+    ASSERT_EQ(idB, target.find("B"));
+    ASSERT_EQ(a, target.getGuard(idA));
+    ASSERT_EQ(b, target.getGuard(idB));
+}
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
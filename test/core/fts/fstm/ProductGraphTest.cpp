@@ -0,0 +1,166 @@
+/*
+ * ProductGraphTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "config/Context.hpp"
+#include "core/features/BoolFeatureExp.hpp"
+#include "core/features/BoolFeatureExpFactory.hpp"
+#include "core/features/FeatureExp.hpp"
+#include "core/fts/fstm/ClaimPropertyAutomaton.hpp"
+#include "core/fts/fstm/FSTM.hpp"
+#include "core/fts/fstm/FstmState.hpp"
+#include "core/fts/fstm/ProductGraph.hpp"
+#include "neverclaim/ClaimState.hpp"
+
+#include <sstream>
+#include <string>
+
+using config::Context;
+using core::features::BoolFeatureExpFactory;
+using core::features::FeatureExp;
+using std::string;
+using std::stringstream;
+using std::tr1::dynamic_pointer_cast;
+using std::tr1::shared_ptr;
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+/**
+ * Unit tests for the ProductGraph class.
+ *
+ * @author mwi
+ */
+class ProductGraphTest : public ::testing::Test {
+
+/*
+ * never claim of !([]!(state2))
+ * T0_init:
+ *	if
+ *	:: (1) -> goto T0_init
+ *	:: (state2) -> goto accept_all
+ *	fi;
+ * accept_all:
+ *	skip
+ */
+
+protected:
+    shared_ptr<BoolFeatureExpFactory> factory;
+    shared_ptr<FSTM> fstm;
+    shared_ptr<ProductGraph> target;
+
+    /**
+     * Sets up the test fixture.
+     */
+    void SetUp() {
+        Context ctx;
+        factory = ctx.getBoolFeatureExpFactory();
+    }
+
+    /**
+     * Makes target be the product of a small FSTM and of the property
+     * 'property'.
+     */
+    void init(const string & property) {
+        stringstream jsonFstm;
+        jsonFstm << "{\"FSTM\":{"
+                 << "\"name\":\"Test\","
+                 << "\"generated\":\"Tue Aug 06 10:31:18 CEST 2013\","
+                 << "\"nbOfLtlProperties\":1,"
+                 << "\"nbOfTransitions\":3},"
+                 << "\"states\":[\"state1\", \"state2\"],"
+                 << "\"events\":[\"evt\"],"
+                 << "\"ltlProperties\":[\"" << property << "\"],"
+                 << "\"transitions\":["
+                 << "{\"source\":\"state1\", \"target\":\"state1\","
+                 << "\"event\":\"evt\", \"guard\":null, \"featureExp\":null},"
+                 << "{\"source\":\"state1\", \"target\":\"state2\","
+                 << "\"event\":\"evt\", \"guard\":null, \"featureExp\":\"f\"},"
+                 << "{\"source\":\"state2\", \"target\":\"state2\","
+                 << "\"event\":\"evt\", \"guard\":null, \"featureExp\":null}"
+                 << "]}";
+        fstm.reset(new FSTM(jsonFstm, *factory));
+        target.reset(new ProductGraph(fstm->getTransitionTable(),
+                dynamic_pointer_cast<ClaimPropertyAutomaton>(
+                        fstm->getPropertyAutomaton())));
+    }
+};
+
+TEST_F(ProductGraphTest, nodes) {
+    // Exercise
+    init("[] !(state2)");
+
+    // Verify
+    ASSERT_FALSE(target->isEmpty());
+    ASSERT_EQ(2u, target->getNbOfNodes());
+    ASSERT_EQ("state1", target->getFstmState(0)->getName());
+    ASSERT_EQ("T0_init", target->getClaimState(0)->getLabel());
+    ASSERT_EQ("state2", target->getFstmState(1)->getName());
+    ASSERT_EQ("T0_init", target->getClaimState(1)->getLabel());
+    ASSERT_FALSE(target->isAccepting(0));
+    ASSERT_FALSE(target->isAccepting(1));
+}
+
+TEST_F(ProductGraphTest, edges) {
+    // Exercise
+    init("[] !(state2)");
+
+    // Verify
+    ASSERT_EQ(2u, target->endEdgeOf(0) - target->firstEdgeOf(0));
+    ASSERT_EQ(0u, target->getEdge(target->firstEdgeOf(0)).target);
+    ASSERT_EQ(1u, target->getEdge(target->firstEdgeOf(0) + 1).target);
+
+    // The final edge follows the edge of the same transition to T0_init.
+    ASSERT_EQ(2u, target->endEdgeOf(1) - target->firstEdgeOf(1));
+    ASSERT_EQ(1u, target->getEdge(target->firstEdgeOf(1)).target);
+    ASSERT_EQ(ProductGraph::FINAL,
+            target->getEdge(target->firstEdgeOf(1) + 1).target);
+    ASSERT_EQ("state2",
+            target->getFstmTarget(target->firstEdgeOf(1) + 1)->getName());
+}
+
+TEST_F(ProductGraphTest, guards) {
+    // Exercise
+    init("[] !(state2)");
+
+    // Verify
+    shared_ptr<FeatureExp> f(factory->create("f"));
+    const ProductGraph::Edge & edge =
+            target->getEdge(target->firstEdgeOf(0) + 1);
+    ASSERT_TRUE(target->getGuard(edge.guard)->isEquivalent(*f));
+}
+
+TEST_F(ProductGraphTest, bytes_otherStates) {
+    // Setup
+    init("[] !(state2)");
+    const unsigned long bytes = target->bytes();
+    for (int i = 0; i < 1000; i++) {
+        stringstream name;
+        name << "ProductGraphTest_other" << i;
+        FstmState::makeState(name.str());
+    }
+
+    // Exercise
+    init("[] !(state2)");
+
+    // Verify: the states of the process do not weigh on the product
+    ASSERT_EQ(bytes, target->bytes());
+}
+
+TEST_F(ProductGraphTest, pruned) {
+    // Exercise: no state of the FSTM is named state3.
+    init("[] !(state3)");
+
+    // Verify
+    ASSERT_TRUE(target->isEmpty());
+    ASSERT_EQ(0u, target->getNbOfNodes());
+}
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
@@ -0,0 +1,204 @@
+/*
+ * StreamingJsonParserTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "config/Context.hpp"
+#include "core/features/BoolFeatureExpFactory.hpp"
+#include "core/fts/fstm/FSTM.hpp"
+#include "core/fts/fstm/JsonParser.hpp"
+#include "core/fts/fstm/StreamingJsonParser.hpp"
+#include "core/fts/fstm/FstmTransition.hpp"
+#include "core/fts/fstm/FstmState.hpp"
+#include "core/fts/fstm/FstmEvent.hpp"
+#include "core/features/BoolFeatureExp.hpp"
+#include "util/JsonException.hpp"
+
+#include <sstream>
+#include <stdexcept>
+#include <tr1/memory>
+
+using config::Context;
+using core::features::BoolFeatureExpFactory;
+using std::string;
+using std::stringstream;
+using std::tr1::shared_ptr;
+using util::Generator;
+using util::JsonException;
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+/**
+ * Unit tests for the StreamingJsonParser class. The FSTM is parsed both with
+ * a StreamingJsonParser and with a JsonParser, which must agree.
+ *
+ * @author mwi
+ */
+class StreamingJsonParserTest : public ::testing::Test {
+
+protected:
+    shared_ptr<BoolFeatureExpFactory> factory;
+    string header;
+    string states;
+    string properties;
+    string transitions;
+
+    /**
+     * Sets up the test fixture.
+     */
+    void SetUp() {
+        Context ctx;
+        factory = ctx.getBoolFeatureExpFactory();
+
+        header = "\"FSTM\":{ \"name\":\"Sample2\", "
+                "\"generated\":\"Thu Jul 25 11:01:23 CEST 2013\", "
+                "\"nbOfLtlProperties\":1, \"nbOfTransitions\":3 }";
+        states = "\"states\":[\"State1\", \"State2\" ]";
+        properties = "\"ltlProperties\":[\"[](<>A)\"]";
+        transitions = "\"transitions\":[ "
+                "{ \"source\":\"State1\", \"target\":\"State2\", "
+                "\"event\":\"evt1\", \"guard\":\"\", "
+                "\"featureExp\":\"!(A) && (B && B) || !(C && !(B) || "
+                "(((C && B))))\" },"
+                "{ \"featureExp\":\"A || C\", \"event\":\"evt2\", "
+                "\"target\":\"State2\", \"source\":\"State2\" },"
+                "{\"source\":\"State2\", \"target\":\"State1\", "
+                "\"event\":\"evt3\", \"guard\":\"\", \"featureExp\":null }"
+                "]";
+    }
+
+    /**
+     * Asserts the parsers of the JSON FSTM 'json' agree.
+     */
+    void assertSameFstm(const string & json) {
+        stringstream expectedStream(json);
+        stringstream actualStream(json);
+        JsonParser expected(expectedStream, *factory);
+        StreamingJsonParser actual(actualStream, *factory);
+
+        FstmTransitionGeneratorPtr expectedGen = expected.transitions();
+        FstmTransitionGeneratorPtr actualGen = actual.transitions();
+        while (expectedGen->hasNext()) {
+            ASSERT_TRUE(actualGen->hasNext());
+            FstmTransitionPtr e = expectedGen->next();
+            FstmTransitionPtr a = actualGen->next();
+            ASSERT_EQ(e->getSource()->getName(), a->getSource()->getName());
+            ASSERT_EQ(e->getTarget()->getName(), a->getTarget()->getName());
+            ASSERT_EQ(e->getEvent()->getName(), a->getEvent()->getName());
+            ASSERT_TRUE(e->getFeatureExp()->isEquivalent(*a->getFeatureExp()));
+        }
+        ASSERT_FALSE(actualGen->hasNext());
+
+        // The members after the transitions are read once they are generated
+        ASSERT_EQ(expected.getNbOfTransitions(), actual.getNbOfTransitions());
+        ASSERT_EQ(expected.getNbOfProperties(), actual.getNbOfProperties());
+        assertSameStrings(expected.states(), actual.states());
+        assertSameStrings(expected.properties(), actual.properties());
+    }
+
+    /**
+     * Asserts the generators 'expected' and 'actual' yield the same strings.
+     */
+    void assertSameStrings(shared_ptr<Generator<string> > expected,
+            shared_ptr<Generator<string> > actual) {
+        while (expected->hasNext()) {
+            ASSERT_TRUE(actual->hasNext());
+            ASSERT_EQ(expected->next(), actual->next());
+        }
+        ASSERT_FALSE(actual->hasNext());
+    }
+};
+
+TEST_F(StreamingJsonParserTest, sameFstm) {
+    assertSameFstm("{" + header + ", " + states + ", "
+            + "\"events\":[\"evt1\", \"evt2\", \"evt3\" ], " + properties
+            + ", " + transitions + "}");
+}
+
+TEST_F(StreamingJsonParserTest, membersAfterTransitions) {
+    assertSameFstm("{" + header + ", " + transitions + ", " + states + ", "
+            + properties + "}");
+}
+
+TEST_F(StreamingJsonParserTest, severalBatches) {
+    // Setup: more transitions than a batch, with distinct feature expressions
+    stringstream json;
+    json << "{" << header << ", " << states << ", \"transitions\":[";
+    for (int i = 0; i < 5000; i++) {
+        json << (i > 0 ? ", " : "") << "{\"source\":\"State" << i % 2 + 1
+                << "\", \"target\":\"State" << (i + 1) % 2 + 1
+                << "\", \"event\":\"evt" << i << "\", "
+                << "\"featureExp\":\"F" << i % 7 << " && !(F" << i % 5
+                << " || F" << i % 3 << ")\"}";
+    }
+    json << "]}";
+
+    // Exercise & Verify
+    assertSameFstm(json.str());
+}
+
+TEST_F(StreamingJsonParserTest, sharedGuards) {
+    // Setup: the first and third feature expressions differ only by spaces
+    stringstream json("{" + header + ", \"transitions\":["
+            "{\"source\":\"State1\", \"target\":\"State2\", "
+            "\"event\":\"evt1\", \"featureExp\":\"A && !(B)\"},"
+            "{\"source\":\"State2\", \"target\":\"State1\", "
+            "\"event\":\"evt2\", \"featureExp\":\"B\"},"
+            "{\"source\":\"State2\", \"target\":\"State2\", "
+            "\"event\":\"evt3\", \"featureExp\":\"A&&!(B)\"}]}");
+    StreamingJsonParser parser(json, *factory);
+
+    // Exercise
+    FstmTransitionGeneratorPtr gen = parser.transitions();
+    FstmTransitionPtr t1 = gen->next();
+    FstmTransitionPtr t2 = gen->next();
+    FstmTransitionPtr t3 = gen->next();
+
+    // Verify
+    ASSERT_LE(0, t1->getGuardId());
+    ASSERT_NE(t1->getGuardId(), t2->getGuardId());
+    ASSERT_EQ(t1->getGuardId(), t3->getGuardId());
+    ASSERT_TRUE(t1->getFeatureExp()->isEquivalent(*t3->getFeatureExp()));
+}
+
+TEST_F(StreamingJsonParserTest, featureExpError) {
+    // Setup
+    stringstream json("{" + header + ", \"transitions\":[{"
+            "\"source\":\"State1\", \"target\":\"State2\", "
+            "\"event\":\"evt1\", \"featureExp\":\"A && \"}]}");
+    StreamingJsonParser parser(json, *factory);
+    FstmTransitionGeneratorPtr gen = parser.transitions();
+
+    // Exercise & Verify
+    ASSERT_TRUE(gen->hasNext());
+    ASSERT_THROW(gen->next(), std::logic_error);
+}
+
+TEST_F(StreamingJsonParserTest, transitionsBeforeHeader) {
+    // Setup: a property without propositions, so that the FSTM can be built
+    const string json("{" + transitions + ", " + states + ", " + header
+            + ", \"ltlProperties\":[\"false\"]}");
+    stringstream jsonFstm(json);
+
+    // Exercise & Verify
+    assertSameFstm(json);
+    FSTM fstm(jsonFstm, *factory);
+    ASSERT_TRUE(fstm.hasProperty());
+}
+
+TEST_F(StreamingJsonParserTest, syntaxError) {
+    // Setup
+    stringstream json("{" + header + ", " + states + " " + transitions + "}");
+
+    // Exercise & Verify
+    ASSERT_THROW(StreamingJsonParser(json, *factory), JsonException);
+}
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
@@ -0,0 +1,223 @@
+/*
+ * TransitionTableTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "config/Context.hpp"
+#include "core/features/BoolFeatureExp.hpp"
+#include "core/features/BoolFeatureExpFactory.hpp"
+#include "core/fts/Transition.hpp"
+#include "core/fts/fstm/FstmState.hpp"
+#include "core/fts/fstm/FstmTransition.hpp"
+#include "core/fts/fstm/TransitionTable.hpp"
+
+#include <vector>
+
+using config::Context;
+using core::features::BoolFeatureExpFactory;
+using core::features::FeatureExpPtr;
+using std::string;
+using std::tr1::shared_ptr;
+using std::vector;
+
+namespace core {
+namespace fts {
+namespace fstm {
+
+/**
+ * Generator for a vector of transitions.
+ */
+class VectorGenerator : public util::Generator<FstmTransitionPtr> {
+
+private:
+    const vector<FstmTransitionPtr> transitions;
+    unsigned int index;
+
+public:
+    explicit VectorGenerator(const vector<FstmTransitionPtr> & transitions)
+        : transitions(transitions), index(0) {}
+
+    bool hasNext() const {
+        return index < transitions.size();
+    }
+
+    FstmTransitionPtr next() {
+        return transitions[index++];
+    }
+};
+
+/**
+ * Unit tests for the TransitionTable class.
+ *
+ * @author mwi
+ */
+class TransitionTableTest : public ::testing::Test {
+
+protected:
+    vector<FstmTransitionPtr> transitions;
+    shared_ptr<TransitionTable> target;
+
+    /**
+     * Sets up the test fixture.
+     */
+    void SetUp() {
+        Context ctx;
+        shared_ptr<BoolFeatureExpFactory> factory =
+                ctx.getBoolFeatureExpFactory();
+        FeatureExpPtr t(factory->getTrue());
+
+        addTransition("TTInit", "TTMiddle", "a", t);
+        addTransition("TTInit", "TTInit", "b", t);
+        addTransition("TTMiddle", "TTEnd", "c", t);
+        addTransition("TTEnd", "TTInit", "d", t);
+        addTransition("TTEnd", "TTMiddle", "e", t);
+
+        target.reset(new TransitionTable(FstmTransitionGeneratorPtr(
+                new VectorGenerator(transitions)), transitions.size()));
+    }
+
+    void addTransition(const string & source, const string & target,
+            const string & event, const FeatureExpPtr & featureExp) {
+        transitions.push_back(FstmTransitionPtr(
+                new FstmTransition(source, target, event, featureExp)));
+    }
+
+    /**
+     * Asserts the transitions leaving 'state' are the transitions
+     * 'first' to 'last' of the fixture.
+     */
+    void assertExecutables(const string & state, unsigned int first,
+            unsigned int last) {
+        FstmStatePtr s = FstmState::makeState(state);
+        unsigned int begin = target->firstIndexOf(*s);
+        ASSERT_EQ(last - first + 1, target->endIndexOf(*s) - begin);
+        TransitionGeneratorPtr gen = target->executables(*s);
+        for (unsigned int i = first; i <= last; i++) {
+            ASSERT_EQ(transitions[i], target->getTransition(begin + i - first));
+            ASSERT_TRUE(gen->hasNext());
+            ASSERT_EQ(transitions[i], gen->next());
+        }
+        ASSERT_FALSE(gen->hasNext());
+    }
+};
+
+TEST_F(TransitionTableTest, getInitialState) {
+    ASSERT_EQ(FstmState::makeState("TTInit"), target->getInitialState());
+}
+
+TEST_F(TransitionTableTest, executables) {
+    assertExecutables("TTInit", 0, 1);
+    assertExecutables("TTMiddle", 2, 2);
+    assertExecutables("TTEnd", 3, 4);
+}
+
+TEST_F(TransitionTableTest, executables_none) {
+    // Setup: a state created after the table
+    FstmStatePtr state = FstmState::makeState("TTUnknown");
+
+    // Exercise
+    TransitionGeneratorPtr gen = target->executables(*state);
+
+    // Verify
+    ASSERT_FALSE(gen->hasNext());
+    ASSERT_EQ(target->firstIndexOf(*state), target->endIndexOf(*state));
+}
+
+TEST_F(TransitionTableTest, executables_otherTable) {
+    // Setup: a table whose states are created after the ones of the fixture
+    Context ctx;
+    FeatureExpPtr t(ctx.getBoolFeatureExpFactory()->getTrue());
+    FstmStatePtr before = FstmState::makeState("TTOtherBefore");
+    transitions.clear();
+    addTransition("TTOtherInit", "TTOtherEnd", "a", t);
+    addTransition("TTOtherEnd", "TTOtherInit", "b", t);
+
+    // Exercise
+    TransitionTable table(FstmTransitionGeneratorPtr(
+            new VectorGenerator(transitions)), transitions.size());
+
+    // Verify: the states of the other tables have no transition
+    FstmStatePtr init = FstmState::makeState("TTInit");
+    ASSERT_EQ(table.firstIndexOf(*before), table.endIndexOf(*before));
+    ASSERT_EQ(table.firstIndexOf(*init), table.endIndexOf(*init));
+    FstmStatePtr otherInit = FstmState::makeState("TTOtherInit");
+    ASSERT_EQ(1u, table.endIndexOf(*otherInit) - table.firstIndexOf(*otherInit));
+    ASSERT_EQ(transitions[0], table.getTransition(table.firstIndexOf(*otherInit)));
+}
+
+TEST_F(TransitionTableTest, unsortedTransitions) {
+    // Setup: the transitions leaving TTInit are not consecutive
+    Context ctx;
+    FeatureExpPtr t(ctx.getBoolFeatureExpFactory()->getTrue());
+    transitions.clear();
+    addTransition("TTInit", "TTMiddle", "a", t);
+    addTransition("TTMiddle", "TTEnd", "c", t);
+    addTransition("TTInit", "TTInit", "b", t);
+    addTransition("TTEnd", "TTInit", "d", t);
+    addTransition("TTMiddle", "TTInit", "f", t);
+    addTransition("TTInit", "TTEnd", "g", t);
+
+    // Exercise
+    TransitionTable table(FstmTransitionGeneratorPtr(
+            new VectorGenerator(transitions)), transitions.size());
+
+    // Verify: the transitions leaving a state keep their order
+    ASSERT_EQ(FstmState::makeState("TTInit"), table.getInitialState());
+    const unsigned int expected[] = {0, 2, 5, 1, 4, 3};
+    const char * sources[] = {"TTInit", "TTMiddle", "TTEnd"};
+    const unsigned int nbOfTransitions[] = {3, 2, 1};
+    unsigned int k = 0;
+    for (unsigned int s = 0; s < 3; s++) {
+        FstmStatePtr state = FstmState::makeState(sources[s]);
+        ASSERT_EQ(nbOfTransitions[s],
+                table.endIndexOf(*state) - table.firstIndexOf(*state));
+        TransitionGeneratorPtr gen = table.executables(*state);
+        for (unsigned int i = 0; i < nbOfTransitions[s]; i++) {
+            ASSERT_TRUE(gen->hasNext());
+            ASSERT_EQ(transitions[expected[k++]], gen->next());
+        }
+        ASSERT_FALSE(gen->hasNext());
+    }
+}
+
+TEST_F(TransitionTableTest, unsortedTransitions_large) {
+    // Setup: enough transitions to be sorted by several threads, in a round
+    // robin over the sources
+    Context ctx;
+    FeatureExpPtr t(ctx.getBoolFeatureExpFactory()->getTrue());
+    const unsigned int nbOfStates = 100;
+    const unsigned int nbOfTransitions = 100000;
+    vector<string> names;
+    for (unsigned int i = 0; i < nbOfStates; i++) {
+        names.push_back("TTLarge" + std::string(1, 'a' + i / 26)
+                + std::string(1, 'a' + i % 26));
+    }
+    transitions.clear();
+    for (unsigned int i = 0; i < nbOfTransitions; i++) {
+        addTransition(names[i % nbOfStates], names[(i + 1) % nbOfStates],
+                "e", t);
+    }
+
+    // Exercise
+    TransitionTable table(FstmTransitionGeneratorPtr(
+            new VectorGenerator(transitions)), transitions.size());
+
+    // Verify
+    for (unsigned int s = 0; s < nbOfStates; s++) {
+        FstmStatePtr state = FstmState::makeState(names[s]);
+        unsigned int first = table.firstIndexOf(*state);
+        ASSERT_EQ(nbOfTransitions / nbOfStates,
+                table.endIndexOf(*state) - first);
+        for (unsigned int i = 0; i < nbOfTransitions / nbOfStates; i++) {
+            ASSERT_EQ(transitions[i * nbOfStates + s],
+                    table.getTransition(first + i));
+        }
+    }
+}
+
+} // namespace fstm
+} // namespace fts
+} // namespace core
@@ -0,0 +1,133 @@
+/*
+ * BddCodecTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "math/BddCodec.hpp"
+#include "math/BoolFctCUDD.hpp"
+#include "math/BoolFctCUDDFactory.hpp"
+#include "math/BoolVar.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using std::tr1::shared_ptr;
+using std::vector;
+
+namespace math {
+
+/**
+ * Unit tests for the BddEncoder and BddDecoder classes.
+ *
+ * @author mwi
+ */
+class BddCodecTest : public ::testing::Test {
+
+protected:
+    BoolFctCUDDFactory factory;
+    BddEncoder encoder;
+    /* The ids of the variables, indexed by themselves. */
+    vector<int> varIds;
+
+    /** true */
+    shared_ptr<BoolFct> t;
+    /** false */
+    shared_ptr<BoolFct> f;
+    /** a */
+    shared_ptr<BoolFct> a;
+    /** a && !b */
+    shared_ptr<BoolFct> fct1;
+    /** !(a || b && c) */
+    shared_ptr<BoolFct> fct2;
+
+    void SetUp() {
+        BoolVar varA = BoolVar::makeBoolVar("BddCodecA");
+        BoolVar varB = BoolVar::makeBoolVar("BddCodecB");
+        BoolVar varC = BoolVar::makeBoolVar("BddCodecC");
+        int maxId = std::max(varA.getId(),
+                std::max(varB.getId(), varC.getId()));
+        for (int i = 0; i <= maxId; i++) {
+            varIds.push_back(i);
+        }
+
+        t.reset(factory.getTrue());
+        f.reset(factory.getFalse());
+        a.reset(factory.create(varA));
+        shared_ptr<BoolFct> b(factory.create(varB));
+        shared_ptr<BoolFct> c(factory.create(varC));
+        shared_ptr<BoolFct> notB(b->clone());
+        notB->negation();
+        fct1.reset(a->clone());
+        fct1->conjunction(*notB);
+        fct2.reset(b->clone());
+        fct2->conjunction(*c);
+        fct2->disjunction(*a);
+        fct2->negation();
+    }
+
+    /**
+     * Asserts 'fct' is decoded back from the reference 'ref'.
+     */
+    void assertDecodes(const BoolFct & fct, int ref) {
+        const vector<BddNode> & nodes = encoder.getNodes();
+        ASSERT_TRUE(BddDecoder::isValid(nodes.empty() ? NULL : &nodes[0],
+                nodes.size(), varIds.size()));
+        BddDecoder decoder(nodes.empty() ? NULL : &nodes[0], nodes.size(),
+                varIds);
+        shared_ptr<BoolFct> decoded(decoder.decode(ref));
+        ASSERT_TRUE(decoded->isEquivalent(fct));
+    }
+};
+
+TEST_F(BddCodecTest, constants) {
+    // Exercise
+    int trueRef = encoder.encode(*t);
+    int falseRef = encoder.encode(*f);
+
+    // Verify
+    ASSERT_EQ(0, trueRef);
+    ASSERT_EQ(1, falseRef);
+    ASSERT_TRUE(encoder.getNodes().empty());
+    assertDecodes(*t, trueRef);
+    assertDecodes(*f, falseRef);
+}
+
+TEST_F(BddCodecTest, variable) {
+    // Exercise
+    int ref = encoder.encode(*a);
+
+    // Verify
+    ASSERT_EQ(1u, encoder.getNodes().size());
+    assertDecodes(*a, ref);
+}
+
+TEST_F(BddCodecTest, sharedNodes) {
+    // Exercise
+    int ref1 = encoder.encode(*fct1);
+    unsigned int nbOfNodes = encoder.getNodes().size();
+    int ref2 = encoder.encode(*fct2);
+    int ref3 = encoder.encode(*fct1);
+
+    // Verify
+    ASSERT_EQ(ref1, ref3);
+    ASSERT_LE(nbOfNodes, encoder.getNodes().size());
+    assertDecodes(*fct1, ref1);
+    assertDecodes(*fct2, ref2);
+}
+
+TEST_F(BddCodecTest, isValid) {
+    // Setup
+    BddNode forward[] = { { 0, 2, 1 } };
+    BddNode badVar[] = { { 5, 0, 1 } };
+    BddNode valid[] = { { 0, 0, 1 }, { 1, 2, 1 } };
+
+    // Verify
+    ASSERT_FALSE(BddDecoder::isValid(forward, 1, 1));
+    ASSERT_FALSE(BddDecoder::isValid(badVar, 1, 2));
+    ASSERT_TRUE(BddDecoder::isValid(valid, 2, 2));
+}
+
+} // namespace math
@@ -219,6 +219,26 @@ TEST_F(BoolFctCUDDTest, toString_two) {
     ASSERT_EQ(expectedExp, actualExp);
 }
 
+/**
+ * Tests that the toString method renders the cubes of the BDD, in the order of
+ * the variables, with their negative literals in parentheses.
+ */
+TEST_F(BoolFctCUDDTest, toString_cube) {
+    // Setup
+    const string expectedExp("(" + varA + " && !(" + varB + "))");
+    // fct = a && !b
+    shared_ptr<BoolFct> fct = shared_ptr<BoolFct>(a->clone());
+    shared_ptr<BoolFct> notB = shared_ptr<BoolFct>(b->clone());
+    notB->negation();
+    fct->conjunction(*notB);
+
+    // Exercise
+    const string actualExp(fct->toString());
+
+    // Verify
+    ASSERT_EQ(expectedExp, actualExp);
+}
+
 /**
  * Tests the toString method for the true Boolean function.
  */
@@ -247,4 +267,47 @@ TEST_F(BoolFctCUDDTest, toString_false) {
     ASSERT_EQ(expectedExp, actualExp);
 }
 
+/**
+ * Tests that the manager statistics account for the created BDDs.
+ */
+TEST_F(BoolFctCUDDTest, getStats) {
+    // Setup
+    BoolFctCUDDFactory factory;
+
+    // Exercise
+    const BoolFctStats stats(factory.getStats());
+
+    // Verify
+    ASSERT_GT(stats.liveNodes, 0);
+    ASSERT_GE(stats.peakNodes, stats.liveNodes);
+    ASSERT_GT(stats.memoryInUse, 0u);
+    ASSERT_GE(stats.cacheLookUps, stats.cacheHits);
+}
+
+/**
+ * Tests that a factory configuring dynamic reordering triggers reorderings,
+ * which keep the functions unchanged.
+ */
+TEST_F(BoolFctCUDDTest, configure_reordering) {
+    // Setup
+    CuddOptions options;
+    options.reordering = CuddOptions::Sift;
+    options.firstReordering = 1;
+    BoolFctCUDDFactory factory(options);
+    const unsigned int reorderings = factory.getStats().reorderings;
+
+    // Exercise
+    shared_ptr<BoolFct> fct(factory.create("BoolFctCUDDc"));
+    shared_ptr<BoolFct> tmp(fct4->clone());
+    fct->disjunction(*tmp);
+    const BoolFctStats stats(factory.getStats());
+    BoolFctCUDDFactory defaultFactory((CuddOptions()));
+
+    // Verify
+    ASSERT_GT(stats.reorderings, reorderings);
+    ASSERT_TRUE(fct3->isEquivalent(*fct6));
+    ASSERT_TRUE(fct4->implies(*fct));
+    ASSERT_FALSE(fct->implies(*fct4));
+}
+
 } // namespace math
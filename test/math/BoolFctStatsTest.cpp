@@ -0,0 +1,74 @@
+/*
+ * BoolFctStatsTest.cpp
+ *
+ *  Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "math/BoolFctStats.hpp"
+
+namespace math {
+
+/**
+ * Unit tests for the BoolFctStats struct.
+ *
+ * @author mwi
+ */
+class BoolFctStatsTest : public ::testing::Test {
+
+protected:
+    BoolFctStats stats;
+};
+
+/**
+ * Tests the cache hit rate when no look-up has been made.
+ */
+TEST_F(BoolFctStatsTest, getCacheHitRate_noLookUp) {
+    // Exercise
+    const double rate = stats.getCacheHitRate();
+
+    // Verify
+    ASSERT_DOUBLE_EQ(0, rate);
+}
+
+/**
+ * Tests the cache hit rate after some look-ups.
+ */
+TEST_F(BoolFctStatsTest, getCacheHitRate) {
+    // Setup
+    stats.cacheHits = 3;
+    stats.cacheLookUps = 4;
+
+    // Exercise
+    const double rate = stats.getCacheHitRate();
+
+    // Verify
+    ASSERT_DOUBLE_EQ(0.75, rate);
+}
+
+/**
+ * Tests that toString reports every field.
+ */
+TEST_F(BoolFctStatsTest, toString) {
+    // Setup
+    stats.liveNodes = 12;
+    stats.peakNodes = 34;
+    stats.garbageCollections = 5;
+    stats.gcTime = 6;
+    stats.reorderings = 7;
+    stats.reorderingTime = 8;
+    stats.cacheHits = 1;
+    stats.cacheLookUps = 2;
+    stats.memoryInUse = 2048;
+    const std::string expected("nodes: 12 live, 34 peak; GC: 5 (6 ms); "
+            "reorderings: 7 (8 ms); cache hit rate: 50%; memory: 2 KB");
+
+    // Exercise
+    const std::string actual(stats.toString());
+
+    // Verify
+    ASSERT_EQ(expected, actual);
+}
+
+} // namespace math
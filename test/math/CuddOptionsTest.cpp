@@ -0,0 +1,82 @@
+/*
+ * CuddOptionsTest.cpp
+ *
+ *  Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "math/CuddOptions.hpp"
+
+namespace math {
+
+/**
+ * Unit tests for the CuddOptions struct.
+ *
+ * @author mwi
+ */
+class CuddOptionsTest : public ::testing::Test {
+
+protected:
+    CuddOptions options;
+};
+
+/**
+ * Tests that the default options do not reorder nor limit the memory.
+ */
+TEST_F(CuddOptionsTest, defaults) {
+    // Verify
+    ASSERT_EQ(CuddOptions::None, options.reordering);
+    ASSERT_EQ(0u, options.maxMemory);
+    ASSERT_GT(options.uniqueSlots, 0u);
+    ASSERT_GT(options.cacheSlots, 0u);
+}
+
+/**
+ * Tests that the name of each reordering method is parsed back.
+ */
+TEST_F(CuddOptionsTest, parseReordering) {
+    for (int i = CuddOptions::None; i <= CuddOptions::Exact; ++i) {
+        // Setup
+        const CuddOptions::Reordering expected =
+                static_cast<CuddOptions::Reordering>(i);
+        CuddOptions::Reordering actual = CuddOptions::None;
+
+        // Exercise
+        const bool valid = CuddOptions::parseReordering(
+                CuddOptions::getReorderingName(expected), actual);
+
+        // Verify
+        ASSERT_TRUE(valid);
+        ASSERT_EQ(expected, actual);
+    }
+}
+
+/**
+ * Tests that an unknown reordering method is rejected.
+ */
+TEST_F(CuddOptionsTest, parseReordering_unknown) {
+    // Exercise
+    const bool valid = CuddOptions::parseReordering("shuffle",
+            options.reordering);
+
+    // Verify
+    ASSERT_FALSE(valid);
+    ASSERT_EQ(CuddOptions::None, options.reordering);
+}
+
+/**
+ * Tests that only the sizes of the tables are compared.
+ */
+TEST_F(CuddOptionsTest, hasSameSizes) {
+    // Setup
+    CuddOptions other;
+    other.reordering = CuddOptions::Sift;
+
+    // Exercise & Verify
+    ASSERT_TRUE(options.hasSameSizes(other));
+    other.cacheSlots *= 2;
+    ASSERT_FALSE(options.hasSameSizes(other));
+}
+
+} // namespace math
@@ -162,4 +162,39 @@ TEST_F(dimacsTest, false2) {
     ASSERT_TRUE(result->isEquivalent(*f));
 }
 
+TEST_F(dimacsTest, clusters) {
+    // Setup
+    stringstream stream;
+    stream << "c clauses of several clusters\n";
+    stream << "p cnf 2 3\n";
+    stream << idb << " " << ida << " 0\n";
+    stream << (-idb) << " " << ida << " 0\n";
+    stream << idb << " 0\n";
+
+    // Exercise
+    shared_ptr<BoolFct> result(parseBoolFct(stream, factory, true));
+
+    // Verify
+    ASSERT_TRUE(result->isEquivalent(*fct1));
+}
+
+TEST_F(dimacsTest, sharedVariables) {
+    // Setup
+    BoolVar varC = BoolVar::makeBoolVar("dimacs_c");
+    shared_ptr<BoolFct> c(factory->create(varC));
+    shared_ptr<BoolFct> expected(b->clone());
+    expected->conjunction(*c);
+    stringstream stream;
+    stream << "p cnf 3 3\n";
+    stream << ida << " " << idb << " 0\n";
+    stream << varC.getId() << " 0\n";
+    stream << (-varC.getId()) << " " << idb << " 0\n";
+
+    // Exercise
+    shared_ptr<BoolFct> result(parseBoolFct(stream, factory));
+
+    // Verify
+    ASSERT_TRUE(result->isEquivalent(*expected));
+}
+
 } // namespace math
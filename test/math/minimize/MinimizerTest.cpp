@@ -6,8 +6,13 @@
 
 #include "gtest/gtest.h"
 
+#include "math/BoolFct.hpp"
+#include "math/BoolFctCUDDFactory.hpp"
 #include "math/minimize/Minimizer.hpp"
 
+#include <memory>
+
+using std::auto_ptr;
 using std::string;
 
 namespace math {
@@ -44,5 +49,74 @@ TEST_F(MinimizerTest, minimize) {
     ASSERT_EQ(expectedExp, actualExp);
 }
 
+TEST_F(MinimizerTest, minimize_true) {
+    // Setup
+    const string exp("VarA || !(VarA)");
+    const string expectedExp("true");
+
+    // Exercise
+    string actualExp = target.minimize(exp);
+
+    // Verify
+    ASSERT_EQ(expectedExp, actualExp);
+}
+
+TEST_F(MinimizerTest, minimize_false) {
+    // Setup
+    const string exp("VarA && !(VarA)");
+    const string expectedExp("false");
+
+    // Exercise
+    string actualExp = target.minimize(exp);
+
+    // Verify
+    ASSERT_EQ(expectedExp, actualExp);
+}
+
+/**
+ * Tests that the consensus of two cubes is not kept in the minimized
+ * expression of a Boolean function.
+ */
+TEST_F(MinimizerTest, minimize_boolFct) {
+    // Setup
+    const string expectedExp("!VarA && VarC || VarA && VarB");
+    BoolFctCUDDFactory factory;
+    // fct = a && b || !a && c || b && c
+    auto_ptr<BoolFct> fct(factory.create("VarA"));
+    fct->conjunction(*auto_ptr<BoolFct>(factory.create("VarB")));
+    auto_ptr<BoolFct> notAC(factory.create("VarA"));
+    notAC->negation();
+    notAC->conjunction(*auto_ptr<BoolFct>(factory.create("VarC")));
+    auto_ptr<BoolFct> bc(factory.create("VarB"));
+    bc->conjunction(*auto_ptr<BoolFct>(factory.create("VarC")));
+    fct->disjunction(*notAC);
+    fct->disjunction(*bc);
+
+    // Exercise
+    string actualExp = target.minimize(*fct);
+
+    // Verify
+    ASSERT_EQ(expectedExp, actualExp);
+}
+
+/**
+ * Tests that a minimizer gives the same expression for equivalent Boolean
+ * functions, the second one being found among those already minimized.
+ */
+TEST_F(MinimizerTest, minimize_equivalent) {
+    // Setup
+    const string expectedExp("VarA && VarB");
+    const string exp1("VarA && VarB");
+    const string exp2("!(!(VarB) || !(VarA))");
+
+    // Exercise
+    string actualExp1 = target.minimize(exp1);
+    string actualExp2 = target.minimize(exp2);
+
+    // Verify
+    ASSERT_EQ(expectedExp, actualExp1);
+    ASSERT_EQ(expectedExp, actualExp2);
+}
+
 } // namespace minimize
 } // namespace math
@@ -0,0 +1,58 @@
+/*
+ * LtlFormulaTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "neverclaim/LtlFormula.hpp"
+
+namespace neverclaim {
+
+/**
+ * Unit tests for the LtlFormula class.
+ *
+ * @author mwi
+ */
+class LtlFormulaTest : public ::testing::Test {
+
+protected:
+    LtlFormulaPtr p;
+    LtlFormulaPtr q;
+
+    void SetUp() {
+        p = LtlFormula::makeProposition("p");
+        q = LtlFormula::makeProposition("q");
+    }
+};
+
+TEST_F(LtlFormulaTest, makeProposition) {
+    // Verify
+    ASSERT_EQ(LtlFormula::Proposition, p->getOperator());
+    ASSERT_EQ("p", p->getName());
+    ASSERT_EQ("p", p->toString());
+}
+
+TEST_F(LtlFormulaTest, makeUntil) {
+    // Exercise
+    LtlFormulaPtr formula = LtlFormula::makeUntil(p, q);
+
+    // Verify
+    ASSERT_EQ(LtlFormula::Until, formula->getOperator());
+    ASSERT_EQ(p, formula->getLeft());
+    ASSERT_EQ(q, formula->getRight());
+}
+
+TEST_F(LtlFormulaTest, toString) {
+    // Exercise
+    LtlFormulaPtr formula = LtlFormula::makeRelease(LtlFormula::makeFalse(),
+            LtlFormula::makeOr(LtlFormula::makeNot(p),
+                    LtlFormula::makeNext(LtlFormula::makeAnd(q,
+                            LtlFormula::makeTrue()))));
+
+    // Verify
+    ASSERT_EQ("(false V (!(p) || X ((q && true))))", formula->toString());
+}
+
+} // namespace neverclaim
@@ -0,0 +1,105 @@
+/*
+ * LtlParserTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "neverclaim/LtlFormula.hpp"
+#include "neverclaim/LtlParser.hpp"
+
+#include <stdexcept>
+
+using std::logic_error;
+using std::string;
+
+namespace neverclaim {
+
+/**
+ * Unit tests for the LtlParser class.
+ *
+ * @author mwi
+ */
+class LtlParserTest : public ::testing::Test {
+
+protected:
+
+    void SetUp() {
+        // Nothing here
+    }
+
+    void TearDown() {
+        // Nothing here
+    }
+};
+
+TEST_F(LtlParserTest, parse_proposition) {
+    // Setup
+    LtlParser parser(" state_1 ");
+
+    // Exercise
+    LtlFormulaPtr formula = parser.parse();
+
+    // Verify
+    ASSERT_EQ(LtlFormula::Proposition, formula->getOperator());
+    ASSERT_EQ("state_1", formula->getName());
+}
+
+TEST_F(LtlParserTest, parse_constants) {
+    // Exercise
+    LtlFormulaPtr formula = LtlParser("true U false").parse();
+
+    // Verify
+    ASSERT_EQ("(true U false)", formula->toString());
+}
+
+TEST_F(LtlParserTest, parse_temporalOperators) {
+    // Exercise
+    LtlFormulaPtr formula = LtlParser("[]<>(p1 -> Xp2)").parse();
+
+    // Verify
+    ASSERT_EQ("(false V (true U (!(p1) || X (p2))))", formula->toString());
+}
+
+TEST_F(LtlParserTest, parse_precedence) {
+    // Exercise
+    LtlFormulaPtr formula = LtlParser("a || b && c U d V e").parse();
+
+    // Verify
+    ASSERT_EQ("(a || (b && ((c U d) V e)))", formula->toString());
+}
+
+TEST_F(LtlParserTest, parse_equivalence) {
+    // Exercise
+    LtlFormulaPtr formula = LtlParser("a <-> !b").parse();
+
+    // Verify
+    ASSERT_EQ("((a && !(b)) || (!(a) && !(!(b))))", formula->toString());
+}
+
+TEST_F(LtlParserTest, parse_invalidLtl) {
+    // Setup
+    LtlParser parser("[]<>(p1 -");
+
+    // Exercise & Verify
+    ASSERT_THROW(parser.parse(), logic_error);
+}
+
+TEST_F(LtlParserTest, parse_endNotReached) {
+    // Setup
+    LtlParser parser("p1 p2");
+
+    // Exercise & Verify
+    ASSERT_THROW(parser.parse(), logic_error);
+}
+
+TEST_F(LtlParserTest, parse_uppercaseProposition) {
+    // Setup
+    LtlParser parser("[] P1");
+
+    // Exercise & Verify
+    ASSERT_THROW(parser.parse(), logic_error);
+}
+
+} // namespace neverclaim
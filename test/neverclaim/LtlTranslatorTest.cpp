@@ -0,0 +1,153 @@
+/*
+ * LtlTranslatorTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "neverclaim/ClaimState.hpp"
+#include "neverclaim/ClaimTransition.hpp"
+#include "neverclaim/LtlFormula.hpp"
+#include "neverclaim/LtlParser.hpp"
+#include "neverclaim/LtlTranslator.hpp"
+#include "neverclaim/NeverClaimParser.hpp"
+
+#include <memory>
+#include <string>
+
+using std::auto_ptr;
+using std::string;
+
+namespace neverclaim {
+
+/**
+ * Unit tests for the LtlTranslator class.
+ *
+ * @author mwi
+ */
+class LtlTranslatorTest : public ::testing::Test {
+
+protected:
+    auto_ptr<LtlTranslator> target;
+
+    /**
+     * Makes target be the translation of the negation of the LTL property
+     * 'ltl', as for a never claim.
+     */
+    void translate(const string & ltl) {
+        target.reset(new LtlTranslator(LtlFormula::makeNot(
+                LtlParser(ltl).parse())));
+    }
+};
+
+TEST_F(LtlTranslatorTest, toPromela_safety) {
+    // Exercise
+    translate("[]!(state2)");
+
+    // Verify
+    ASSERT_EQ(2u, target->getNbOfStates());
+    ASSERT_EQ(
+            "never { /* !([]!(state2)) */\n"
+            "T0_init:\n"
+            "\tif\n"
+            "\t:: (1) -> goto T0_init\n"
+            "\t:: (state2) -> goto accept_all\n"
+            "\tfi;\n"
+            "accept_all:\n"
+            "\tskip\n"
+            "}\n", target->toPromela("!([]!(state2))"));
+}
+
+TEST_F(LtlTranslatorTest, toPromela_liveness) {
+    // Exercise
+    translate("[]<>p");
+
+    // Verify
+    ASSERT_EQ(
+            "never { /* !([]<>p) */\n"
+            "T0_init:\n"
+            "\tif\n"
+            "\t:: (1) -> goto T0_init\n"
+            "\t:: (!p) -> goto accept_S1\n"
+            "\tfi;\n"
+            "accept_S1:\n"
+            "\tif\n"
+            "\t:: (!p) -> goto accept_S1\n"
+            "\tfi;\n"
+            "}\n", target->toPromela("!([]<>p)"));
+}
+
+TEST_F(LtlTranslatorTest, toPromela_acceptingInit) {
+    // Exercise
+    translate("<>p");
+
+    // Verify
+    ASSERT_EQ(
+            "never { /* !(<>p) */\n"
+            "accept_init:\n"
+            "\tif\n"
+            "\t:: (!p) -> goto accept_init\n"
+            "\tfi;\n"
+            "}\n", target->toPromela("!(<>p)"));
+}
+
+TEST_F(LtlTranslatorTest, toPromela_false) {
+    // Exercise
+    translate("false");
+
+    // Verify
+    ASSERT_EQ(
+            "never { /* !(false) */\n"
+            "T0_init:\n"
+            "\tif\n"
+            "\t:: (1) -> goto accept_all\n"
+            "\tfi;\n"
+            "accept_all:\n"
+            "\tskip\n"
+            "}\n", target->toPromela("!(false)"));
+}
+
+TEST_F(LtlTranslatorTest, toPromela_true) {
+    // Exercise
+    translate("p || !p");
+
+    // Verify
+    ASSERT_EQ(1u, target->getNbOfStates());
+    ASSERT_EQ(
+            "never { /* !(p || !p) */\n"
+            "T0_init:\n"
+            "\tif\n"
+            "\t:: (0) -> goto T0_init\n"
+            "\tfi;\n"
+            "}\n", target->toPromela("!(p || !p)"));
+}
+
+TEST_F(LtlTranslatorTest, toPromela_parsable) {
+    // Setup
+    translate("[]<>(p1 -> Xp2) && (p3 U (p4 || []p5))");
+
+    // Exercise & Verify
+    ASSERT_NO_THROW(NeverClaimParser(target->toPromela("comment")).parse());
+}
+
+TEST_F(LtlTranslatorTest, getTransitions) {
+    // Setup
+    translate("[]!(state2)");
+
+    // Exercise
+    ClaimTransitionGeneratorPtr transitions = target->getTransitions();
+
+    // Verify
+    ASSERT_TRUE(transitions->hasNext());
+    ClaimTransitionPtr first = transitions->next();
+    ASSERT_EQ("T0_init", first->getSource()->getLabel());
+    ASSERT_EQ("T0_init", first->getTarget()->getLabel());
+    ASSERT_TRUE(transitions->hasNext());
+    ClaimTransitionPtr second = transitions->next();
+    ASSERT_EQ("T0_init", second->getSource()->getLabel());
+    ASSERT_TRUE(second->getTarget()->isFinal());
+    ASSERT_FALSE(transitions->hasNext());
+}
+
+} // namespace neverclaim
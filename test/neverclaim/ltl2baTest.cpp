@@ -8,6 +8,10 @@
 
 #include "neverclaim/ltl2ba.hpp"
 
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
 
 using std::ifstream;
@@ -24,20 +28,25 @@ namespace neverclaim {
 class ltl2baTest : public ::testing::Test {
 
 protected:
+    /** The path of the temporary file the claim is written to. */
+    string filePath;
 
     void SetUp() {
-        // Nothing here
+        char path[] = "/tmp/pvl_ltl2baXXXXXX";
+        const int fd = mkstemp(path);
+        ASSERT_LE(0, fd);
+        close(fd);
+        filePath = path;
     }
 
     void TearDown() {
-        // Nothing here
+        std::remove(filePath.c_str());
     }
 };
 
 TEST_F(ltl2baTest, ltl2ba) {
     // Setup
     const string ltlProperty("[]<>(p1 -> Xp2)");
-    const string filePath("__test_ltl2ba.tmp");
 
     // Exercise
     bool result = ltl2ba(ltlProperty, filePath);
@@ -58,7 +67,6 @@ TEST_F(ltl2baTest, ltl2ba) {
 TEST_F(ltl2baTest, ltl2ba_invalidLtl) {
     // Setup
     const string ltlProperty("[]<>(p1 -");
-    const string filePath("__test_ltl2ba_invalidLtl.tmp");
 
     // Exercise
     bool result = ltl2ba(ltlProperty, filePath);
@@ -0,0 +1,62 @@
+/*
+ * CommandLineTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "ui/CommandLine.hpp"
+
+#include "util/NotPossibleException.hpp"
+
+using util::NotPossibleException;
+
+namespace ui {
+
+/**
+ * Unit tests for the CommandLine class.
+ *
+ * @author mwi
+ */
+class CommandLineTest : public ::testing::Test {
+};
+
+TEST_F(CommandLineTest, compile) {
+    // Setup
+    const char * argv[] = {"provelines", "compile", "in.json", "out.pvl"};
+
+    // Exercise
+    CommandLine commandLine(4, argv);
+
+    // Verify
+    ASSERT_TRUE(commandLine.isCompile());
+    ASSERT_EQ("in.json", commandLine.getInputPath());
+    ASSERT_EQ("out.pvl", commandLine.getOutputPath());
+}
+
+TEST_F(CommandLineTest, compile_emptyOutput) {
+    // Setup
+    const char * argv[] = {"provelines", "compile", "in.json", ""};
+
+    // Exercise & Verify
+    ASSERT_THROW(CommandLine(4, argv), NotPossibleException);
+}
+
+TEST_F(CommandLineTest, compile_emptyInput) {
+    // Setup
+    const char * argv[] = {"provelines", "compile", "", "out.pvl"};
+
+    // Exercise & Verify
+    ASSERT_THROW(CommandLine(4, argv), NotPossibleException);
+}
+
+TEST_F(CommandLineTest, check_emptyInput) {
+    // Setup
+    const char * argv[] = {"provelines", "-v", ""};
+
+    // Exercise & Verify
+    ASSERT_THROW(CommandLine(3, argv), NotPossibleException);
+}
+
+} // namespace ui
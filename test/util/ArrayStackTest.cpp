@@ -0,0 +1,88 @@
+/*
+ * ArrayStackTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "util/ArrayStack.hpp"
+
+namespace util {
+
+/**
+ * Unit tests for the ArrayStack class.
+ *
+ * @author mwi
+ */
+class ArrayStackTest : public ::testing::Test {
+
+protected:
+    ArrayStack<int> stack;
+    ArrayStack<int> stack2;
+
+    void SetUp() {
+        // Initialize stack2
+        for (int i = 0; i < 10; i++) {
+            stack2.push(i);
+        }
+    }
+};
+
+TEST_F(ArrayStackTest, push) {
+    // Exercise
+    stack.push(5);
+    stack.push(13);
+
+    // Verify
+    ASSERT_EQ(2, stack.count());
+    ASSERT_EQ(13, stack.peek());
+}
+
+TEST_F(ArrayStackTest, pop) {
+    // Exercise
+    int head = stack2.pop();
+
+    // Verify
+    ASSERT_EQ(9, head);
+    ASSERT_EQ(9, stack2.count());
+    ASSERT_EQ(8, stack2.peek());
+}
+
+TEST_F(ArrayStackTest, pop_push) {
+    // Exercise
+    stack2.pop();
+    stack2.push(42);
+
+    // Verify
+    ASSERT_EQ(10, stack2.count());
+    ASSERT_EQ(42, stack2.pop());
+    ASSERT_EQ(8, stack2.pop());
+}
+
+TEST_F(ArrayStackTest, peek) {
+    // Exercise
+    stack.push(5);
+
+    // Verify
+    ASSERT_EQ(5, stack.peek());
+    ASSERT_EQ(9, stack2.peek());
+}
+
+TEST_F(ArrayStackTest, at) {
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQ(i, stack2.at(i));
+    }
+}
+
+TEST_F(ArrayStackTest, empty) {
+    ASSERT_TRUE(stack.empty());
+    ASSERT_FALSE(stack2.empty());
+}
+
+TEST_F(ArrayStackTest, count) {
+    ASSERT_EQ(0, stack.count());
+    ASSERT_EQ(10, stack2.count());
+}
+
+} // namespace util
@@ -0,0 +1,70 @@
+/*
+ * ThreadPoolTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "util/ThreadPool.hpp"
+
+#include <vector>
+
+using std::vector;
+
+namespace util {
+
+/**
+ * A task that squares the index of each item.
+ */
+class SquareTask : public ParallelTask {
+
+public:
+    vector<unsigned int> results;
+
+    explicit SquareTask(unsigned int size) : results(size, 0) {}
+
+    void run(unsigned int index) {
+        results[index] = index * index;
+    }
+};
+
+/**
+ * Unit tests for the ThreadPool class.
+ *
+ * @author mwi
+ */
+class ThreadPoolTest : public ::testing::Test {
+
+protected:
+    /**
+     * Asserts a pool of 'nbOfThreads' threads runs every item exactly once.
+     */
+    void assertRunsAllItems(unsigned int nbOfThreads) {
+        ThreadPool pool(nbOfThreads);
+        ASSERT_EQ(nbOfThreads, pool.getNbOfThreads());
+
+        // Several tasks in a row reuse the same threads.
+        for (unsigned int size = 0; size < 2000; size += 499) {
+            SquareTask task(size);
+            pool.run(task, size);
+            for (unsigned int i = 0; i < size; i++) {
+                ASSERT_EQ(i * i, task.results[i]);
+            }
+        }
+    }
+};
+
+TEST_F(ThreadPoolTest, singleThread) {
+    assertRunsAllItems(1);
+}
+
+TEST_F(ThreadPoolTest, severalThreads) {
+    assertRunsAllItems(4);
+}
+
+TEST_F(ThreadPoolTest, getNbOfCores) {
+    ASSERT_LE(1u, ThreadPool::getNbOfCores());
+}
+
+} // namespace util
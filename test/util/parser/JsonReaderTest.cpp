@@ -0,0 +1,115 @@
+/*
+ * JsonReaderTest.cpp
+ *
+ * Created on 2026-10-19
+ */
+
+#include "gtest/gtest.h"
+
+#include "util/JsonException.hpp"
+#include "util/parser/JsonReader.hpp"
+
+#include <sstream>
+
+using std::istringstream;
+using std::string;
+
+namespace util {
+namespace parser {
+
+/**
+ * Unit tests for the JsonReader class.
+ *
+ * @author mwi
+ */
+class JsonReaderTest : public ::testing::Test {
+};
+
+TEST_F(JsonReaderTest, object) {
+    // Setup
+    istringstream input("{ \"name\" : \"Sample\", \"size\": -12,\n"
+            "\t\"flag\":true, \"none\":null }");
+    JsonReader reader(input);
+
+    // Exercise & Verify
+    reader.beginObject();
+    ASSERT_TRUE(reader.hasNext());
+    ASSERT_EQ("name", reader.nextName());
+    ASSERT_EQ(JsonReader::StringValue, reader.peek());
+    ASSERT_EQ("Sample", reader.nextString());
+    ASSERT_EQ("size", reader.nextName());
+    ASSERT_EQ(-12, reader.nextInt());
+    ASSERT_EQ("flag", reader.nextName());
+    ASSERT_TRUE(reader.nextBool());
+    ASSERT_EQ("none", reader.nextName());
+    ASSERT_EQ(JsonReader::NullValue, reader.peek());
+    reader.nextNull();
+    ASSERT_FALSE(reader.hasNext());
+    reader.endObject();
+    ASSERT_EQ(JsonReader::EndValue, reader.peek());
+}
+
+TEST_F(JsonReaderTest, array) {
+    // Setup
+    istringstream input("[\"a\", \"b\\\"\\n\\u00e9\", []]");
+    JsonReader reader(input);
+
+    // Exercise & Verify
+    reader.beginArray();
+    ASSERT_EQ("a", reader.nextString());
+    ASSERT_EQ("b\"\n\xc3\xa9", reader.nextString());
+    ASSERT_EQ(JsonReader::ArrayValue, reader.peek());
+    reader.beginArray();
+    ASSERT_FALSE(reader.hasNext());
+    reader.endArray();
+    ASSERT_FALSE(reader.hasNext());
+    reader.endArray();
+}
+
+TEST_F(JsonReaderTest, skipValue) {
+    // Setup
+    istringstream input("{\"skipped\": {\"a\": [1, 2.5e3, {\"b\": false}]},"
+            " \"kept\": 3}");
+    JsonReader reader(input);
+
+    // Exercise
+    reader.beginObject();
+    ASSERT_EQ("skipped", reader.nextName());
+    reader.skipValue();
+
+    // Verify
+    ASSERT_EQ("kept", reader.nextName());
+    ASSERT_EQ(3, reader.nextInt());
+    reader.endObject();
+}
+
+TEST_F(JsonReaderTest, syntaxErrors) {
+    // Setup
+    istringstream missingComma("[\"a\" \"b\"]");
+    istringstream trailingComma("[1, ]");
+    istringstream unterminated("[\"a");
+    istringstream wrongType("{\"a\": 1}");
+    JsonReader missingCommaReader(missingComma);
+    JsonReader trailingCommaReader(trailingComma);
+    JsonReader unterminatedReader(unterminated);
+    JsonReader wrongTypeReader(wrongType);
+
+    // Exercise & Verify
+    missingCommaReader.beginArray();
+    missingCommaReader.nextString();
+    ASSERT_THROW(missingCommaReader.hasNext(), JsonException);
+
+    trailingCommaReader.beginArray();
+    trailingCommaReader.nextInt();
+    ASSERT_THROW(trailingCommaReader.endArray(), JsonException);
+
+    unterminatedReader.beginArray();
+    ASSERT_THROW(unterminatedReader.nextString(), JsonException);
+
+    wrongTypeReader.beginObject();
+    wrongTypeReader.nextName();
+    ASSERT_THROW(wrongTypeReader.nextString(), JsonException);
+}
+
+} // namespace parser
+} // namespace util